@@ -0,0 +1,130 @@
+// Preview pipeline of the firmware on the host: the preview module (src/preview.hpp) between a capture task started by
+// pipeline::startTask (a std::thread here) and a loop() blocked on a Signal, on the JPEGs replayed by the camera stand-in
+// (host/shims/camera_replay.h). Each side can spend a fixed extra time per frame (busy wait) to model a slower sensor or
+// the TFT write. Prints the throughput, the sensor to display latency and the level the governor settled on.
+//   previewBench [-n frames] [-c capture us] [-p display us] <frame.jpg>...
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <unistd.h>
+
+#include "Signal.h"
+#include "Task.h"
+#include "camera_replay.h"
+#include "capture.hpp"
+#include "jpeg.hpp"
+#include "preview.hpp"
+#include "utils.hpp"
+
+#define BENCH_DEFAULT_FRAMES 500
+#define BENCH_WAIT_MS 1000 // the loop gives up when the capture task stalls that long
+
+namespace {
+
+    struct Options {
+        long captureUs;
+        long displayUs;
+    };
+
+    pipeline::Signal loopWake;
+    std::atomic<bool> stopCapture {false};
+    std::atomic<bool> captureStopped {false};
+    std::atomic<size_t> captureStalls {0}; // passes of the capture task without a frame, no free frame or a failed grab
+
+    void spinUs(const long us) {
+        if (us <= 0) return;
+        const int64_t end = pipeline::nowUs() + us;
+        while (pipeline::nowUs() < end) {}
+    }
+
+    // captureTask of src/main.cpp without the print captures
+    void captureTask(void* arg) {
+        const Options& options = *static_cast<const Options*>(arg);
+        capture::Frame jpeg;
+        jpeg::GrayDecoder decoder {memory::EOwner::decode};
+        while (!stopCapture.load()) {
+            if (preview::captureNext(jpeg, decoder)) {
+                spinUs(options.captureUs);
+                continue;
+            }
+            ++captureStalls;
+            pipeline::sleepMs(1);
+        }
+        captureStopped = true;
+    }
+
+    void drawPreview(const PrinterMatrix& dithered, const size_t displayScale, void* arg) {
+        const Options& options = *static_cast<const Options*>(arg);
+        TFT_eSPI tft;
+        utils::drawGrayScale(tft, 0, 0, dithered, displayScale);
+        spinUs(options.displayUs);
+    }
+
+    double percentile(std::vector<double>& values, const double p) {
+        const size_t index = std::min(values.size() - 1, static_cast<size_t>(p * values.size()));
+        std::nth_element(values.begin(), values.begin() + index, values.end());
+        return values[index];
+    }
+
+    void usage() {
+        std::printf("previewBench [-n <frames>] [-c <capture us per frame>] [-p <display us per frame>] <frame.jpg>...\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t count = BENCH_DEFAULT_FRAMES;
+    Options options {0, 0};
+
+    int opt;
+    while ((opt = getopt(argc, argv, "hn:c:p:")) != -1) {
+        switch (opt) {
+            case 'n': count = static_cast<size_t>(std::max(1L, std::atol(optarg))); break;
+            case 'c': options.captureUs = std::atol(optarg); break;
+            case 'p': options.displayUs = std::atol(optarg); break;
+            case 'h': usage(); return 0;
+            default: usage(); return 2;
+        }
+    }
+    if (optind >= argc) { usage(); return 2; }
+    if (!replay::load(argv + optind, argc - optind)) return 1;
+
+    // setup() of src/main.cpp
+    capture::init(esp_camera_sensor_get(), preview::framesize());
+    preview::init(&loopWake);
+    if (!pipeline::startTask("capture", captureTask, &options, 8192, 1, 0)) {
+        std::fprintf(stderr, "previewBench: capture task creation failed\n");
+        return 1;
+    }
+
+    std::vector<double> latencyUs;
+    latencyUs.reserve(count);
+    const int64_t start = pipeline::nowUs();
+    while (latencyUs.size() < count) {
+        if (!preview::update(drawPreview, &options, false)) {
+            if (!loopWake.wait(BENCH_WAIT_MS) && !preview::ready()) break;
+            continue;
+        }
+        latencyUs.push_back(static_cast<double>(preview::lastLatencyUs()));
+    }
+    const double elapsedS = (pipeline::nowUs() - start) / 1e6;
+    stopCapture = true;
+    while (!captureStopped.load()) pipeline::sleepMs(1);
+
+    if (latencyUs.size() != count) {
+        std::fprintf(stderr, "previewBench: %zu of %zu frames displayed\n", latencyUs.size(), count);
+        return 1;
+    }
+
+    const governor::Governor& levels = preview::governorState();
+    double sum = 0;
+    for (const double us : latencyUs) sum += us;
+    std::printf("frames,capture_us,display_us,frames_per_s,latency_mean_us,latency_p50_us,latency_p99_us,latency_max_us,"
+        "capture_stalls,level,width,height\n");
+    std::printf("%zu,%ld,%ld,%.1f,%.0f,%.0f,%.0f,%.0f,%zu,%zu,%zu,%zu\n", count, options.captureUs, options.displayUs,
+        count / elapsedS, sum / count, percentile(latencyUs, 0.5), percentile(latencyUs, 0.99),
+        *std::max_element(latencyUs.begin(), latencyUs.end()), captureStalls.load(), levels.levelIndex(),
+        levels.level().width, levels.level().height);
+    return 0;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+
+#include "esp32-hal.h"
+#include "esp32-hal-log.h"
+
+// Host stand-in for the Arduino core header, only the memory statistics of src/utils.cpp: the host has no heap figures
+class EspClass {
+public:
+    inline uint32_t getHeapSize() { return 0; }
+    inline uint32_t getFreeHeap() { return 0; }
+    inline uint32_t getPsramSize() { return 0; }
+    inline uint32_t getFreePsram() { return 0; }
+};
+
+extern EspClass ESP;
@@ -0,0 +1,71 @@
+#include "HardwareSerial.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "esp32-hal-log.h"
+
+namespace {
+    speed_t toSpeed(const uint32_t baud) {
+        switch (baud) {
+            case 9600: return B9600;
+            case 19200: return B19200;
+            case 38400: return B38400;
+            case 57600: return B57600;
+            case 115200: return B115200;
+            case 230400: return B230400;
+            case 460800: return B460800;
+            case 921600: return B921600;
+            default: return B0; // a pseudo terminal has no speed, keep its own
+        }
+    }
+}
+
+bool HardwareSerial::open(const char* path, const uint32_t baud) {
+    end();
+    fd_ = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_NOCTTY, 0644);
+    if (fd_ < 0) {
+        log_e("HardwareSerial: can't open %s", path);
+        return false;
+    }
+    if (isatty(fd_)) {
+        termios tio;
+        if (tcgetattr(fd_, &tio) == 0) {
+            cfmakeraw(&tio);
+            if (toSpeed(baud) != B0) cfsetospeed(&tio, toSpeed(baud));
+            tcsetattr(fd_, TCSANOW, &tio);
+        }
+    }
+    return true;
+}
+
+void HardwareSerial::end() {
+    if (fd_ < 0) return;
+    flush();
+    ::close(fd_);
+    fd_ = -1;
+}
+
+void HardwareSerial::flush() {
+    if (fd_ >= 0 && isatty(fd_)) tcdrain(fd_);
+}
+
+size_t HardwareSerial::write(uint8_t byte) {
+    return write(&byte, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* data, size_t size) {
+    size_t written = 0;
+    while (fd_ >= 0 && written < size) {
+        const ssize_t n = ::write(fd_, data + written, size - written);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            log_e("HardwareSerial: write failed after %zu of %zu bytes", written, size);
+            break;
+        }
+        written += static_cast<size_t>(n);
+    }
+    return written;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Print.h"
+
+// Host stand-in for the printer UART: the bytes go to a file or a tty, e.g. the pseudo terminal tools/printerEmulator.py
+// listens on. A tty is switched to raw mode, every write blocks until the bytes are handed to the kernel.
+class HardwareSerial : public Print {
+private:
+    int fd_;
+
+public:
+    HardwareSerial() : fd_{-1} {}
+    ~HardwareSerial() { end(); }
+
+    // in place of begin(baud, config, rx, tx) of the device, a file is created or truncated
+    bool open(const char* path, const uint32_t baud);
+    void end();
+    // wait until a tty sent everything
+    void flush();
+
+    inline bool isOpen() const { return fd_ >= 0; }
+
+    size_t write(uint8_t byte) override;
+    size_t write(const uint8_t* data, size_t size) override;
+};
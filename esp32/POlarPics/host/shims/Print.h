@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Host stand-in for the Arduino Print class, the byte sink of lib/thermal: a subclass only has to write single bytes
+class Print {
+public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t byte) = 0;
+
+    virtual size_t write(const uint8_t* data, size_t size) {
+        size_t written = 0;
+        while (written < size && write(data[written]) == 1) ++written;
+        return written;
+    }
+};
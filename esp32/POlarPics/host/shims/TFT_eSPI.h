@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Arduino.h"
+
+// Host stand-in for the TFT_eSPI display driver, only the calls of src/utils.*, src/menu.* and src/printing.*: nothing is displayed,
+// the pixels written are counted
+#define TFT_WHITE 0xFFFF
+#define TFT_CYAN 0x07FF
+#define TFT_DARKGREY 0x7BEF
+#define TFT_RED 0xF800
+
+#define TFT_FONT_HEIGHT 26 // font 4 of the driver
+
+class TFT_eSPI {
+private:
+    size_t pixels_;
+
+public:
+    TFT_eSPI() : pixels_{0} {}
+
+    inline uint16_t color565(uint8_t r, uint8_t g, uint8_t b) { return (r & 0xF8) << 8 | (g & 0xFC) << 3 | b >> 3; }
+
+    inline void drawPixel(int32_t, int32_t, uint32_t) { ++pixels_; }
+    inline void fillRect(int32_t, int32_t, int32_t w, int32_t h, uint32_t) { pixels_ += w * h; }
+    inline void fillScreen(uint32_t) { pixels_ += 320 * 240; }
+    inline void drawLine(int32_t, int32_t, int32_t, int32_t, uint32_t) {}
+    inline void fillCircle(int32_t, int32_t, int32_t r, uint32_t) { pixels_ += 3 * r * r; }
+
+    inline void setTextPadding(uint16_t) {}
+    inline void setTextSize(uint8_t) {}
+    inline void setTextColor(uint16_t, uint16_t) {}
+    inline int16_t fontHeight(int16_t) { return TFT_FONT_HEIGHT; }
+    inline int16_t drawString(const char*, int32_t, int32_t, uint8_t) { return 0; }
+
+    // pixels written since the construction
+    inline size_t pixels() const { return pixels_; }
+};
@@ -0,0 +1,206 @@
+#include "camera_replay.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <jpeglib.h>
+
+#include "esp32-hal-log.h"
+#include "esp_jpg_decode.h"
+
+namespace replay {
+
+    namespace {
+        struct Size {
+            size_t width;
+            size_t height;
+        };
+
+        // framesize_t order
+        const Size framesizes[FRAMESIZE_INVALID] = {
+            {96, 96}, {160, 120}, {176, 144}, {240, 176}, {240, 240}, {320, 240}, {400, 296}, {480, 320}, {640, 480},
+            {800, 600}, {1024, 768}, {1280, 720}, {1280, 1024}, {1600, 1200}
+        };
+
+        std::vector<std::vector<uint8_t>> frames[FRAMESIZE_INVALID]; // JPEG of every loaded file, per framesize
+        size_t nextFrame = 0;
+        framesize_t current = FRAMESIZE_UXGA; // configured size of main.cpp
+        framesize_t queuedFramesize = FRAMESIZE_UXGA; // size of the frames still queued after a switch
+        size_t queued = 0;
+        camera_fb_t buffers[REPLAY_FB_COUNT];
+        bool taken[REPLAY_FB_COUNT] = {};
+
+        struct Image {
+            std::vector<uint8_t> rgb;
+            size_t width;
+            size_t height;
+        };
+
+        // the source file goes through the decoder stand-in, the image arrives in RGB888 MCU rows
+        struct DecodeTarget {
+            const std::vector<uint8_t>* jpeg;
+            Image* image;
+        };
+
+        size_t readBytes(void* arg, size_t index, uint8_t* buf, size_t len) {
+            const std::vector<uint8_t>& data = *static_cast<DecodeTarget*>(arg)->jpeg;
+            if (index >= data.size()) return 0;
+            len = std::min(len, data.size() - index);
+            if (buf != nullptr) std::copy(data.begin() + index, data.begin() + index + len, buf);
+            return len;
+        }
+
+        bool writeRows(void* arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t* data) {
+            Image& image = *static_cast<DecodeTarget*>(arg)->image;
+            if (data == nullptr) {
+                if (x == 0 && y == 0) {
+                    image.width = w;
+                    image.height = h;
+                    image.rgb.assign(static_cast<size_t>(w) * h * 3, 0);
+                }
+                return true;
+            }
+            for (size_t r = 0; r < h; ++r)
+                std::copy(data + r * w * 3, data + (r + 1) * w * 3, image.rgb.begin() + ((y + r) * image.width + x) * 3);
+            return true;
+        }
+
+        bool readFile(const char* path, std::vector<uint8_t>& data) {
+            std::FILE* file = std::fopen(path, "rb");
+            if (file == nullptr) return false;
+            std::fseek(file, 0, SEEK_END);
+            const long size = std::ftell(file);
+            std::fseek(file, 0, SEEK_SET);
+            data.resize(size > 0 ? size : 0);
+            const bool ok = size > 0 && std::fread(data.data(), 1, data.size(), file) == data.size();
+            std::fclose(file);
+            return ok;
+        }
+
+        // Nearest neighbour resize to the framesize then JPEG with the 4:2:2 subsampling of the OV2640.
+        // A libjpeg error while encoding ends the process, it can only come from a bug here.
+        void encode(const Image& image, const Size& size, std::vector<uint8_t>& out) {
+            std::vector<uint8_t> row(size.width * 3);
+            jpeg_compress_struct cinfo;
+            jpeg_error_mgr error;
+            cinfo.err = jpeg_std_error(&error);
+            jpeg_create_compress(&cinfo);
+            unsigned char* buffer = nullptr;
+            unsigned long bufferSize = 0;
+            jpeg_mem_dest(&cinfo, &buffer, &bufferSize);
+
+            cinfo.image_width = size.width;
+            cinfo.image_height = size.height;
+            cinfo.input_components = 3;
+            cinfo.in_color_space = JCS_RGB;
+            jpeg_set_defaults(&cinfo);
+            jpeg_set_quality(&cinfo, REPLAY_JPEG_QUALITY, TRUE);
+            cinfo.comp_info[0].h_samp_factor = 2;
+            cinfo.comp_info[0].v_samp_factor = 1;
+            jpeg_start_compress(&cinfo, TRUE);
+            while (cinfo.next_scanline < cinfo.image_height) {
+                const size_t srcRow = cinfo.next_scanline * image.height / size.height;
+                for (size_t c = 0; c < size.width; ++c) {
+                    const uint8_t* src = image.rgb.data() + (srcRow * image.width + c * image.width / size.width) * 3;
+                    std::copy(src, src + 3, row.begin() + c * 3);
+                }
+                JSAMPROW rows[1] = {row.data()};
+                jpeg_write_scanlines(&cinfo, rows, 1);
+            }
+            jpeg_finish_compress(&cinfo);
+            out.assign(buffer, buffer + bufferSize);
+            jpeg_destroy_compress(&cinfo);
+            std::free(buffer);
+        }
+
+        int setFramesize(sensor_t*, const framesize_t framesize) {
+            if (framesize >= FRAMESIZE_INVALID) return -1;
+            if (framesize != current) {
+                queuedFramesize = current;
+                queued = REPLAY_FB_COUNT;
+                current = framesize;
+            }
+            return 0;
+        }
+
+        int ignore(sensor_t*, int) { return 0; }
+        int ignoreGainceiling(sensor_t*, gainceiling_t) { return 0; }
+
+        sensor_t makeSensor() {
+            sensor_t sensor;
+            sensor.set_framesize = setFramesize;
+            sensor.set_contrast = sensor.set_brightness = sensor.set_saturation = ignore;
+            sensor.set_gainceiling = ignoreGainceiling;
+            sensor.set_colorbar = sensor.set_whitebal = sensor.set_gain_ctrl = sensor.set_exposure_ctrl = ignore;
+            sensor.set_hmirror = sensor.set_vflip = sensor.set_aec2 = sensor.set_awb_gain = ignore;
+            sensor.set_agc_gain = sensor.set_aec_value = sensor.set_special_effect = sensor.set_wb_mode = ignore;
+            sensor.set_ae_level = sensor.set_dcw = sensor.set_bpc = sensor.set_wpc = sensor.set_raw_gma = sensor.set_lenc = ignore;
+            return sensor;
+        }
+
+        sensor_t sensor = makeSensor();
+    }
+
+    bool load(const char* const* paths, const size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            std::vector<uint8_t> jpeg;
+            if (!readFile(paths[i], jpeg)) {
+                log_e("replay: can't read %s", paths[i]);
+                return false;
+            }
+            Image image;
+            DecodeTarget target {&jpeg, &image};
+            if (esp_jpg_decode(jpeg.size(), JPG_SCALE_NONE, readBytes, writeRows, &target) != ESP_OK) {
+                log_e("replay: can't decode %s", paths[i]);
+                return false;
+            }
+            for (size_t f = 0; f < FRAMESIZE_INVALID; ++f) {
+                frames[f].emplace_back();
+                encode(image, framesizes[f], frames[f].back());
+            }
+        }
+        return true;
+    }
+
+    size_t frameCount() { return frames[0].size(); }
+}
+
+camera_fb_t* esp_camera_fb_get() {
+    using namespace replay;
+    if (frameCount() == 0) {
+        log_e("esp_camera_fb_get: no frame loaded (replay::load)");
+        return nullptr;
+    }
+    const size_t index = std::find(taken, taken + REPLAY_FB_COUNT, false) - taken;
+    if (index == REPLAY_FB_COUNT) {
+        log_e("esp_camera_fb_get: every frame buffer is taken");
+        return nullptr;
+    }
+
+    framesize_t framesize = current;
+    if (queued > 0) {
+        framesize = queuedFramesize;
+        --queued;
+    }
+    const std::vector<uint8_t>& jpeg = frames[framesize][nextFrame++ % frameCount()];
+    camera_fb_t& fb = buffers[index];
+    fb.buf = const_cast<uint8_t*>(jpeg.data());
+    fb.len = jpeg.size();
+    fb.width = framesizes[framesize].width;
+    fb.height = framesizes[framesize].height;
+    fb.format = PIXFORMAT_JPEG;
+    gettimeofday(&fb.timestamp, nullptr);
+    taken[index] = true;
+    return &fb;
+}
+
+void esp_camera_fb_return(camera_fb_t* fb) {
+    using namespace replay;
+    for (size_t i = 0; i < REPLAY_FB_COUNT; ++i) {
+        if (fb == &buffers[i]) taken[i] = false;
+    }
+}
+
+sensor_t* esp_camera_sensor_get() { return &replay::sensor; }
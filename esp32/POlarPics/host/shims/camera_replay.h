@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+
+#include "esp_camera.h"
+
+// Frames of the host camera stand-in: JPEG files decoded once and encoded again at every framesize of the driver,
+// esp_camera_fb_get then hands them out in turn at the size of the last set_framesize, like a sensor filming a slideshow.
+// The frame buffers come back like the driver ones, the REPLAY_FB_COUNT frames after a framesize switch still have the
+// previous size. The driver functions are meant to be called from a single task (the capture task).
+namespace replay {
+
+    #define REPLAY_FB_COUNT 2 // driver frame buffers, fb_count of the PSRAM configuration
+    #define REPLAY_JPEG_QUALITY 80 // libjpeg quality, about the sensor quality 10 to 12
+
+    // Load and encode every file, false when one of them can't be read or decoded. Before the first esp_camera_fb_get.
+    bool load(const char* const* paths, const size_t count);
+
+    // frames in the slideshow
+    size_t frameCount();
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdio>
+
+// Host stand-in for the Arduino-ESP32 log macros: every level goes to stderr, CORE_DEBUG_LEVEL is ignored
+#define log_e(format, ...) std::fprintf(stderr, "[E] " format "\n", ##__VA_ARGS__)
+#define log_w(format, ...) std::fprintf(stderr, "[W] " format "\n", ##__VA_ARGS__)
+#define log_i(format, ...) std::fprintf(stderr, "[I] " format "\n", ##__VA_ARGS__)
+#define log_d(format, ...) std::fprintf(stderr, "[D] " format "\n", ##__VA_ARGS__)
+#define log_v(format, ...) std::fprintf(stderr, "[V] " format "\n", ##__VA_ARGS__)
@@ -0,0 +1,10 @@
+#include "esp32-hal.h"
+#include "Arduino.h"
+
+#include <cstdlib>
+
+extern "C" void* ps_malloc(size_t size) { return std::malloc(size); }
+
+bool psramFound() { return false; }
+
+EspClass ESP;
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+// Host stand-in for the Arduino-ESP32 HAL: there is no PSRAM, ps_malloc is malloc.
+// Not inline, like on the device, so a host build can wrap it at link time (AllocGuard).
+extern "C" void* ps_malloc(size_t size);
+
+bool psramFound();
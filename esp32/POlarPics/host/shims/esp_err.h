@@ -0,0 +1,7 @@
+#pragma once
+
+// Host stand-in for the ESP-IDF error codes, only the two the stand-ins return
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
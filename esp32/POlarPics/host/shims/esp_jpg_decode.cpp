@@ -0,0 +1,131 @@
+#include "esp_jpg_decode.h"
+
+#include <algorithm>
+#include <csetjmp>
+#include <cstdio>
+
+#include <jpeglib.h>
+
+#include "esp32-hal-log.h"
+
+#define JPG_INPUT_CHUNK 4096 // bytes pulled from the reader at once
+#define JPG_MAX_BLOCK_ROWS 16 // MCU height of TJpgDec, 4:2:0 subsampling
+
+namespace {
+
+    // libjpeg reports errors through error_exit, which must not return
+    struct ErrorManager {
+        jpeg_error_mgr base;
+        std::jmp_buf jump;
+    };
+
+    void errorExit(j_common_ptr cinfo) {
+        char message[JMSG_LENGTH_MAX];
+        (*cinfo->err->format_message)(cinfo, message);
+        log_e("esp_jpg_decode: %s", message);
+        std::longjmp(reinterpret_cast<ErrorManager*>(cinfo->err)->jump, 1);
+    }
+
+    // Input pulled through the reader callback a chunk at a time, like the ROM decoder does
+    struct Source {
+        jpeg_source_mgr base;
+        jpg_reader_cb reader;
+        void* arg;
+        size_t index; // next byte to read
+        size_t len;
+        JOCTET buffer[JPG_INPUT_CHUNK];
+    };
+
+    void initSource(j_decompress_ptr) {}
+    void termSource(j_decompress_ptr) {}
+
+    boolean fillInput(j_decompress_ptr cinfo) {
+        Source& source = *reinterpret_cast<Source*>(cinfo->src);
+        size_t count = 0;
+        if (source.index < source.len)
+            count = source.reader(source.arg, source.index, source.buffer, std::min<size_t>(JPG_INPUT_CHUNK, source.len - source.index));
+        source.index += count;
+        if (count == 0) {
+            // truncated input: end the image like the stdio source of libjpeg does, the missing rows come out gray
+            source.buffer[0] = 0xFF;
+            source.buffer[1] = JPEG_EOI;
+            count = 2;
+        }
+        source.base.next_input_byte = source.buffer;
+        source.base.bytes_in_buffer = count;
+        return TRUE;
+    }
+
+    void skipInput(j_decompress_ptr cinfo, long count) {
+        Source& source = *reinterpret_cast<Source*>(cinfo->src);
+        if (count <= 0) return;
+        if (static_cast<size_t>(count) <= source.base.bytes_in_buffer) {
+            source.base.next_input_byte += count;
+            source.base.bytes_in_buffer -= count;
+            return;
+        }
+        source.index += count - source.base.bytes_in_buffer;
+        source.base.bytes_in_buffer = 0;
+    }
+}
+
+// libjpeg allocates its work memory from its own pools, in the shared library: the link time wrapping of a host
+// AllocGuard build doesn't see it, like the static work area of the ROM decoder
+esp_err_t esp_jpg_decode(size_t len, jpg_scale_t scale, jpg_reader_cb reader, jpg_writer_cb writer, void* arg) {
+    jpeg_decompress_struct cinfo;
+    ErrorManager error;
+    Source source;
+    cinfo.err = jpeg_std_error(&error.base);
+    error.base.error_exit = errorExit;
+    if (setjmp(error.jump)) {
+        jpeg_destroy_decompress(&cinfo);
+        return ESP_FAIL;
+    }
+    jpeg_create_decompress(&cinfo);
+
+    source.base.init_source = initSource;
+    source.base.fill_input_buffer = fillInput;
+    source.base.skip_input_data = skipInput;
+    source.base.resync_to_restart = jpeg_resync_to_restart;
+    source.base.term_source = termSource;
+    source.base.bytes_in_buffer = 0;
+    source.base.next_input_byte = nullptr;
+    source.reader = reader;
+    source.arg = arg;
+    source.index = 0;
+    source.len = len;
+    cinfo.src = &source.base;
+
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.out_color_space = JCS_RGB;
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = 1 << scale;
+    jpeg_start_decompress(&cinfo);
+
+    const uint16_t width = cinfo.output_width;
+    const uint16_t height = cinfo.output_height;
+    // an MCU row of the scaled image
+    const size_t mcuRows = std::min<size_t>(JPG_MAX_BLOCK_ROWS, std::max<size_t>(1, cinfo.max_v_samp_factor * DCTSIZE / cinfo.scale_denom));
+    const size_t stride = static_cast<size_t>(width) * 3;
+    JSAMPLE* block = static_cast<JSAMPLE*>((*cinfo.mem->alloc_large)(reinterpret_cast<j_common_ptr>(&cinfo), JPOOL_IMAGE, mcuRows * stride));
+    JSAMPROW rows[JPG_MAX_BLOCK_ROWS];
+
+    bool ok = writer(arg, 0, 0, width, height, nullptr);
+    while (ok && cinfo.output_scanline < height) {
+        const uint16_t y = cinfo.output_scanline;
+        const size_t count = std::min<size_t>(mcuRows, height - y);
+        for (size_t r = 0; r < count; ++r)
+            rows[r] = block + r * stride;
+        while (cinfo.output_scanline < y + count)
+            jpeg_read_scanlines(&cinfo, rows + (cinfo.output_scanline - y), count - (cinfo.output_scanline - y));
+        ok = writer(arg, 0, y, width, count, block);
+    }
+    if (ok) {
+        jpeg_finish_decompress(&cinfo);
+        ok = writer(arg, width, height, 0, 0, nullptr);
+    } else {
+        jpeg_abort_decompress(&cinfo);
+    }
+    jpeg_destroy_decompress(&cinfo);
+    return ok ? ESP_OK : ESP_FAIL;
+}
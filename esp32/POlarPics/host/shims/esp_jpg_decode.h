@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_err.h"
+
+// Host stand-in for the JPEG decoder of esp32-camera (TJpgDec in ROM), on libjpeg with the same callbacks:
+// the writer gets a start call (x = y = 0, w x h the scaled image, no data), RGB888 blocks left to right and top to bottom,
+// then an end call without data. The blocks here are whole scaled MCU rows, x is always 0.
+
+typedef enum {
+    JPG_SCALE_NONE,
+    JPG_SCALE_2X,
+    JPG_SCALE_4X,
+    JPG_SCALE_8X,
+    JPG_SCALE_MAX = JPG_SCALE_8X
+} jpg_scale_t;
+
+// bytes [index, index + len) of the JPEG into buf (nullptr skips them), returns the count read
+typedef size_t (*jpg_reader_cb)(void* arg, size_t index, uint8_t* buf, size_t len);
+// returns false to stop the decode
+typedef bool (*jpg_writer_cb)(void* arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t* data);
+
+esp_err_t esp_jpg_decode(size_t len, jpg_scale_t scale, jpg_reader_cb reader, jpg_writer_cb writer, void* arg);
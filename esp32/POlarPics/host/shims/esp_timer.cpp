@@ -0,0 +1,5 @@
+#include "esp_timer.h"
+
+#include "Task.h"
+
+int64_t esp_timer_get_time() { return pipeline::nowUs(); }
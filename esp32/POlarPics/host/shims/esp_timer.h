@@ -0,0 +1,6 @@
+#pragma once
+
+#include <cstdint>
+
+// Host stand-in for the ESP-IDF high resolution timer: microseconds on the steady clock, same clock as pipeline::nowUs()
+int64_t esp_timer_get_time();
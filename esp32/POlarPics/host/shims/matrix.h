@@ -0,0 +1,4 @@
+#pragma once
+
+// src/utils.hpp includes <matrix.h>, which only resolves to lib/Matrix/Matrix.h on a case insensitive file system
+#include "Matrix.h"
@@ -0,0 +1,124 @@
+// Zero allocation steady state of the preview, on the host: stored JPEGs replayed by the camera stand-in
+// (host/shims/camera_replay.h) go through the preview module of the firmware (src/preview.hpp), capture -> decode on a
+// capture thread, then dither -> display -> governor on the main thread. Both threads are watched by AllocGuard, the
+// module arms it after ALLOC_GUARD_WARMUP_FRAMES frames at a stable level like on the device: any allocation after that
+// aborts the test. The menu is drawn while armed as well, the device only arms in the preview.
+//   allocGuardTest [-n <frames>] [-a] <frame.jpg>...    -a allocates a Matrix once armed, passes when the guard aborts
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+
+#include "AllocGuard.h"
+#include "Matrix.h"
+#include "Signal.h"
+#include "Task.h"
+#include "camera_replay.h"
+#include "capture.hpp"
+#include "jpeg.hpp"
+#include "menu.hpp"
+#include "preview.hpp"
+#include "utils.hpp"
+
+#include "check.h"
+
+#define TEST_DEFAULT_FRAMES 300
+#define TEST_MIN_ARMED_FRAMES 100 // the governor has to settle well before the end of the run
+#define TEST_MENU_DRAWS 20
+
+TEST_MAIN_STATE;
+
+namespace {
+
+    pipeline::Signal loopWake;
+    std::atomic<bool> stopCapture {false};
+    std::atomic<bool> captureStopped {false};
+
+    // captureTask of src/main.cpp without the print captures
+    void captureTask(void*) {
+        allocguard::watchCurrentTask();
+
+        capture::Frame jpeg;
+        jpeg::GrayDecoder decoder {memory::EOwner::decode};
+        while (!stopCapture.load())
+            if (!preview::captureNext(jpeg, decoder)) pipeline::sleepMs(1);
+        captureStopped = true;
+    }
+
+    void drawPreview(const PrinterMatrix& dithered, const size_t displayScale, void* arg) {
+        utils::drawGrayScale(*static_cast<TFT_eSPI*>(arg), 0, 0, dithered, displayScale);
+    }
+
+    // -a: the abort of the guard is the expected outcome
+    void guardTripped(int) { std::_Exit(0); }
+
+    void usage() {
+        std::printf("allocGuardTest [-n <frames>] [-a] <frame.jpg>...\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t frames = TEST_DEFAULT_FRAMES;
+    bool allocateArmed = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "hn:a")) != -1) {
+        switch (opt) {
+            case 'n': frames = std::max(1, std::atoi(optarg)); break;
+            case 'a': allocateArmed = true; break;
+            case 'h': usage(); return 0;
+            default: usage(); return 2;
+        }
+    }
+    if (optind >= argc) { usage(); return 2; }
+
+    if (!CHECK(replay::load(argv + optind, argc - optind))) return test::testResult();
+    if (allocateArmed) std::signal(SIGABRT, guardTripped);
+
+    // setup() of src/main.cpp
+    capture::init(esp_camera_sensor_get(), preview::framesize());
+    preview::init(&loopWake);
+    TFT_eSPI tft;
+    const menu::OptionsValuesIdx menuValues {};
+
+    allocguard::watchCurrentTask();
+    CHECK(pipeline::startTask("capture", captureTask, nullptr, 8192, 1, 0));
+
+    // updatePreview of src/main.cpp in the preview state
+    size_t armedFrames = 0;
+    for (size_t i = 0; i < frames;) {
+        if (!preview::update(drawPreview, &tft, true)) {
+            loopWake.wait(100);
+            continue;
+        }
+        ++i;
+
+        if (allocguard::armed()) {
+            ++armedFrames;
+            if (allocateArmed) {
+                const governor::QualityLevel& level = preview::governorState().level();
+                Matrix<uint8_t> regression(level.width, level.height, memory::EOwner::frame);
+            }
+        }
+    }
+
+    const bool armed = allocguard::armed();
+    for (size_t i = 0; armed && i < TEST_MENU_DRAWS; ++i)
+        menu::drawMenu(tft, i % CAM_OPTIONS_COUNT, i % 2 == 1, menuValues);
+
+    allocguard::disarm();
+    stopCapture = true;
+    while (!captureStopped.load()) pipeline::sleepMs(1);
+
+    std::printf("%zu frames of %zu files, %zu after the warm-up at level %zu (%zux%zu), %zu pixels drawn\n", frames,
+        replay::frameCount(), armedFrames, preview::governorState().levelIndex(), preview::governorState().level().width,
+        preview::governorState().level().height,
+        tft.pixels());
+    CHECK(armed);
+    CHECK(armedFrames >= std::min<size_t>(TEST_MIN_ARMED_FRAMES, frames / 2));
+    CHECK(allocguard::violations() == 0);
+    CHECK(tft.pixels() > 0);
+    CHECK(!allocateArmed); // the guard let the allocation through
+    return test::testResult();
+}
@@ -0,0 +1,171 @@
+// Replays recorded ADC traces of the button ladder through buttons::Debouncer and compares the events with the ones
+// the trace expects. Each trace also goes through buttons::Recorder, the record mode of the sampler: its dump has to be
+// a trace which replays to the events it lists. Trace format (host/test/data/buttons, see lib/buttons/buttons.h):
+//   # free comment
+//   #> <time us>,<button>,<kind>     expected event, buttons::buttonToString / eventKindToString names
+//   time_us,adc                      header, then one "<time us>,<adc>" sample per line
+//   buttonsTest <trace.csv>...
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "buttons.h"
+
+#include "check.h"
+
+TEST_MAIN_STATE;
+
+namespace {
+
+    struct Trace {
+        std::vector<std::pair<int64_t, uint16_t>> samples;
+        std::vector<buttons::Event> expected;
+    };
+
+    bool parseButton(const std::string& name, buttons::EButton& button) {
+        for (int b = buttons::buttonNone; b < buttons::buttonCount; ++b) {
+            if (name == buttons::buttonToString(static_cast<buttons::EButton>(b))) {
+                button = static_cast<buttons::EButton>(b);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool parseKind(const std::string& name, buttons::EEventKind& kind) {
+        for (const buttons::EEventKind k : {buttons::EEventKind::press, buttons::EEventKind::repeat, buttons::EEventKind::longPress,
+                buttons::EEventKind::release}) {
+            if (name == buttons::eventKindToString(k)) {
+                kind = k;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // keeps what a Recorder dumps
+    class StringPrint : public Print {
+    public:
+        std::string text;
+
+        size_t write(uint8_t byte) override {
+            text.push_back(static_cast<char>(byte));
+            return 1;
+        }
+    };
+
+    bool load(std::FILE* file, const char* path, Trace& trace) {
+        char line[256];
+        size_t lineNumber = 0;
+        bool ok = true;
+        while (ok && std::fgets(line, sizeof(line), file) != nullptr) {
+            ++lineNumber;
+            const size_t length = std::strcspn(line, "\r\n");
+            if (line[length] == '\0' && !std::feof(file)) { // longer than the buffer
+                ok = false;
+                break;
+            }
+            line[length] = '\0';
+            if (std::strncmp(line, "#>", 2) == 0) {
+                long long timeUs = 0;
+                char button[16] = "";
+                char kind[16] = "";
+                buttons::Event event;
+                ok = std::sscanf(line + 2, " %lld,%15[^,],%15[^\n]", &timeUs, button, kind) == 3 &&
+                    parseButton(button, event.button) && parseKind(kind, event.kind);
+                event.timeUs = timeUs;
+                if (ok) trace.expected.push_back(event);
+            } else if (line[0] != '#' && line[0] != '\0' && std::strcmp(line, "time_us,adc") != 0) {
+                long long timeUs = 0;
+                unsigned adc = 0;
+                ok = std::sscanf(line, "%lld,%u", &timeUs, &adc) == 2 && adc <= 4095;
+                if (ok) trace.samples.emplace_back(timeUs, static_cast<uint16_t>(adc));
+            }
+        }
+        if (!ok) std::fprintf(stderr, "%s:%zu: invalid line\n", path, lineNumber);
+        return ok;
+    }
+
+    bool load(const char* path, Trace& trace) {
+        std::FILE* file = std::fopen(path, "r");
+        if (file == nullptr) {
+            std::fprintf(stderr, "can't open %s\n", path);
+            return false;
+        }
+        const bool ok = load(file, path, trace);
+        std::fclose(file);
+        return ok;
+    }
+
+    std::vector<buttons::Event> replay(const Trace& trace, buttons::Recorder* recorder) {
+        buttons::Debouncer debouncer(buttons::defaultTiming);
+        std::vector<buttons::Event> events;
+        buttons::Event emitted[buttons::Debouncer::maxEventsPerSample];
+        for (const auto& sample : trace.samples) {
+            const size_t count = debouncer.update(sample.second, sample.first, emitted);
+            events.insert(events.end(), emitted, emitted + count);
+            if (recorder != nullptr) recorder->add(sample.second, sample.first, emitted, count);
+        }
+        CHECK(debouncer.held() == buttons::buttonNone); // every trace ends released
+        return events;
+    }
+
+    void print(const char* prefix, const buttons::Event& event) {
+        std::fprintf(stderr, "  %s %lld %s %s\n", prefix, static_cast<long long>(event.timeUs), buttons::buttonToString(event.button),
+            buttons::eventKindToString(event.kind));
+    }
+
+    bool sameEvent(const buttons::Event& a, const buttons::Event& b) {
+        return a.button == b.button && a.kind == b.kind && a.timeUs == b.timeUs;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::printf("buttonsTest <trace.csv>...\n");
+        return 2;
+    }
+
+    size_t kinds[4] = {0, 0, 0, 0}; // events seen by kind over every trace
+    for (int i = 1; i < argc; ++i) {
+        Trace trace;
+        if (!CHECK(load(argv[i], trace))) continue;
+        CHECK(!trace.samples.empty());
+
+        static buttons::Recorder recorder; // 8 KB of samples
+        const std::vector<buttons::Event> events = replay(trace, &recorder);
+
+        bool same = events.size() == trace.expected.size();
+        for (size_t e = 0; same && e < events.size(); ++e) same = sameEvent(events[e], trace.expected[e]);
+        if (!CHECK(same)) {
+            std::fprintf(stderr, "%s: events differ\n", argv[i]);
+            for (const buttons::Event& event : trace.expected) print("expected", event);
+            for (const buttons::Event& event : events) print("got     ", event);
+        }
+        for (const buttons::Event& event : events) ++kinds[static_cast<size_t>(event.kind)];
+
+        // the take ends once the ladder is idle or with the trace
+        StringPrint dump;
+        recorder.dump(dump, "recorded by buttonsTest");
+        Trace recorded;
+        std::FILE* file = fmemopen(&dump.text[0], dump.text.size(), "r");
+        if (!CHECK(file != nullptr && load(file, "recording", recorded))) continue;
+        std::fclose(file);
+        const std::vector<buttons::Event> replayed = replay(recorded, nullptr);
+        CHECK(!recorded.expected.empty() && recorded.samples.front().first == 0);
+        same = replayed.size() == recorded.expected.size();
+        for (size_t e = 0; same && e < replayed.size(); ++e) same = sameEvent(replayed[e], recorded.expected[e]);
+        if (!CHECK(same)) std::fprintf(stderr, "%s: the recording doesn't replay to its events\n%s", argv[i], dump.text.c_str());
+        std::printf("%s: %zu samples, %zu events, recorded %zu samples, %zu events\n", argv[i], trace.samples.size(), events.size(),
+            recorded.samples.size(), recorded.expected.size());
+    }
+
+    // the traces have to exercise the whole state machine
+    CHECK(kinds[static_cast<size_t>(buttons::EEventKind::press)] > 0);
+    CHECK(kinds[static_cast<size_t>(buttons::EEventKind::repeat)] > 0);
+    CHECK(kinds[static_cast<size_t>(buttons::EEventKind::longPress)] > 0);
+    CHECK(kinds[static_cast<size_t>(buttons::EEventKind::release)] > 0);
+    return test::testResult();
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdio>
+
+// Minimal assertions for the host tests: a failed check is reported and the test keeps going, main returns testResult()
+namespace test {
+
+extern int failures;
+
+inline bool check(const bool condition, const char* expression, const char* file, const int line) {
+    if (!condition) {
+        std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+        ++failures;
+    }
+    return condition;
+}
+
+inline int testResult() {
+    if (failures > 0) std::fprintf(stderr, "%d check(s) failed\n", failures);
+    return failures > 0 ? 1 : 0;
+}
+
+}// namespace test
+
+#define CHECK(condition) test::check((condition), #condition, __FILE__, __LINE__)
+#define TEST_MAIN_STATE int test::failures = 0
@@ -0,0 +1,125 @@
+// Governor::update driven with synthetic stage times: settle frames, step-down, step-up, hysteresis and the level it
+// converges to when the frame cost follows the model of governor::predict, on the preview ladder of src/main.cpp.
+#include <cstdio>
+
+#include "governor.h"
+#include "previewLevels.hpp"
+
+#include "check.h"
+
+TEST_MAIN_STATE;
+
+namespace {
+
+    const governor::QualityLevel* levels = previewLevels;
+    const size_t levelCount = PREVIEW_LEVEL_COUNT;
+    const float targetFps = PREVIEW_TARGET_FPS;
+    const int64_t targetUs = 125000;
+
+    typedef governor::Governor G;
+
+    // per stage cost of the cheapest level, in us, the other levels follow governor::predict
+    governor::StageTimes baseTimes(const int64_t scale) {
+        governor::StageTimes t;
+        t.us[governor::stageCapture] = 400 * scale;
+        t.us[governor::stageDecode] = 900 * scale;
+        t.us[governor::stageGrayscale] = 0;
+        t.us[governor::stageDither] = 700 * scale;
+        t.us[governor::stageDisplay] = 1000 * scale;
+        return t;
+    }
+
+    governor::StageTimes timesAt(const size_t level, const int64_t scale) {
+        return governor::predict(baseTimes(scale), levels[0], levels[level]);
+    }
+
+    // same total for every level
+    governor::StageTimes flat(const int64_t totalUs) {
+        governor::StageTimes t;
+        t.us[governor::stageDecode] = totalUs;
+        return t;
+    }
+
+    void settleFramesAreIgnored() {
+        G g(levels, levelCount, targetFps, levelCount - 1);
+        for (size_t i = 0; i < G::settleFrames; ++i) {
+            CHECK(!g.update(flat(10 * targetUs)));
+            CHECK(g.average().total() == 10 * targetUs); // the average restarts from the last frame
+        }
+        CHECK(g.levelIndex() == levelCount - 1);
+    }
+
+    void stepsDownWhenTooSlow() {
+        G g(levels, levelCount, targetFps, levelCount - 1);
+        const governor::StageTimes slow = flat(targetUs * G::slowMargin / 100 + 1000);
+        size_t frames = 0;
+        while (!g.update(slow) && frames < 100) ++frames;
+        CHECK(frames + 1 == G::settleFrames + G::slowFramesToStepDown);
+        CHECK(g.levelIndex() == levelCount - 2);
+
+        // a new level settles again before it can be judged
+        for (size_t i = 0; i < G::settleFrames + G::slowFramesToStepDown - 1; ++i) CHECK(!g.update(slow));
+        CHECK(g.update(slow));
+        CHECK(g.levelIndex() == levelCount - 3);
+
+        // never below the first level
+        G cheapest(levels, levelCount, targetFps, 0);
+        for (size_t i = 0; i < 50; ++i) CHECK(!cheapest.update(slow));
+        CHECK(cheapest.levelIndex() == 0);
+    }
+
+    void stepsUpWithHeadroom() {
+        G g(levels, levelCount, targetFps, 0);
+        const governor::StageTimes fast = flat(1000);
+        size_t frames = 0;
+        while (!g.update(fast) && frames < 100) ++frames;
+        CHECK(frames + 1 == G::settleFrames + G::fastFramesToStepUp);
+        CHECK(g.levelIndex() == 1);
+
+        // never above the last level
+        G best(levels, levelCount, targetFps, levelCount - 1);
+        for (size_t i = 0; i < 50; ++i) CHECK(!best.update(fast));
+        CHECK(best.levelIndex() == levelCount - 1);
+    }
+
+    void holdsBetweenTheMargins() {
+        // fast enough for its level, the next one is predicted above the headroom margin
+        G g(levels, levelCount, targetFps, levelCount - 2);
+        const governor::StageTimes times = flat(targetUs);
+        CHECK(governor::predict(times, levels[levelCount - 2], levels[levelCount - 1]).total() * 100 >= targetUs * G::headroomMargin);
+        for (size_t i = 0; i < 200; ++i) CHECK(!g.update(times));
+        CHECK(g.levelIndex() == levelCount - 2);
+
+        // one slow frame among fast ones does not step down
+        G h(levels, levelCount, targetFps, 2);
+        for (size_t i = 0; i < 50; ++i) {
+            CHECK(!h.update(flat(i % 5 == 4 ? 2 * targetUs : targetUs / 2 + 20000)));
+        }
+        CHECK(h.levelIndex() == 2);
+    }
+
+    // Starting from the cheapest level, the governor climbs to the best level predicted under the headroom margin and stays there
+    void convergesWithoutOscillating(const int64_t scale) {
+        size_t expected = 0;
+        while (expected + 1 < levelCount && timesAt(expected + 1, scale).total() * 100 < targetUs * G::headroomMargin) ++expected;
+
+        G g(levels, levelCount, targetFps, 0);
+        size_t changes = 0;
+        for (size_t i = 0; i < 500; ++i) {
+            if (g.update(timesAt(g.levelIndex(), scale))) ++changes;
+        }
+        std::printf("scale %lld: level %zu (expected %zu) after %zu changes, %lld us per frame\n", static_cast<long long>(scale),
+            g.levelIndex(), expected, changes, static_cast<long long>(timesAt(g.levelIndex(), scale).total()));
+        CHECK(g.levelIndex() == expected);
+        CHECK(changes == expected);
+    }
+}
+
+int main() {
+    settleFramesAreIgnored();
+    stepsDownWhenTooSlow();
+    stepsUpWithHeadroom();
+    holdsBetweenTheMargins();
+    for (const int64_t scale : {1, 4, 10, 30, 60}) convergesWithoutOscillating(scale);
+    return test::testResult();
+}
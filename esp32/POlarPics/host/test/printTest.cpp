@@ -0,0 +1,185 @@
+// Print path of the firmware on the host: a test pattern goes through printing::StreamWriter, the print task, the band
+// encoder (blank rows as paper feeds, rows trimmed of their blank bytes) and thermal::RasterPrinter into a byte buffer,
+// archived to a gallery directory on the way. tools/printerEmulator.py renders the buffer: its PBM has to hold the archived
+// dots and its modelled print time has to match the burn time RasterPrinter::dotLineUs gives for those rows.
+// With -p the bytes also go to a port through the UART stand-in (host/shims/HardwareSerial.h), e.g. the pseudo terminal of
+// the emulator (test/ptyPrint.sh), and -r waits for the PBM it renders.
+//   printTest [-e <printerEmulator.py>] [-y <python>] [-p <port> [-r <rendered pbm>]]    without -e nor -r only the firmware side runs
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+#include "HardwareSerial.h"
+#include "RasterPrinter.h"
+#include "Task.h"
+#include "gallery.hpp"
+#include "printing.hpp"
+
+#include "check.h"
+
+#define TEST_BAUD 2000000 // fast enough for the rows never to wait on the wire, the model is then the burn time alone
+#define TEST_HEIGHT 240
+#define TEST_GALLERY "printTestGallery"
+#define TEST_BYTES "printTest.bin"
+#define TEST_RENDER "printTest.pbm"
+#define TEST_TIME_TOLERANCE 0.01 // relative, the emulator also counts the wire time of the setup bytes
+#define TEST_RENDER_WAIT_MS 10000 // the emulator renders a pseudo terminal job once the line is idle
+
+TEST_MAIN_STATE;
+
+namespace {
+
+    // keeps what the print task sends, then forwards it to the port if there is one
+    class BufferPrint : public Print {
+    public:
+        std::vector<uint8_t> bytes;
+        Print* out = nullptr;
+
+        size_t write(uint8_t byte) override { return write(&byte, 1); }
+        size_t write(const uint8_t* data, size_t size) override {
+            bytes.insert(bytes.end(), data, data + size);
+            return out != nullptr ? out->write(data, size) : size;
+        }
+    };
+
+    // white band (paper feeds), gradient on the left half only (trimmed rows), then a full width ramp to black
+    void patternRow(const size_t r, uint8_t* row) {
+        for (size_t c = 0; c < PRINTER_WIDTH; ++c) {
+            if (r < 48) row[c] = 255;
+            else if (r < 144) row[c] = c < PRINTER_WIDTH / 2 ? static_cast<uint8_t>(c * 255 / (PRINTER_WIDTH / 2 - 1)) : 255;
+            else row[c] = static_cast<uint8_t>((TEST_HEIGHT - 1 - r) * 255 / (TEST_HEIGHT - 145));
+        }
+    }
+
+    bool writeFile(const char* path, const std::vector<uint8_t>& bytes) {
+        std::FILE* file = std::fopen(path, "wb");
+        if (file == nullptr) return false;
+        const bool written = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+        return std::fclose(file) == 0 && written;
+    }
+
+    // P4 body of the emulator render, false when the header isn't width x height
+    bool readPbm(const char* path, const size_t width, const size_t height, std::vector<uint8_t>& rows) {
+        std::FILE* file = std::fopen(path, "rb");
+        if (file == nullptr) return false;
+        size_t w = 0, h = 0;
+        const bool header = std::fscanf(file, "P4 %zu %zu", &w, &h) == 2 && std::fgetc(file) == '\n';
+        rows.resize((width + 7) / 8 * height);
+        const bool read = header && w == width && h == height && std::fread(rows.data(), 1, rows.size(), file) == rows.size();
+        std::fclose(file);
+        return read;
+    }
+
+    // runs the emulator on the byte file, returns its modelled print time in us (negative on failure)
+    double runEmulator(const std::string& python, const std::string& script) {
+        const std::string command = python + " '" + script + "' -i " TEST_BYTES " -o " TEST_RENDER " -b " + std::to_string(TEST_BAUD);
+        std::FILE* out = popen(command.c_str(), "r");
+        if (out == nullptr) return -1;
+        double printS = -1;
+        char line[256];
+        while (std::fgets(line, sizeof(line), out) != nullptr) {
+            std::fputs(line, stdout);
+            std::sscanf(line, "modeled print time: %lf s", &printS);
+        }
+        return pclose(out) == 0 ? printS * 1e6 : -1;
+    }
+
+    void usage() {
+        std::printf("printTest [-e <printerEmulator.py>] [-y <python>] [-p <port> [-r <rendered pbm>]]\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    std::string emulator;
+    std::string python = "python3";
+    const char* port = nullptr;
+    const char* portRender = nullptr;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "he:y:p:r:")) != -1) {
+        switch (opt) {
+            case 'e': emulator = optarg; break;
+            case 'y': python = optarg; break;
+            case 'p': port = optarg; break;
+            case 'r': portRender = optarg; break;
+            case 'h': usage(); return 0;
+            default: usage(); return 2;
+        }
+    }
+
+    thermal::PrinterSettings settings = thermal::defaultSettings;
+    settings.baud = TEST_BAUD;
+    BufferPrint printer;
+    HardwareSerial serial;
+    if (port != nullptr) {
+        if (!CHECK(serial.open(port, settings.baud))) return test::testResult();
+        printer.out = &serial;
+    }
+
+    // setup() of src/main.cpp
+    if (!CHECK(gallery::init(TEST_GALLERY))) return test::testResult();
+    const size_t entries = gallery::count();
+    if (!CHECK(printing::init(printer, settings))) return test::testResult();
+
+    // advanceCapturedPrint() of src/main.cpp, a row whenever a band is free
+    printing::StreamWriter stream;
+    CHECK(stream.open(PRINTER_WIDTH, 0.5f, filtering::EFilteringMethod::floydSteinberg, true));
+    std::vector<uint8_t> row(PRINTER_WIDTH);
+    for (size_t r = 0; r < TEST_HEIGHT; ++r) {
+        patternRow(r, row.data());
+        while (!stream.writeRow(row.data())) pipeline::sleepMs(1);
+    }
+    while (!stream.close()) pipeline::sleepMs(1);
+    while (printing::busy()) pipeline::sleepMs(10);
+
+    // the archived entry is what the print task sent, in the thermal dot convention
+    gallery::Entry entry;
+    if (!CHECK(gallery::count() == entries + 1 && gallery::entry(entries, entry))) return test::testResult();
+    CHECK(entry.width == PRINTER_WIDTH && entry.height == TEST_HEIGHT);
+    const size_t rowBytes = PRINTER_WIDTH / 8;
+    std::vector<uint8_t> dots(rowBytes * TEST_HEIGHT);
+    gallery::Reader reader;
+    CHECK(reader.open(entry.id) && reader.readRows(dots.data(), TEST_HEIGHT));
+
+    // burn time of the rows, blank ones are paper feeds
+    const thermal::RasterPrinter model(printer, settings);
+    double burnUs = 0;
+    size_t blankRows = 0;
+    for (size_t r = 0; r < TEST_HEIGHT; ++r) {
+        const uint8_t* dotRow = dots.data() + r * rowBytes;
+        const bool blank = std::all_of(dotRow, dotRow + rowBytes, [](const uint8_t b) { return b == 0; });
+        blankRows += blank;
+        burnUs += blank ? settings.feedUs : model.dotLineUs(dotRow, rowBytes);
+    }
+    const size_t rawBytes = rowBytes * (TEST_HEIGHT - blankRows);
+    std::printf("%zu bytes sent for %zu rows (%zu blank), %zu bytes of raw rows, burn time %.0f us\n", printer.bytes.size(),
+        static_cast<size_t>(TEST_HEIGHT), blankRows, rawBytes, burnUs);
+    CHECK(blankRows >= 48);
+    CHECK(printer.bytes.size() < rawBytes); // the trimmed half width rows make up for the command headers
+
+    if (!CHECK(writeFile(TEST_BYTES, printer.bytes))) return test::testResult();
+
+    std::vector<uint8_t> rendered;
+    if (portRender != nullptr) {
+        serial.flush();
+        // a partly written file fails the read, retried until the whole render is there
+        bool read = false;
+        for (size_t waitedMs = 0; !read && waitedMs < TEST_RENDER_WAIT_MS; waitedMs += 100) {
+            pipeline::sleepMs(100);
+            read = readPbm(portRender, PRINTER_WIDTH, TEST_HEIGHT, rendered);
+        }
+        if (CHECK(read)) CHECK(rendered == dots);
+    }
+    if (emulator.empty()) return test::testResult();
+
+    const double modelledUs = runEmulator(python, emulator);
+    if (CHECK(modelledUs > 0) && CHECK(readPbm(TEST_RENDER, PRINTER_WIDTH, TEST_HEIGHT, rendered)))
+        CHECK(rendered == dots);
+    CHECK(std::fabs(modelledUs - burnUs) <= TEST_TIME_TOLERANCE * burnUs);
+    return test::testResult();
+}
@@ -0,0 +1,31 @@
+#!/bin/sh
+# End to end print on Linux: tools/printerEmulator.py serves a pseudo terminal, printTest prints through the UART stand-in
+# (host/shims/HardwareSerial.h) into it and compares the PBM the emulator renders once the line is idle with its own dots.
+#   ptyPrint.sh <printTest> <printerEmulator.py> [<python>]
+set -e
+printTest=$1
+emulator=$2
+python=${3:-python3}
+log=ptyPrint.log
+
+rm -f ptyPrint000.pbm
+"$python" -u "$emulator" -o ptyPrint -b 2000000 --idle 1 > "$log" &
+pid=$!
+trap 'kill $pid 2>/dev/null' EXIT
+
+# the emulator prints the path of its pseudo terminal first
+port=
+for i in $(seq 50); do
+    port=$(sed -n 's/^printer emulator listening on //p' "$log")
+    [ -n "$port" ] && break
+    sleep 0.1
+done
+if [ -z "$port" ]; then
+    echo "ptyPrint.sh: the emulator did not start" >&2
+    exit 1
+fi
+
+status=0
+"$printTest" -p "$port" -r ptyPrint000.pbm || status=$?
+cat "$log"
+exit $status
@@ -0,0 +1,89 @@
+// trace ring on the host: span and counter order in snapshot, the recorded count across the ring wrap and clear,
+// the CSV dump and the Chrome trace JSON markers.
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "trace.h"
+
+#include "check.h"
+
+TEST_MAIN_STATE;
+
+namespace {
+
+    // whole content written to a temporary file by fn
+    template <typename Fn>
+    std::string capture(Fn fn) {
+        std::FILE* file = std::tmpfile();
+        if (file == nullptr) return "";
+        fn(file);
+        std::string out(static_cast<size_t>(std::ftell(file)), '\0');
+        std::rewind(file);
+        out.resize(std::fread(&out[0], 1, out.size(), file));
+        std::fclose(file);
+        return out;
+    }
+
+    size_t countOf(const std::string& text, const char* needle) {
+        size_t count = 0;
+        for (size_t at = text.find(needle); at != std::string::npos; at = text.find(needle, at + 1)) ++count;
+        return count;
+    }
+
+    trace::Event events[TRACE_RING_SIZE];
+}
+
+int main() {
+    // oldest first, spans and counters interleaved
+    trace::clear();
+    trace::record(trace::stageCapture, 100, 300, 1);
+    trace::sample(trace::counterReadyFrames, 2);
+    trace::record(trace::stageDither, 300, 700, 1);
+    CHECK(trace::recorded() == 3);
+    CHECK(trace::snapshot(events, TRACE_RING_SIZE) == 3);
+    CHECK(events[0].kind == trace::EEventKind::span && events[0].id == trace::stageCapture && events[0].value == 1);
+    CHECK(events[0].startUs == 100 && events[0].endUs == 300);
+    CHECK(events[1].kind == trace::EEventKind::counter && events[1].id == trace::counterReadyFrames && events[1].value == 2);
+    CHECK(events[2].id == trace::stageDither && events[2].endUs - events[2].startUs == 400);
+    // a shorter copy keeps the newest events
+    CHECK(trace::snapshot(events, 1) == 1 && events[0].id == trace::stageDither);
+
+    // the CSV only has the spans, the footer counts every event
+    const std::string csv = capture([](std::FILE* f) { trace::dump(f); });
+    CHECK(csv.find("stage,core,frame,start_us,end_us,duration_us\n") == 0);
+    CHECK(csv.find("capture,0,1,100,300,200\n") != std::string::npos);
+    CHECK(csv.find("dither,0,1,300,700,400\n") != std::string::npos);
+    CHECK(countOf(csv, "\n") == 4);
+    CHECK(csv.find("# 3 events, 3 recorded since the last clear") != std::string::npos);
+
+    const std::string json = capture([](std::FILE* f) { trace::exportChromeTrace(f); });
+    CHECK(json.find("\n# trace begin\n{") == 0);
+    CHECK(json.find("]}\n# trace end\n") != std::string::npos);
+    CHECK(countOf(json, "\"ph\":\"X\"") == 2);
+    CHECK(countOf(json, "\"ph\":\"C\"") == 1);
+    const std::string bare = capture([](std::FILE* f) { trace::exportChromeTrace(f, false); });
+    CHECK(bare.find("# trace") == std::string::npos);
+
+    // past the ring size: the oldest are overwritten, recorded keeps counting
+    trace::clear();
+    CHECK(trace::recorded() == 0 && trace::snapshot(events, TRACE_RING_SIZE) == 0);
+    const uint32_t total = TRACE_RING_SIZE + 10;
+    for (uint32_t i = 0; i < total; ++i) trace::record(trace::stageDecode, i, i + 1, i);
+    CHECK(trace::recorded() == total);
+    CHECK(trace::snapshot(events, TRACE_RING_SIZE) == TRACE_RING_SIZE);
+    CHECK(events[0].value == total - TRACE_RING_SIZE && events[TRACE_RING_SIZE - 1].value == total - 1);
+
+    // two producers, like the capture task and loop(): nothing lost from the count
+    trace::clear();
+    std::thread other([] { for (uint32_t i = 0; i < 1000; ++i) trace::record(trace::stagePrint, i, i, i); });
+    for (uint32_t i = 0; i < 1000; ++i) {
+        TRACE_SCOPE(stageMenu, i);
+    }
+    other.join();
+    CHECK(trace::recorded() == 2000);
+    CHECK(std::strcmp(trace::stageToString(trace::stageMenu), "menu") == 0);
+
+    return test::testResult();
+}
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "esp32-hal.h" // used to allow ps_malloc
+#include "MemoryAccounting.h"
 
 #include <algorithm>
 #include <functional>
+#include <stdexcept>
 
 struct PIXELFORMAT_RGB {
     uint8_t r;
@@ -18,29 +20,31 @@ private:
     size_t cols_;
 	size_t rows_;
 	T* data_;
+    memory::EOwner owner_; // the buffer is accounted to it
+
+    inline void release() { memory::release(data_, len() * sizeof(T), owner_); }
 	
 public:
-	Matrix() : cols_{0}, rows_{0}, data_{nullptr} {}
+	explicit Matrix(const memory::EOwner owner = memory::EOwner::unknown) : cols_{0}, rows_{0}, data_{nullptr}, owner_{owner} {}
 
-	Matrix(size_t c, size_t r) : cols_{c}, rows_{r} {
-        data_ = (T*) ps_malloc(cols_ * rows_ * sizeof(T));
+	Matrix(size_t c, size_t r, const memory::EOwner owner = memory::EOwner::unknown) : cols_{c}, rows_{r}, owner_{owner} {
+        data_ = (T*) memory::allocate(cols_ * rows_ * sizeof(T), owner_);
 	}
 
-	Matrix(size_t c, size_t r, T fillVal) : Matrix(c, r) {
+	Matrix(size_t c, size_t r, T fillVal, const memory::EOwner owner = memory::EOwner::unknown) : Matrix(c, r, owner) {
         std::fill(data_, data_ + rows_ * cols_, fillVal);
 	}
 
-	Matrix(const Matrix<T>& rhs) : Matrix(rhs.cols_, rhs.rows_) {
+	Matrix(const Matrix<T>& rhs) : Matrix(rhs.cols_, rhs.rows_, rhs.owner_) {
        std::copy(rhs.begin(), rhs.end(), data_);
 	}
 
-    Matrix(Matrix<T>&& mat) : cols_{mat.cols_}, rows_{mat.rows_}, data_{mat.data_} {
+    Matrix(Matrix<T>&& mat) : cols_{mat.cols_}, rows_{mat.rows_}, data_{mat.data_}, owner_{mat.owner_} {
         mat.data_ = nullptr;
     }
 
     ~Matrix() {
-        if(data_ != nullptr)
-            free(data_);
+        release();
     }
 
     // getters
@@ -49,6 +53,7 @@ public:
 	inline size_t width() const { return cols_; }
 	inline size_t height() const { return rows_; }
 	inline size_t len() const { return rows_ * cols_; }
+    inline memory::EOwner owner() const { return owner_; }
 
     T* begin() { return data_; }
     const T* begin() const { return data_; }
@@ -66,11 +71,10 @@ public:
     Matrix& operator=(const Matrix& rhs) {
         if (this != &rhs) {
             if(rhs.rows_ != rows_ || rhs.cols_ != cols_) {
-                if(data_ != nullptr)
-                    free(data_);
+                release();
                 rows_ = rhs.rows_;
                 cols_ = rhs.cols_;
-                data_ = (T*) ps_malloc(len() * sizeof(T));
+                data_ = (T*) memory::allocate(len() * sizeof(T), owner_);
             }
             
             std::copy(rhs.begin(), rhs.end(), begin());
@@ -80,10 +84,11 @@ public:
     
     Matrix& operator=(Matrix&& rhs) {
         if (this != &rhs) {
-            if(data_ != nullptr)
-                free(data_);
+            release();
 
+            // the buffer keeps the owner it was accounted to
             data_ = rhs.data_;
+            owner_ = rhs.owner_;
             rhs.data_ = nullptr;
             rows_ = rhs.rows_;
             rhs.rows_ = 0;
@@ -0,0 +1,159 @@
+#include "MemoryAccounting.h"
+
+#include "esp32-hal.h" // used to allow ps_malloc
+#include "esp32-hal-log.h"
+
+#ifdef ARDUINO
+#include "soc/soc.h"
+#endif
+
+#include <array>
+#include <atomic>
+
+namespace memory {
+
+const char* ownerToString(const EOwner owner) {
+    switch (owner) {
+        case EOwner::unknown: return "unknown";
+        case EOwner::frame: return "frame";
+        case EOwner::decode: return "decode";
+        case EOwner::dither: return "dither";
+        case EOwner::print: return "print";
+        case EOwner::menu: return "menu";
+        case EOwner::gol: return "gol";
+        case EOwner::server: return "server";
+        default: return "invalid";
+    }
+}
+
+const char* heapToString(const EHeap heap) {
+    switch (heap) {
+        case EHeap::internal: return "internal";
+        case EHeap::psram: return "psram";
+        default: return "invalid";
+    }
+}
+
+EHeap heapOf(const void* ptr) {
+#ifdef ARDUINO
+    const uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+    return address >= SOC_EXTRAM_DATA_LOW && address < SOC_EXTRAM_DATA_HIGH ? EHeap::psram : EHeap::internal;
+#else
+    (void)ptr;
+    return EHeap::internal;
+#endif
+}
+
+namespace {
+    const size_t ownerCount = static_cast<size_t>(EOwner::count);
+    const size_t heapCount = static_cast<size_t>(EHeap::count);
+
+    struct Counter {
+        std::atomic<size_t> current;
+        std::atomic<size_t> peak;
+        std::atomic<size_t> allocations;
+    };
+
+    // allocations come from several tasks, every counter is atomic
+    std::array<std::array<Counter, heapCount>, ownerCount> counters;
+    std::array<Counter, heapCount> totals;
+    std::array<std::atomic<size_t>, heapCount> alarmThresholds;
+    std::array<std::atomic<bool>, heapCount> alarmRaised;
+    std::atomic<size_t> alarmCount {0};
+
+    void updatePeak(std::atomic<size_t>& peak, const size_t value) {
+        size_t previous = peak.load(std::memory_order_relaxed);
+        while (value > previous && !peak.compare_exchange_weak(previous, value, std::memory_order_relaxed)) {}
+    }
+
+    size_t add(Counter& counter, const size_t bytes) {
+        const size_t current = counter.current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        updatePeak(counter.peak, current);
+        ++counter.allocations;
+        return current;
+    }
+
+    inline Usage toUsage(const Counter& counter) {
+        return Usage{counter.current.load(), counter.peak.load(), counter.allocations.load()};
+    }
+
+    void checkAlarm(const EHeap heap, const size_t total, const EOwner owner, const size_t bytes) {
+        const size_t h = static_cast<size_t>(heap);
+        const size_t threshold = alarmThresholds[h].load(std::memory_order_relaxed);
+        if (threshold == 0) return;
+
+        if (total <= threshold) {
+            alarmRaised[h] = false;
+            return;
+        }
+        if (alarmRaised[h].exchange(true)) return;
+
+        ++alarmCount;
+        log_w("memory: %s over budget (%zu > %zu bytes) after %zu bytes for %s", heapToString(heap), total, threshold, bytes, ownerToString(owner));
+        report();
+    }
+}
+
+void* allocate(const size_t bytes, const EOwner owner) {
+    void* ptr = ps_malloc(bytes);
+    if (ptr == nullptr) {
+        log_e("memory: %zu bytes for %s failed", bytes, ownerToString(owner));
+        return nullptr;
+    }
+
+    const EHeap heap = heapOf(ptr);
+    const size_t h = static_cast<size_t>(heap);
+    add(counters[static_cast<size_t>(owner)][h], bytes);
+    checkAlarm(heap, add(totals[h], bytes), owner, bytes);
+    return ptr;
+}
+
+void release(void* ptr, const size_t bytes, const EOwner owner) {
+    if (ptr == nullptr) return;
+
+    const EHeap heap = heapOf(ptr);
+    const size_t h = static_cast<size_t>(heap);
+    counters[static_cast<size_t>(owner)][h].current -= bytes;
+    const size_t total = totals[h].current -= bytes;
+    free(ptr);
+
+    // re-arm the alarm once back under the threshold
+    if (total <= alarmThresholds[h].load(std::memory_order_relaxed)) alarmRaised[h] = false;
+}
+
+Usage usage(const EOwner owner, const EHeap heap) {
+    return toUsage(counters[static_cast<size_t>(owner)][static_cast<size_t>(heap)]);
+}
+
+Usage total(const EHeap heap) { return toUsage(totals[static_cast<size_t>(heap)]); }
+
+void setAlarm(const EHeap heap, const size_t thresholdBytes) {
+    alarmThresholds[static_cast<size_t>(heap)] = thresholdBytes;
+    alarmRaised[static_cast<size_t>(heap)] = false;
+}
+
+size_t alarms() { return alarmCount.load(); }
+
+void resetPeaks() {
+    for (auto& owner : counters) {
+        for (Counter& counter : owner) counter.peak = counter.current.load();
+    }
+    for (Counter& counter : totals) counter.peak = counter.current.load();
+}
+
+void report() {
+    log_d("----- Matrix memory (current / peak bytes) -----");
+    for (size_t h = 0; h < heapCount; ++h) {
+        const Usage heapTotal = toUsage(totals[h]);
+        if (heapTotal.peak == 0) continue;
+
+        log_d("%s -- total: %zu / %zu", heapToString(static_cast<EHeap>(h)), heapTotal.current, heapTotal.peak);
+        for (size_t o = 0; o < ownerCount; ++o) {
+            const Usage u = toUsage(counters[o][h]);
+            if (u.peak == 0) continue;
+            log_d("  %-8s %8zu / %8zu (%zu allocations)", ownerToString(static_cast<EOwner>(o)), u.current, u.peak, u.allocations);
+        }
+    }
+}
+
+}// namespace memory
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Per-owner accounting of the Matrix / PrinterMatrix buffers: current and peak bytes for each owner on each heap
+namespace memory {
+
+enum class EOwner : uint8_t {
+    unknown, // not tagged
+    frame, // preview frames
+    decode, // RGB decode buffers
+    dither, // dithered preview
+    print, // print capture, jobs and stream rows
+    menu,
+    gol,
+    server, // HTTP preview stream frames
+    count
+};
+
+enum class EHeap : uint8_t {
+    internal,
+    psram,
+    count
+};
+
+const char* ownerToString(const EOwner owner);
+const char* heapToString(const EHeap heap);
+// heap the address belongs to
+EHeap heapOf(const void* ptr);
+
+struct Usage {
+    size_t current;
+    size_t peak;
+    size_t allocations; // since boot
+};
+
+// ps_malloc (PSRAM when available, internal heap otherwise) accounted to owner, nullptr on failure
+void* allocate(const size_t bytes, const EOwner owner);
+// bytes and owner have to match the allocation
+void release(void* ptr, const size_t bytes, const EOwner owner);
+
+Usage usage(const EOwner owner, const EHeap heap);
+// every owner together, the peak is the peak of the sum
+Usage total(const EHeap heap);
+
+// Warn (with the report) when the accounted bytes on heap go above the threshold, 0 disables it.
+// The alarm fires once per crossing and names the owner of the allocation that crossed it.
+void setAlarm(const EHeap heap, const size_t thresholdBytes);
+size_t alarms();
+
+void resetPeaks();
+
+// log_d table of every owner with a non zero peak
+void report();
+
+}// namespace memory
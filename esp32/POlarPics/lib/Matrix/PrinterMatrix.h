@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esp32-hal.h" // used to allow ps_malloc
+#include "MemoryAccounting.h"
 
 #include <algorithm>
 #include <functional>
@@ -13,32 +14,37 @@ private:
     size_t size_; // internal size
 
 	uint8_t* data_;
+    memory::EOwner owner_; // the buffer is accounted to it
+
+    inline void release() { memory::release(data_, size_, owner_); }
 	
 public:
-	PrinterMatrix() : cols_{0}, rows_{0}, size_{0}, data_{nullptr} {}
+	explicit PrinterMatrix(const memory::EOwner owner = memory::EOwner::unknown) : cols_{0}, rows_{0}, size_{0}, data_{nullptr}, owner_{owner} {}
 
-	PrinterMatrix(size_t c, size_t r) : cols_{c}, rows_{r} {
+	PrinterMatrix(size_t c, size_t r, const memory::EOwner owner = memory::EOwner::unknown) : cols_{c}, rows_{r}, owner_{owner} {
         size_ = (cols_*rows_+7)/8;
-        data_ = (uint8_t*) ps_malloc(size_ * sizeof(uint8_t));
+        data_ = (uint8_t*) memory::allocate(size_ * sizeof(uint8_t), owner_);
 	}
 
-	PrinterMatrix(size_t c, size_t r, bool fillVal) : PrinterMatrix(c, r) {
+	PrinterMatrix(size_t c, size_t r, bool fillVal, const memory::EOwner owner = memory::EOwner::unknown) : PrinterMatrix(c, r, owner) {
         std::fill(data_, data_ + size_, fillVal ? 255 : 0);
 	}
 
-    PrinterMatrix(PrinterMatrix&& mat) : cols_{mat.cols_}, rows_{mat.rows_}, size_{mat.size_}, data_{mat.data_} {
+    PrinterMatrix(PrinterMatrix&& mat) : cols_{mat.cols_}, rows_{mat.rows_}, size_{mat.size_}, data_{mat.data_}, owner_{mat.owner_} {
         mat.data_ = nullptr;
     }
 
     ~PrinterMatrix() {
-        if(data_ != nullptr) free(data_);
+        release();
     }
 
     PrinterMatrix& operator=(PrinterMatrix&& rhs) {
         if (this != &rhs) {
-            if(data_ != nullptr) free(data_);
+            release();
 
+            // the buffer keeps the owner it was accounted to
             data_ = rhs.data_;
+            owner_ = rhs.owner_;
             rhs.data_ = nullptr;
             rows_ = rhs.rows_;
             rhs.rows_ = 0;
@@ -56,18 +62,19 @@ public:
 	inline size_t height() const { return rows_; }
 	inline size_t len() const { return cols_*  rows_; }
     inline size_t bufferSize() const { return size_; }
+    inline memory::EOwner owner() const { return owner_; }
 
     inline uint8_t& operator[](const size_t& id) { return data_[id]; }
     inline const uint8_t& operator[](const size_t& id) const { return data_[id]; }
 
     inline bool operator()(const size_t& r, const size_t& c) {
         const size_t id = r * cols_ + c;
-        return data_[id/8] >> (7-id%8) && 1;
+        return (data_[id/8] >> (7-id%8)) & 1;
     }
     
     inline bool operator()(const size_t& r, const size_t& c) const {
         const size_t id = r * cols_ + c;
-        return data_[id/8] >> (7-id%8) && 1;
+        return (data_[id/8] >> (7-id%8)) & 1;
     }
 
     inline void set(const size_t& r, const size_t& c, const bool value) {
@@ -0,0 +1,140 @@
+#include "AllocGuard.h"
+
+#ifdef POLARPICS_ALLOC_GUARD
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+
+#ifdef ARDUINO
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_rom_sys.h"
+#else
+#include <cstdio>
+#include <thread>
+#endif
+
+namespace allocguard {
+
+namespace {
+#ifdef ARDUINO
+    typedef TaskHandle_t TaskId;
+    inline TaskId currentTask() { return xTaskGetCurrentTaskHandle(); }
+#else
+    typedef std::thread::id TaskId;
+    inline TaskId currentTask() { return std::this_thread::get_id(); }
+#endif
+
+    struct WatchedTask {
+        TaskId id;
+        bool paused;
+    };
+
+    std::array<WatchedTask, ALLOC_GUARD_MAX_TASKS> tasks;
+    std::atomic<size_t> taskCount {0};
+    std::atomic<bool> isArmed {false};
+    std::atomic<size_t> violationCount {0};
+
+    WatchedTask* findCurrent() {
+        const TaskId id = currentTask();
+        const size_t count = taskCount.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i) {
+            if (tasks[i].id == id) return &tasks[i];
+        }
+        return nullptr;
+    }
+
+    // called from inside the allocator: no logging (it allocates), no allocation
+    void check(const size_t bytes, const char* function) {
+        if (!isArmed.load(std::memory_order_relaxed)) return;
+
+        WatchedTask* task = findCurrent();
+        if (task == nullptr || task->paused) return;
+
+        ++violationCount;
+#ifdef ARDUINO
+        esp_rom_printf("alloc guard: %s(%u) on task %s after warm-up\n", function, bytes, pcTaskGetName(nullptr));
+#else
+        std::fprintf(stderr, "alloc guard: %s(%zu) after warm-up\n", function, bytes);
+#endif
+        std::abort();
+    }
+}
+
+void watchCurrentTask() {
+    if (findCurrent() != nullptr) return;
+
+    // watched tasks are registered at startup, before arming, from one task at a time
+    const size_t count = taskCount.load();
+    if (count == ALLOC_GUARD_MAX_TASKS) std::abort();
+    tasks[count] = WatchedTask{currentTask(), false};
+    taskCount.store(count + 1, std::memory_order_release);
+}
+
+void arm() { isArmed = true; }
+
+void disarm() { isArmed = false; }
+
+bool armed() { return isArmed.load(); }
+
+size_t violations() { return violationCount.load(); }
+
+Pause::Pause() : wasPaused_{true} {
+    WatchedTask* task = findCurrent();
+    if (task == nullptr) return;
+    wasPaused_ = task->paused;
+    task->paused = true;
+}
+
+Pause::~Pause() {
+    WatchedTask* task = findCurrent();
+    if (task != nullptr) task->paused = wasPaused_;
+}
+
+}// namespace allocguard
+
+// linked with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=ps_malloc, see env:esp32cam-allocguard and host/CMakeLists.txt
+extern "C" {
+    void* __real_malloc(size_t size);
+    void* __real_calloc(size_t count, size_t size);
+    void* __real_realloc(void* ptr, size_t size);
+    void* __real_ps_malloc(size_t size);
+
+    void* __wrap_malloc(size_t size) {
+        allocguard::check(size, "malloc");
+        return __real_malloc(size);
+    }
+
+    void* __wrap_calloc(size_t count, size_t size) {
+        allocguard::check(count * size, "calloc");
+        return __real_calloc(count, size);
+    }
+
+    void* __wrap_realloc(void* ptr, size_t size) {
+        allocguard::check(size, "realloc");
+        return __real_realloc(ptr, size);
+    }
+
+    void* __wrap_ps_malloc(size_t size) {
+        allocguard::check(size, "ps_malloc");
+        return __real_ps_malloc(size);
+    }
+}
+
+#ifndef ARDUINO
+// the wrapping only reaches the objects linked statically, operator new of the shared libstdc++ calls the real malloc
+#include <new>
+
+void* operator new(size_t size) {
+    allocguard::check(size, "operator new");
+    void* ptr = std::malloc(size);
+    if (ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+#endif
+
+#endif // POLARPICS_ALLOC_GUARD
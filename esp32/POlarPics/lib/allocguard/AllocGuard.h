@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+
+// Steady state allocation guard, only compiled in with -DPOLARPICS_ALLOC_GUARD (env:esp32cam-allocguard, and the
+// allocGuardTest target of the host build on replayed frames).
+// malloc, calloc, realloc and ps_malloc are wrapped at link time (operator new ends up in malloc), once armed any
+// allocation from a watched task aborts with a backtrace pointing at the culprit.
+// Without the flag every function here is an empty inline.
+
+namespace allocguard {
+
+#define ALLOC_GUARD_MAX_TASKS 4
+#define ALLOC_GUARD_WARMUP_FRAMES 10 // preview frames after which nothing may allocate anymore
+
+#ifdef POLARPICS_ALLOC_GUARD
+
+// allocations of the calling task are checked while armed
+void watchCurrentTask();
+
+void arm();
+void disarm();
+bool armed();
+
+// allocations seen from watched tasks while armed
+size_t violations();
+
+// suspends the check on the calling task, for diagnostics which are allowed to allocate (log_d formatting)
+class Pause {
+private:
+    bool wasPaused_;
+
+public:
+    Pause();
+    ~Pause();
+
+    Pause(const Pause&) = delete;
+    Pause& operator=(const Pause&) = delete;
+};
+
+#else
+
+inline void watchCurrentTask() {}
+inline void arm() {}
+inline void disarm() {}
+inline bool armed() { return false; }
+inline size_t violations() { return 0; }
+
+class Pause {
+public:
+    Pause() {}
+    Pause(const Pause&) = delete;
+    Pause& operator=(const Pause&) = delete;
+};
+
+#endif
+
+}// namespace allocguard
@@ -0,0 +1,229 @@
+#include "buttons.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+
+#include "SpscRing.h"
+#include "Task.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+namespace buttons {
+
+const char* buttonToString(const EButton button) {
+    switch (button) {
+        case buttonNone: return "none";
+        case buttonEnter: return "enter";
+        case buttonBack: return "back";
+        case buttonLeft: return "left";
+        case buttonRight: return "right";
+        default: return "unknown";
+    }
+}
+
+const char* eventKindToString(const EEventKind kind) {
+    switch (kind) {
+        case EEventKind::press: return "press";
+        case EEventKind::repeat: return "repeat";
+        case EEventKind::longPress: return "long press";
+        case EEventKind::release: return "release";
+        default: return "unknown";
+    }
+}
+
+EButton classify(const uint16_t adc) {
+    // ADC readings of enter, back, left and right
+    static const int ladderValues[buttonCount - 1] = {730, 1360, 2500, 4050};
+
+    for (size_t i = 0; i < buttonCount - 1; ++i) {
+        if (adc > ladderValues[i] - BUTTON_LADDER_MARGIN && adc < ladderValues[i] + BUTTON_LADDER_MARGIN) return static_cast<EButton>(i + 1);
+    }
+    return buttonNone;
+}
+
+Debouncer::Debouncer(const Timing& timing) :
+    timing_(timing), state_{EState::idle}, button_{buttonNone}, sinceUs_{0}, releaseSinceUs_{-1}, nextRepeatUs_{0}, longPressSent_{false} {}
+
+size_t Debouncer::update(const uint16_t adc, const int64_t nowUs, Event* events) {
+    const EButton reading = classify(adc);
+
+    switch (state_) {
+        case EState::idle:
+            if (reading != buttonNone) {
+                state_ = EState::settling;
+                button_ = reading;
+                sinceUs_ = nowUs;
+            }
+            return 0;
+
+        case EState::settling:
+            // the ladder goes through other values while the voltage moves, start over on any change
+            if (reading != button_) {
+                state_ = reading == buttonNone ? EState::idle : EState::settling;
+                button_ = reading;
+                sinceUs_ = nowUs;
+                return 0;
+            }
+            if (nowUs - sinceUs_ < timing_.debounceUs) return 0;
+
+            state_ = EState::pressed;
+            sinceUs_ = nowUs;
+            releaseSinceUs_ = -1;
+            nextRepeatUs_ = nowUs + timing_.repeatDelayUs;
+            longPressSent_ = false;
+            events[0] = Event{button_, EEventKind::press, nowUs};
+            return 1;
+
+        case EState::pressed:
+            if (reading != button_) {
+                if (releaseSinceUs_ < 0) releaseSinceUs_ = nowUs;
+                if (nowUs - releaseSinceUs_ < timing_.debounceUs) return 0;
+
+                events[0] = Event{button_, EEventKind::release, releaseSinceUs_};
+                state_ = EState::idle;
+                button_ = buttonNone;
+                return 1;
+            }
+            releaseSinceUs_ = -1;
+
+            if (!longPressSent_ && nowUs - sinceUs_ >= timing_.longPressUs) {
+                longPressSent_ = true;
+                events[0] = Event{button_, EEventKind::longPress, nowUs};
+                return 1;
+            }
+            if (nowUs >= nextRepeatUs_) {
+                nextRepeatUs_ += timing_.repeatIntervalUs;
+                events[0] = Event{button_, EEventKind::repeat, nowUs};
+                return 1;
+            }
+            return 0;
+
+        default:
+            return 0;
+    }
+}
+
+Recorder::Recorder() :
+    samples_{}, events_{}, sampleCount_{0}, eventCount_{0}, lastUs_{0}, lastButtonUs_{0}, active_{false}, ready_{false} {}
+
+void Recorder::add(const uint16_t adc, const int64_t nowUs, const Event* events, const size_t count) {
+    if (ready()) return;
+
+    samples_[sampleCount_++ % samples_.size()] = Sample{static_cast<uint32_t>(nowUs), adc};
+    lastUs_ = nowUs;
+    for (size_t i = 0; i < count && eventCount_ < events_.size(); ++i) events_[eventCount_++] = events[i];
+
+    if (classify(adc) != buttonNone) {
+        active_ = true;
+        lastButtonUs_ = nowUs;
+    } else if (active_ && nowUs - lastButtonUs_ >= BUTTON_RECORD_TAIL_US) {
+        active_ = false;
+        ready_.store(true, std::memory_order_release);
+    }
+}
+
+void Recorder::dump(Print& out, const char* comment) {
+    char line[128];
+    const size_t kept = std::min(sampleCount_, samples_.size());
+    const size_t first = sampleCount_ - kept;
+    // times from the oldest sample kept, the events before it are dropped
+    const uint32_t firstUs = samples_[first % samples_.size()].timeUs;
+    const int64_t startUs = lastUs_ - static_cast<uint32_t>(samples_[(sampleCount_ - 1) % samples_.size()].timeUs - firstUs);
+
+    int length = std::snprintf(line, sizeof(line), "# %s\n", comment);
+    out.write(reinterpret_cast<const uint8_t*>(line), std::min<size_t>(length, sizeof(line) - 1));
+    for (size_t i = 0; i < eventCount_; ++i) {
+        const Event& event = events_[i];
+        if (event.timeUs < startUs) continue;
+        length = std::snprintf(line, sizeof(line), "#> %lld,%s,%s\n", static_cast<long long>(event.timeUs - startUs),
+            buttonToString(event.button), eventKindToString(event.kind));
+        out.write(reinterpret_cast<const uint8_t*>(line), length);
+    }
+    out.write(reinterpret_cast<const uint8_t*>("time_us,adc\n"), 12);
+    for (size_t i = first; i < sampleCount_; ++i) {
+        const Sample& sample = samples_[i % samples_.size()];
+        length = std::snprintf(line, sizeof(line), "%u,%u\n", static_cast<unsigned>(sample.timeUs - firstUs), static_cast<unsigned>(sample.adc));
+        out.write(reinterpret_cast<const uint8_t*>(line), length);
+    }
+
+    sampleCount_ = 0;
+    eventCount_ = 0;
+    ready_.store(false, std::memory_order_release);
+}
+
+namespace {
+    struct Sampler {
+        uint8_t pin;
+        Debouncer debouncer;
+        pipeline::Signal* wake;
+    };
+
+    Sampler sampler {0, Debouncer(), nullptr};
+    pipeline::SpscRing<Event, BUTTON_EVENT_QUEUE_SIZE> events; // sampler task -> poll
+    std::atomic<uint16_t> lastAdc {0};
+    std::atomic<size_t> dropped {0};
+#ifdef POLARPICS_BUTTON_RECORD
+    Recorder recorder;
+#endif
+
+    uint16_t readAdc(const uint8_t pin) {
+#ifdef ARDUINO
+        return static_cast<uint16_t>(analogRead(pin));
+#else
+        (void)pin;
+        return 0;
+#endif
+    }
+
+    void samplerTask(void*) {
+        Event emitted[Debouncer::maxEventsPerSample];
+        for(;;) {
+            const uint16_t adc = readAdc(sampler.pin);
+            lastAdc.store(adc, std::memory_order_relaxed);
+
+            const int64_t now = pipeline::nowUs();
+            const size_t count = sampler.debouncer.update(adc, now, emitted);
+#ifdef POLARPICS_BUTTON_RECORD
+            recorder.add(adc, now, emitted, count);
+#endif
+            for (size_t i = 0; i < count; ++i) {
+                if (!events.push(emitted[i])) ++dropped;
+            }
+            if (count > 0 && sampler.wake != nullptr) sampler.wake->notify();
+            pipeline::sleepMs(BUTTON_SAMPLE_MS);
+        }
+    }
+}
+
+bool start(const uint8_t pin, const int core, pipeline::Signal* wake, const Timing& timing) {
+    sampler.pin = pin;
+    sampler.debouncer = Debouncer(timing);
+    sampler.wake = wake;
+    return pipeline::startTask("buttons", samplerTask, nullptr, BUTTON_SAMPLER_STACK, BUTTON_SAMPLER_PRIORITY, core);
+}
+
+bool poll(Event& event) { return events.pop(event); }
+
+uint16_t lastSample() { return lastAdc.load(std::memory_order_relaxed); }
+
+size_t droppedEvents() { return dropped.load(); }
+
+#ifdef POLARPICS_BUTTON_RECORD
+bool recordingReady() { return recorder.ready(); }
+
+void dumpRecording(Print& out) {
+    char comment[96];
+    std::snprintf(comment, sizeof(comment), "recorded on GPIO %u, sampled every %d ms (BUTTON_SAMPLE_MS)",
+        static_cast<unsigned>(sampler.pin), BUTTON_SAMPLE_MS);
+    recorder.dump(out, comment);
+}
+#else
+bool recordingReady() { return false; }
+
+void dumpRecording(Print&) {}
+#endif
+
+}// namespace buttons
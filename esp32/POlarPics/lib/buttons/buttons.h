@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <Print.h>
+
+#include "Signal.h"
+
+namespace buttons {
+
+#define BUTTON_SAMPLE_MS 5 // ADC sampling period
+#define BUTTON_EVENT_QUEUE_SIZE 16
+#define BUTTON_LADDER_MARGIN 200 // ADC counts around each ladder value
+#define BUTTON_SAMPLER_STACK 2048
+#define BUTTON_SAMPLER_PRIORITY 2 // above the capture and print tasks so sampling stays regular
+#define BUTTON_RECORD_SAMPLES 1024 // 5 s of ADC samples per take of the record mode
+#define BUTTON_RECORD_EVENTS 32
+#define BUTTON_RECORD_TAIL_US 500000 // a take ends once no button has been read for that long
+
+// The four buttons share one ADC pin through a resistor ladder
+enum EButton : uint8_t {
+    buttonNone,
+    buttonEnter,
+    buttonBack,
+    buttonLeft,
+    buttonRight,
+    buttonCount
+};
+
+enum class EEventKind : uint8_t {
+    press,
+    repeat, // while held, after repeatDelayUs then every repeatIntervalUs
+    longPress, // once, when held for longPressUs
+    release
+};
+
+struct Event {
+    EButton button;
+    EEventKind kind;
+    int64_t timeUs;
+};
+
+const char* buttonToString(const EButton button);
+const char* eventKindToString(const EEventKind kind);
+
+// Button whose ladder value the ADC reading is close to
+EButton classify(const uint16_t adc);
+
+struct Timing {
+    int64_t debounceUs;
+    int64_t repeatDelayUs;
+    int64_t repeatIntervalUs;
+    int64_t longPressUs;
+};
+
+constexpr Timing defaultTiming {20000, 400000, 120000, 800000};
+
+// Debounce / repeat / long press state machine fed with timestamped ADC samples.
+// It has no hardware dependency: ADC traces (CSV of time_us,adc with the expected events, see host/test/buttonsTest.cpp)
+// are replayed through it on the host, the sample traces are in host/test/data/buttons. Recorder makes them from the ladder.
+class Debouncer {
+private:
+    enum class EState : uint8_t {
+        idle,
+        settling, // a button reading has to stay stable for debounceUs before the press
+        pressed
+    };
+
+    Timing timing_;
+    EState state_;
+    EButton button_; // settling candidate or pressed button
+    int64_t sinceUs_; // start of the settling or of the press
+    int64_t releaseSinceUs_; // first sample without the pressed button, -1 while it is still read
+    int64_t nextRepeatUs_;
+    bool longPressSent_;
+
+public:
+    static const size_t maxEventsPerSample = 1;
+
+    Debouncer(const Timing& timing = defaultTiming);
+
+    // returns the number of events written
+    size_t update(const uint16_t adc, const int64_t nowUs, Event* events);
+
+    inline EButton held() const { return state_ == EState::pressed ? button_ : buttonNone; }
+};
+
+// Raw ADC samples of the last take and the events the debouncer gave for them, dumped as a trace of host/test/buttonsTest.cpp.
+// A take ends BUTTON_RECORD_TAIL_US after the last button reading, then it is kept until dump().
+class Recorder {
+private:
+    struct Sample {
+        uint32_t timeUs; // low bits of the time, the take is much shorter than the wrap
+        uint16_t adc;
+    };
+
+    std::array<Sample, BUTTON_RECORD_SAMPLES> samples_;
+    std::array<Event, BUTTON_RECORD_EVENTS> events_;
+    size_t sampleCount_; // since the take started, the ring keeps the last BUTTON_RECORD_SAMPLES
+    size_t eventCount_;
+    int64_t lastUs_;
+    int64_t lastButtonUs_;
+    bool active_; // a button was read in this take
+    std::atomic<bool> ready_;
+
+public:
+    Recorder();
+
+    // Sampler side, the samples are dropped while a finished take waits for dump()
+    void add(const uint16_t adc, const int64_t nowUs, const Event* events, const size_t count);
+
+    inline bool ready() const { return ready_.load(std::memory_order_acquire); }
+
+    // Consumer side, once ready() (the sampler doesn't touch the take then): the trace with the events as "#>" lines to
+    // check by hand before it goes to host/test/data/buttons. The next take starts afterwards.
+    void dump(Print& out, const char* comment);
+};
+
+// Start the sampling task on the given core, events are then read with poll from a single consumer which wake is notified on every event
+bool start(const uint8_t pin, const int core, pipeline::Signal* wake = nullptr, const Timing& timing = defaultTiming);
+
+bool poll(Event& event);
+
+// last raw ADC reading, to calibrate the ladder
+uint16_t lastSample();
+// events lost because the consumer did not poll for a while
+size_t droppedEvents();
+
+// Record mode of the sampler (-DPOLARPICS_BUTTON_RECORD): a take of the ladder is ready to be dumped.
+// Without the flag nothing is recorded, recordingReady is always false.
+bool recordingReady();
+void dumpRecording(Print& out);
+
+}// namespace buttons
@@ -0,0 +1,292 @@
+#include "FaxG4.h"
+
+#include "esp32-hal-log.h"
+
+#include <cstring>
+
+#include "Netpbm.h"
+
+namespace ccitt {
+
+namespace {
+
+    #define TIFF_HEADER_BYTES 8
+    #define TIFF_ENTRIES 9
+
+    struct Code {
+        uint16_t bits;
+        uint8_t length;
+    };
+
+    // T.4 run length codes: terminating codes of 0 to 63, make-up codes of 64 to 1728, then the extended make-up codes
+    // of 1792 to 2560 shared by both colors. Index 63 + run / 64 is the make-up code of a run.
+    const Code whiteCodes[104] = {
+        {0x035, 8}, {0x007, 6}, {0x007, 4}, {0x008, 4}, {0x00B, 4}, {0x00C, 4}, {0x00E, 4}, {0x00F, 4},
+        {0x013, 5}, {0x014, 5}, {0x007, 5}, {0x008, 5}, {0x008, 6}, {0x003, 6}, {0x034, 6}, {0x035, 6},
+        {0x02A, 6}, {0x02B, 6}, {0x027, 7}, {0x00C, 7}, {0x008, 7}, {0x017, 7}, {0x003, 7}, {0x004, 7},
+        {0x028, 7}, {0x02B, 7}, {0x013, 7}, {0x024, 7}, {0x018, 7}, {0x002, 8}, {0x003, 8}, {0x01A, 8},
+        {0x01B, 8}, {0x012, 8}, {0x013, 8}, {0x014, 8}, {0x015, 8}, {0x016, 8}, {0x017, 8}, {0x028, 8},
+        {0x029, 8}, {0x02A, 8}, {0x02B, 8}, {0x02C, 8}, {0x02D, 8}, {0x004, 8}, {0x005, 8}, {0x00A, 8},
+        {0x00B, 8}, {0x052, 8}, {0x053, 8}, {0x054, 8}, {0x055, 8}, {0x024, 8}, {0x025, 8}, {0x058, 8},
+        {0x059, 8}, {0x05A, 8}, {0x05B, 8}, {0x04A, 8}, {0x04B, 8}, {0x032, 8}, {0x033, 8}, {0x034, 8},
+        {0x01B, 5}, {0x012, 5}, {0x017, 6}, {0x037, 7}, {0x036, 8}, {0x037, 8}, {0x064, 8}, {0x065, 8},
+        {0x068, 8}, {0x067, 8}, {0x0CC, 9}, {0x0CD, 9}, {0x0D2, 9}, {0x0D3, 9}, {0x0D4, 9}, {0x0D5, 9},
+        {0x0D6, 9}, {0x0D7, 9}, {0x0D8, 9}, {0x0D9, 9}, {0x0DA, 9}, {0x0DB, 9}, {0x098, 9}, {0x099, 9},
+        {0x09A, 9}, {0x018, 6}, {0x09B, 9}, {0x008, 11}, {0x00C, 11}, {0x00D, 11}, {0x012, 12}, {0x013, 12},
+        {0x014, 12}, {0x015, 12}, {0x016, 12}, {0x017, 12}, {0x01C, 12}, {0x01D, 12}, {0x01E, 12}, {0x01F, 12}
+    };
+
+    const Code blackCodes[104] = {
+        {0x037, 10}, {0x002, 3}, {0x003, 2}, {0x002, 2}, {0x003, 3}, {0x003, 4}, {0x002, 4}, {0x003, 5},
+        {0x005, 6}, {0x004, 6}, {0x004, 7}, {0x005, 7}, {0x007, 7}, {0x004, 8}, {0x007, 8}, {0x018, 9},
+        {0x017, 10}, {0x018, 10}, {0x008, 10}, {0x067, 11}, {0x068, 11}, {0x06C, 11}, {0x037, 11}, {0x028, 11},
+        {0x017, 11}, {0x018, 11}, {0x0CA, 12}, {0x0CB, 12}, {0x0CC, 12}, {0x0CD, 12}, {0x068, 12}, {0x069, 12},
+        {0x06A, 12}, {0x06B, 12}, {0x0D2, 12}, {0x0D3, 12}, {0x0D4, 12}, {0x0D5, 12}, {0x0D6, 12}, {0x0D7, 12},
+        {0x06C, 12}, {0x06D, 12}, {0x0DA, 12}, {0x0DB, 12}, {0x054, 12}, {0x055, 12}, {0x056, 12}, {0x057, 12},
+        {0x064, 12}, {0x065, 12}, {0x052, 12}, {0x053, 12}, {0x024, 12}, {0x037, 12}, {0x038, 12}, {0x027, 12},
+        {0x028, 12}, {0x058, 12}, {0x059, 12}, {0x02B, 12}, {0x02C, 12}, {0x05A, 12}, {0x066, 12}, {0x067, 12},
+        {0x00F, 10}, {0x0C8, 12}, {0x0C9, 12}, {0x05B, 12}, {0x033, 12}, {0x034, 12}, {0x035, 12}, {0x06C, 13},
+        {0x06D, 13}, {0x04A, 13}, {0x04B, 13}, {0x04C, 13}, {0x04D, 13}, {0x072, 13}, {0x073, 13}, {0x074, 13},
+        {0x075, 13}, {0x076, 13}, {0x077, 13}, {0x052, 13}, {0x053, 13}, {0x054, 13}, {0x055, 13}, {0x05A, 13},
+        {0x05B, 13}, {0x064, 13}, {0x065, 13}, {0x008, 11}, {0x00C, 11}, {0x00D, 11}, {0x012, 12}, {0x013, 12},
+        {0x014, 12}, {0x015, 12}, {0x016, 12}, {0x017, 12}, {0x01C, 12}, {0x01D, 12}, {0x01E, 12}, {0x01F, 12}
+    };
+
+    // vertical mode codes for a1 - b1 from -3 to 3
+    const Code verticalCodes[7] = {{0x02, 7}, {0x02, 6}, {0x2, 3}, {0x1, 1}, {0x3, 3}, {0x03, 6}, {0x03, 7}};
+    const Code passCode = {0x1, 4};
+    const Code horizontalCode = {0x1, 3};
+    const Code eol = {0x001, 12};
+
+    // 1 for a black dot
+    inline bool pixel(const uint8_t* line, const size_t x) {
+        return (line[x >> 3] >> (7 - (x & 7))) & 1;
+    }
+
+    // first position from x on whose color is not black, or end; whole bytes of the color are skipped at once
+    size_t findChange(const uint8_t* line, size_t x, const size_t end, const bool black) {
+        const uint8_t same = black ? 0xFF : 0x00;
+        while (x < end) {
+            if ((x & 7) == 0 && x + 8 <= end && line[x >> 3] == same) {
+                x += 8;
+                continue;
+            }
+            if (pixel(line, x) != black) return x;
+            ++x;
+        }
+        return end;
+    }
+
+    inline void putLittleEndian(uint8_t* p, const uint32_t value, const size_t bytes) {
+        for (size_t i = 0; i < bytes; ++i) p[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+bool writeFile(void* arg, const uint8_t* data, const size_t len) {
+    return std::fwrite(data, 1, len, static_cast<std::FILE*>(arg)) == len;
+}
+
+G4Encoder::G4Encoder(const memory::EOwner owner) :
+    lines_{owner}, write_{nullptr}, arg_{nullptr}, width_{0}, rowsLeft_{0}, out_{}, outLen_{0}, bits_{0}, bitCount_{0}, bytesOut_{0}, failed_{false} {}
+
+void G4Encoder::flush() {
+    if (outLen_ == 0 || failed_) return;
+    if (!write_(arg_, out_, outLen_)) {
+        log_e("g4: write failed after %zu bytes", bytesOut_);
+        failed_ = true;
+        return;
+    }
+    bytesOut_ += outLen_;
+    outLen_ = 0;
+}
+
+// T.4 codes are packed from the MSB of each byte
+void G4Encoder::putBits(const uint32_t code, const size_t count) {
+    bits_ = (bits_ << count) | code;
+    bitCount_ += count;
+    while (bitCount_ >= 8) {
+        bitCount_ -= 8;
+        out_[outLen_++] = static_cast<uint8_t>(bits_ >> bitCount_);
+        if (outLen_ == G4_OUT_BYTES) flush();
+    }
+    bits_ &= (1u << bitCount_) - 1;
+}
+
+void G4Encoder::putRun(size_t run, const bool black) {
+    const Code* codes = black ? blackCodes : whiteCodes;
+    while (run >= 2560 + 64) {
+        putBits(codes[103].bits, codes[103].length);
+        run -= 2560;
+    }
+    if (run >= 64) {
+        const Code& makeUp = codes[63 + (run >> 6)];
+        putBits(makeUp.bits, makeUp.length);
+        run &= 63;
+    }
+    putBits(codes[run].bits, codes[run].length);
+}
+
+// T.6 two-dimensional coding, the changing elements a0, a1, a2 (coding row) and b1, b2 (reference row) as in T.4 4.2.1.3
+void G4Encoder::encodeRow(const uint8_t* reference, const uint8_t* coding) {
+    const size_t w = width_;
+    size_t a0 = 0;
+    size_t a1 = pixel(coding, 0) ? 0 : findChange(coding, 0, w, false);
+    size_t b1 = pixel(reference, 0) ? 0 : findChange(reference, 0, w, false);
+    for (;;) {
+        const size_t b2 = b1 < w ? findChange(reference, b1, w, pixel(reference, b1)) : w;
+        if (b2 < a1) {
+            putBits(passCode.bits, passCode.length);
+            a0 = b2;
+        } else {
+            const long d = static_cast<long>(a1) - static_cast<long>(b1);
+            if (d < -3 || d > 3) {
+                const size_t a2 = a1 < w ? findChange(coding, a1, w, pixel(coding, a1)) : w;
+                putBits(horizontalCode.bits, horizontalCode.length);
+                // the imaginary a0 before the row is white
+                const bool black = a0 + a1 != 0 && pixel(coding, a0);
+                putRun(a1 - a0, black);
+                putRun(a2 - a1, !black);
+                a0 = a2;
+            } else {
+                putBits(verticalCodes[d + 3].bits, verticalCodes[d + 3].length);
+                a0 = a1;
+            }
+        }
+        if (a0 >= w) break;
+
+        const bool color = pixel(coding, a0);
+        a1 = findChange(coding, a0, w, color);
+        b1 = findChange(reference, a0, w, !color);
+        b1 = findChange(reference, b1, w, color);
+    }
+}
+
+bool G4Encoder::begin(const size_t width, const size_t height, WriteFn write, void* arg) {
+    if (width == 0 || width > G4_MAX_WIDTH) {
+        log_e("g4: width %zu is not supported", width);
+        return false;
+    }
+    const size_t bytes = (width + 7) / 8;
+    if (lines_.width() != bytes) lines_ = Matrix<uint8_t>(bytes, 2, lines_.owner());
+    if (lines_.data() == nullptr) {
+        log_e("g4: can't allocate the reference row");
+        return false;
+    }
+
+    write_ = write;
+    arg_ = arg;
+    width_ = width;
+    rowsLeft_ = height;
+    outLen_ = 0;
+    bits_ = 0;
+    bitCount_ = 0;
+    bytesOut_ = 0;
+    failed_ = false;
+    std::fill(lines_.begin(), lines_.begin() + bytes, 0); // the row above the first one is white
+    return true;
+}
+
+bool G4Encoder::writeRows(const uint8_t* rows, const size_t count) {
+    if (count > rowsLeft_) {
+        log_e("g4: %zu rows past the end of the image", count - rowsLeft_);
+        return false;
+    }
+
+    const size_t bytes = lines_.width();
+    uint8_t* reference = lines_.data();
+    for (size_t r = 0; r < count; ++r, rows += bytes) {
+        encodeRow(reference, rows);
+        std::memcpy(reference, rows, bytes);
+    }
+    rowsLeft_ -= count;
+    return !failed_;
+}
+
+bool G4Encoder::end() {
+    if (rowsLeft_ != 0) {
+        log_e("g4: %zu rows missing", rowsLeft_);
+        return false;
+    }
+
+    // end of facsimile block: two EOL
+    putBits(eol.bits, eol.length);
+    putBits(eol.bits, eol.length);
+    if (bitCount_ > 0) putBits(0, 8 - bitCount_);
+    flush();
+    return !failed_;
+}
+
+bool write(WriteFn write, void* arg, const PrinterMatrix& mat, const memory::EOwner owner) {
+    G4Encoder encoder(owner);
+    if (!encoder.begin(mat.width(), mat.height(), write, arg)) return false;
+    uint8_t row[G4_MAX_WIDTH / 8];
+    for (size_t r = 0; r < mat.height(); ++r) {
+        netpbm::packedToRow(mat.data(), r * mat.width(), mat.width(), row);
+        if (!encoder.writeRows(row, 1)) return false;
+    }
+    return encoder.end();
+}
+
+bool beginTiff(std::FILE* file) {
+    const uint8_t header[TIFF_HEADER_BYTES] = {'I', 'I', 42, 0, 0, 0, 0, 0};
+    if (std::fwrite(header, 1, TIFF_HEADER_BYTES, file) != TIFF_HEADER_BYTES) {
+        log_e("g4: TIFF header write failed");
+        return false;
+    }
+    return true;
+}
+
+bool finishTiff(std::FILE* file, const size_t width, const size_t height, const size_t dataBytes) {
+    // the directory starts on a word boundary
+    const size_t padding = dataBytes % 2;
+    const uint32_t directory = TIFF_HEADER_BYTES + dataBytes + padding;
+    if (padding != 0 && std::fputc(0, file) == EOF) return false;
+
+    struct Entry {
+        uint16_t tag;
+        uint16_t type; // 3 SHORT, 4 LONG
+        uint32_t value;
+    };
+    const Entry entries[TIFF_ENTRIES] = {
+        {256, 4, static_cast<uint32_t>(width)},
+        {257, 4, static_cast<uint32_t>(height)},
+        {258, 3, 1}, // bits per sample
+        {259, 3, 4}, // CCITT T.6
+        {262, 3, 0}, // WhiteIsZero, a set bit is black
+        {273, 4, TIFF_HEADER_BYTES}, // strip offset
+        {277, 3, 1}, // samples per pixel
+        {278, 4, static_cast<uint32_t>(height)}, // rows per strip
+        {279, 4, static_cast<uint32_t>(dataBytes)}
+    };
+    uint8_t ifd[2 + TIFF_ENTRIES * 12 + 4] = {};
+    putLittleEndian(ifd, TIFF_ENTRIES, 2);
+    for (size_t i = 0; i < TIFF_ENTRIES; ++i) {
+        uint8_t* e = ifd + 2 + i * 12;
+        putLittleEndian(e, entries[i].tag, 2);
+        putLittleEndian(e + 2, entries[i].type, 2);
+        putLittleEndian(e + 4, 1, 4);
+        putLittleEndian(e + 8, entries[i].value, entries[i].type == 3 ? 2 : 4);
+    }
+
+    uint8_t offset[4];
+    putLittleEndian(offset, directory, 4);
+    if (std::fwrite(ifd, 1, sizeof(ifd), file) != sizeof(ifd) || std::fseek(file, 4, SEEK_SET) != 0 ||
+        std::fwrite(offset, 1, 4, file) != 4 || std::fseek(file, 0, SEEK_END) != 0) {
+        log_e("g4: TIFF directory write failed");
+        return false;
+    }
+    return true;
+}
+
+bool writeTiff(std::FILE* file, const PrinterMatrix& mat, const memory::EOwner owner) {
+    G4Encoder encoder(owner);
+    if (!beginTiff(file) || !encoder.begin(mat.width(), mat.height(), writeFile, file)) return false;
+    uint8_t row[G4_MAX_WIDTH / 8];
+    for (size_t r = 0; r < mat.height(); ++r) {
+        netpbm::packedToRow(mat.data(), r * mat.width(), mat.width(), row);
+        if (!encoder.writeRows(row, 1)) return false;
+    }
+    return encoder.end() && finishTiff(file, mat.width(), mat.height(), encoder.bytesOut());
+}
+
+}// namespace ccitt
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "Matrix.h"
+#include "PrinterMatrix.h"
+
+// Streaming CCITT Group 4 (T.6) encoder: every row is coded against the previous one (pass, vertical and horizontal
+// modes), only the reference row is kept. Dithered photos don't shrink much, text, frames and flat areas do.
+// The raw T.6 stream has no header, writeTiff wraps it in a single strip TIFF any viewer opens.
+
+#define G4_MAX_WIDTH 2048 // pixels per row
+#define G4_OUT_BYTES 256 // output buffer, flushed to the WriteFn when full
+
+namespace ccitt {
+
+// Receives the encoded bytes, false aborts the encode
+typedef bool (*WriteFn)(void* arg, const uint8_t* data, const size_t len);
+
+// WriteFn of a std::FILE*
+bool writeFile(void* arg, const uint8_t* data, const size_t len);
+
+class G4Encoder {
+private:
+    Matrix<uint8_t> lines_; // reference then coding row, byte padded, a set bit is black
+    WriteFn write_;
+    void* arg_;
+    size_t width_;
+    size_t rowsLeft_;
+    uint8_t out_[G4_OUT_BYTES];
+    size_t outLen_;
+    uint32_t bits_;
+    size_t bitCount_;
+    size_t bytesOut_;
+    bool failed_;
+
+    void putBits(const uint32_t code, const size_t count);
+    void putRun(size_t run, const bool black);
+    void flush();
+    void encodeRow(const uint8_t* reference, const uint8_t* coding);
+
+public:
+    explicit G4Encoder(const memory::EOwner owner = memory::EOwner::unknown);
+
+    bool begin(const size_t width, const size_t height, WriteFn write, void* arg);
+    // rows in the thermal dot convention, byte padded (netpbm P4, printing::Band and gallery layout)
+    bool writeRows(const uint8_t* rows, const size_t count);
+    // once every row is written: the end of facsimile block and the padding to a byte
+    bool end();
+
+    inline size_t rowsLeft() const { return rowsLeft_; }
+    // bytes given to write so far
+    inline size_t bytesOut() const { return bytesOut_; }
+};
+
+// Whole PrinterMatrix (a set bit is white) as a raw T.6 stream
+bool write(WriteFn write, void* arg, const PrinterMatrix& mat, const memory::EOwner owner = memory::EOwner::unknown);
+
+// Single strip TIFF (compression 4, WhiteIsZero) around a G4 stream written in between:
+// beginTiff leaves room for the header, finishTiff appends the directory once the data size is known and patches the header
+bool beginTiff(std::FILE* file);
+bool finishTiff(std::FILE* file, const size_t width, const size_t height, const size_t dataBytes);
+
+bool writeTiff(std::FILE* file, const PrinterMatrix& mat, const memory::EOwner owner = memory::EOwner::unknown);
+
+}// namespace ccitt
@@ -2,6 +2,22 @@
 
 #include <assert.h>
 #include <algorithm>
+#include <cmath>
+
+const char* filtering::methodToString(const EFilteringMethod method) {
+    switch (method) {
+        case EFilteringMethod::floydSteinberg: return "floydSteinberg";
+        case EFilteringMethod::atkinson: return "atkinson";
+        case EFilteringMethod::jarvisJudiceNinke: return "jarvisJudiceNinke";
+        case EFilteringMethod::stucki: return "stucki";
+        case EFilteringMethod::burkes: return "burkes";
+        case EFilteringMethod::sierra3: return "sierra3";
+        case EFilteringMethod::sierra2: return "sierra2";
+        case EFilteringMethod::sierra24a: return "sierra24a";
+        case EFilteringMethod::stevensonArce: return "stevensonArce";
+        default: return "unknown";
+    }
+}
 
 uint8_t filtering::rgbToGrayscale(const uint8_t r, const uint8_t g, const uint8_t b) { 
     return std::max(0.0f, std::min(255.0f, 0.299f * float(r) + 0.587f * float(g) + 0.144f * float(b)));
@@ -20,6 +36,13 @@ Matrix<uint8_t> filtering::convertToGrayscale(const Matrix<PIXELFORMAT_RGB>& inM
     return outMat;
 }
 
+void filtering::convertToGrayscale(const Matrix<PIXELFORMAT_RGB>& inMat, Matrix<uint8_t>& outMat) {
+    if(outMat.width() != inMat.width() || outMat.height() != inMat.height())
+        outMat = Matrix<uint8_t>(inMat.width(), inMat.height(), outMat.owner());
+
+    std::transform(inMat.begin(), inMat.end(), outMat.data(), [](const PIXELFORMAT_RGB& e) { return filtering::rgbToGrayscale(e); });
+}
+
 void filtering::errorDiffusion(Matrix<uint8_t>& mat, const float threshold, EFilteringMethod method) {
 
     // get pattern
@@ -52,7 +75,13 @@ void filtering::errorDiffusion(Matrix<uint8_t>& mat, const float threshold, EFil
     }
 }
 
-PrinterMatrix filtering::errorDiffusionPrinter(Matrix<uint8_t>& mat, const float threshold, const EFilteringMethod method) {
+PrinterMatrix filtering::errorDiffusionPrinter(Matrix<uint8_t>& mat, const float threshold, const EFilteringMethod method, const memory::EOwner owner) {
+    PrinterMatrix out(mat.width(), mat.height(), owner);
+    errorDiffusionPrinter(mat, out, threshold, method);
+    return out;
+}
+
+void filtering::errorDiffusionPrinter(Matrix<uint8_t>& mat, PrinterMatrix& out, const float threshold, const EFilteringMethod method) {
 
     // get pattern
     const auto end = diffusionPatterns.end();
@@ -62,11 +91,14 @@ PrinterMatrix filtering::errorDiffusionPrinter(Matrix<uint8_t>& mat, const float
     // If method can't be found
     if(it == end) throw std::runtime_error("[error] errorDiffusion: pattern can't be found.");
 
-    const std::vector<PatternPart> pattern = it->second;
+    // no copy, this runs on every preview frame
+    const std::vector<PatternPart>& pattern = it->second;
 
     const size_t cols = mat.width();
     const size_t rows = mat.height();
-    PrinterMatrix out(cols, rows);
+    if(out.width() != cols || out.height() != rows)
+        out = PrinterMatrix(cols, rows, out.owner());
+
     for (size_t r = 0; r < rows; ++r) {
         for (size_t c = 0; c < cols; ++c) {
             const float pixelValue = static_cast<float>(mat(r, c));
@@ -90,6 +122,61 @@ PrinterMatrix filtering::errorDiffusionPrinter(Matrix<uint8_t>& mat, const float
     //         out.set(i, j, i%2 == 0);
     //     }
     // }
-    
-    return out;
-}
\ No newline at end of file
+}
+
+filtering::RowDitherer::RowDitherer(const size_t width, const float threshold, const EFilteringMethod method, const memory::EOwner owner) :
+    width_{width}, threshold_{threshold}, pattern_{nullptr}, reach_{0}, rowsIn_{0}, rowsOut_{0} {
+
+    const auto end = diffusionPatterns.end();
+    const auto it = std::find_if(diffusionPatterns.begin(), end, [&method](const std::pair<EFilteringMethod, std::vector<PatternPart>>& e) 
+    { return e.first == method; } );
+
+    if(it == end) throw std::runtime_error("[error] RowDitherer: pattern can't be found.");
+
+    pattern_ = &it->second;
+    for (const PatternPart& ps : *pattern_)
+        reach_ = std::max<size_t>(reach_, ps.deltaRows);
+
+    window_ = Matrix<uint8_t>(width_, reach_ + 1, owner);
+}
+
+void filtering::RowDitherer::ditherRow(uint8_t* out) {
+    const size_t r = rowsOut_++;
+    uint8_t* row = windowRow(r);
+    std::fill(out, out + rowBytes(), 0);
+
+    for (size_t c = 0; c < width_; ++c) {
+        const float pixelValue = static_cast<float>(row[c]);
+        const bool newPixel = pixelValue > (threshold_ * 255.f); // Quantization by threshold
+        const float error = pixelValue - (newPixel ? 255.f : 0.f); // Error
+        if(newPixel) out[c / 8] |= 1 << (7 - c % 8); // Assignation
+
+        // Error diffusion, rows not pushed yet are below the bottom of the image
+        for (const PatternPart& ps : *pattern_) {
+            const size_t newRow = r + ps.deltaRows;
+            const int newCol = static_cast<int>(c) + ps.deltaCols;
+            if(newRow < rowsIn_ && newCol >= 0 && newCol < static_cast<int>(width_)) {
+                uint8_t& target = windowRow(newRow)[newCol];
+                target = static_cast<uint8_t>(clamp<float>(static_cast<float>(target) + error * ps.proportion, 0.0f, 255.0f)); // error diffusion
+            }
+        }
+    }
+}
+
+bool filtering::RowDitherer::pushRow(const uint8_t* row, uint8_t* out) {
+    std::copy(row, row + width_, windowRow(rowsIn_));
+    ++rowsIn_;
+
+    // a row is final once every row its error reaches has been loaded
+    if(rowsIn_ <= reach_) return false;
+
+    ditherRow(out);
+    return true;
+}
+
+bool filtering::RowDitherer::flushRow(uint8_t* out) {
+    if(rowsOut_ >= rowsIn_) return false;
+
+    ditherRow(out);
+    return true;
+}
@@ -60,12 +60,47 @@ const std::array<std::pair<EFilteringMethod, std::vector<PatternPart>>, 9> diffu
     }
 }};
 
+const char* methodToString(const EFilteringMethod method);
+
 uint8_t rgbToGrayscale(const uint8_t r, const uint8_t g, const uint8_t b);
 uint8_t rgbToGrayscale(const PIXELFORMAT_RGB& pixel);
 
 Matrix<uint8_t> convertToGrayscale(const Matrix<PIXELFORMAT_RGB>& inMat);
+// Same conversion into an existing buffer, only reallocated (for the same owner) when the size changes
+void convertToGrayscale(const Matrix<PIXELFORMAT_RGB>& inMat, Matrix<uint8_t>& outMat);
+
+// Error diffusion fed one row at a time, only keeps the rows the pattern reaches below the current one.
+// Gives the same result as errorDiffusionPrinter, rows come out packed (MSB first, a set bit is a white pixel) with a latency of rowLatency() rows.
+class RowDitherer {
+private:
+    size_t width_;
+    float threshold_;
+    const std::vector<PatternPart>* pattern_;
+    size_t reach_; // deepest row the pattern diffuses to
+    Matrix<uint8_t> window_; // ring of the reach_ + 1 last rows
+    size_t rowsIn_;
+    size_t rowsOut_;
+
+    inline uint8_t* windowRow(const size_t row) { return window_.data() + (row % window_.height()) * width_; }
+    void ditherRow(uint8_t* out);
+
+public:
+    RowDitherer() : width_{0}, threshold_{0.5f}, pattern_{nullptr}, reach_{0}, rowsIn_{0}, rowsOut_{0} {}
+    RowDitherer(const size_t width, const float threshold = 0.5f, const EFilteringMethod method = EFilteringMethod::floydSteinberg, const memory::EOwner owner = memory::EOwner::unknown);
+
+    inline size_t width() const { return width_; }
+    inline size_t rowBytes() const { return (width_ + 7) / 8; }
+    inline size_t rowLatency() const { return reach_; }
+
+    // Add the next source row, returns true when a dithered row has been written to out (rowBytes() bytes)
+    bool pushRow(const uint8_t* row, uint8_t* out);
+    // Once every row has been pushed, writes the next buffered row, returns false when there is nothing left
+    bool flushRow(uint8_t* out);
+};
 
 void errorDiffusion(Matrix<uint8_t>& mat, const float threshold = 0.5f, EFilteringMethod method = EFilteringMethod::floydSteinberg);
-PrinterMatrix errorDiffusionPrinter(Matrix<uint8_t>& mat, const float threshold = 0.5f, const EFilteringMethod method = EFilteringMethod::floydSteinberg);
+PrinterMatrix errorDiffusionPrinter(Matrix<uint8_t>& mat, const float threshold = 0.5f, const EFilteringMethod method = EFilteringMethod::floydSteinberg, const memory::EOwner owner = memory::EOwner::unknown);
+// Same dithering into an existing buffer, only reallocated (for the same owner) when the size changes
+void errorDiffusionPrinter(Matrix<uint8_t>& mat, PrinterMatrix& out, const float threshold = 0.5f, const EFilteringMethod method = EFilteringMethod::floydSteinberg);
 
 }// namespace filtering
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "governor.h"
+
+#include "esp32-hal-log.h"
+
+namespace governor {
+
+int64_t StageTimes::total() const {
+    int64_t sum = 0;
+    for (const int64_t t : us) sum += t;
+    return sum;
+}
+
+namespace {
+    size_t patternTaps(const filtering::EFilteringMethod method) {
+        for (const auto& e : filtering::diffusionPatterns) {
+            if(e.first == method) return e.second.size();
+        }
+        return 0;
+    }
+}
+
+StageTimes predict(const StageTimes& measured, const QualityLevel& from, const QualityLevel& to) {
+    const float pixelRatio = static_cast<float>(to.width * to.height) / static_cast<float>(from.width * from.height);
+    const float sourceRatio = static_cast<float>(to.sourceScale * to.sourceScale) / static_cast<float>(from.sourceScale * from.sourceScale);
+    // +1 for the quantization itself
+    const float tapsRatio = static_cast<float>(patternTaps(to.method) + 1) / static_cast<float>(patternTaps(from.method) + 1);
+
+    StageTimes out;
+    for (size_t s = 0; s < stageCount; ++s) {
+        float ratio = pixelRatio;
+        if (s == stageDither) ratio *= tapsRatio;
+        else if (s == stageCapture || s == stageDecode) ratio *= sourceRatio;
+        out.us[s] = static_cast<int64_t>(static_cast<float>(measured.us[s]) * ratio);
+    }
+    return out;
+}
+
+Governor::Governor(const QualityLevel* levels, const size_t levelCount, const float targetFps, const size_t initialLevel) :
+    levels_{levels}, levelCount_{levelCount}, current_{initialLevel < levelCount ? initialLevel : levelCount - 1},
+    targetFrameUs_{static_cast<int64_t>(1000000.f / targetFps)},
+    average_{}, framesAtLevel_{0}, slowFrames_{0}, fastFrames_{0} {}
+
+void Governor::changeLevel(const size_t newLevel, const char* reason, const int64_t frameUs, const int64_t predictedUs) {
+    const QualityLevel& from = levels_[current_];
+    const QualityLevel& to = levels_[newLevel];
+    log_d("governor: level %zu -> %zu (%zux%zu x%zu %s -> %zux%zu x%zu %s): %s, frame %lld us (predicted %lld us) for a %lld us target",
+        current_, newLevel,
+        from.width, from.height, from.displayScale, filtering::methodToString(from.method),
+        to.width, to.height, to.displayScale, filtering::methodToString(to.method),
+        reason, static_cast<long long>(frameUs), static_cast<long long>(predictedUs), static_cast<long long>(targetFrameUs_));
+
+    for (size_t s = 0; s < stageCount; ++s)
+        log_d("governor:   %s %lld us", stageToString(static_cast<EStage>(s)), static_cast<long long>(average_.us[s]));
+
+    current_ = newLevel;
+    framesAtLevel_ = 0;
+    slowFrames_ = 0;
+    fastFrames_ = 0;
+}
+
+bool Governor::update(const StageTimes& times) {
+    ++framesAtLevel_;
+    if(framesAtLevel_ <= settleFrames) {
+        average_ = times;
+        return false;
+    }
+
+    // exponential moving average (1/4) of each stage
+    for (size_t s = 0; s < stageCount; ++s)
+        average_.us[s] += (times.us[s] - average_.us[s]) / 4;
+
+    const int64_t frameUs = average_.total();
+
+    if(frameUs * 100 > targetFrameUs_ * slowMargin) {
+        fastFrames_ = 0;
+        if(++slowFrames_ >= slowFramesToStepDown && current_ > 0) {
+            changeLevel(current_ - 1, "too slow", frameUs, predict(average_, level(), levels_[current_ - 1]).total());
+            return true;
+        }
+        return false;
+    }
+    slowFrames_ = 0;
+
+    if(current_ + 1 >= levelCount_) return false;
+
+    const int64_t predictedUs = predict(average_, level(), levels_[current_ + 1]).total();
+    if(predictedUs * 100 < targetFrameUs_ * headroomMargin) {
+        if(++fastFrames_ >= fastFramesToStepUp) {
+            changeLevel(current_ + 1, "headroom", frameUs, predictedUs);
+            return true;
+        }
+    } else {
+        fastFrames_ = 0;
+    }
+    return false;
+}
+
+}// namespace governor
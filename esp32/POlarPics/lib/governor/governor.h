@@ -0,0 +1,80 @@
+#pragma once
+
+#include <filtering.h>
+#include "trace.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace governor {
+
+// the preview stages of trace::EStage
+using trace::EStage;
+using trace::stageCapture;
+using trace::stageDecode;
+using trace::stageGrayscale;
+using trace::stageDither;
+using trace::stageDisplay;
+using trace::stageToString;
+const size_t stageCount = trace::stagePreviewCount;
+
+struct StageTimes {
+    std::array<int64_t, stageCount> us {{}};
+
+    int64_t total() const;
+};
+
+// One step of the quality ladder, framesize is the sensor framesize_t kept as an int so this lib doesn't depend on the camera driver
+struct QualityLevel {
+    int framesize;
+    size_t width;
+    size_t height;
+    size_t sourceScale; // sensor width / width, a larger sensor mode is decoded at a reduced DCT scale
+    size_t displayScale;
+    filtering::EFilteringMethod method;
+};
+
+// Estimate the cost of each stage at level "to" from the costs measured at level "from":
+// everything scales with the pixel count, the capture and the entropy decode with the sensor pixel count,
+// the dither also scales with the number of taps of the diffusion pattern
+StageTimes predict(const StageTimes& measured, const QualityLevel& from, const QualityLevel& to);
+
+// Picks the preview quality level (levels ordered from the cheapest to the best) holding a target fps.
+// Steps down as soon as frames are consistently too slow, steps up only when the predicted cost of the next level leaves some headroom.
+class Governor {
+private:
+    const QualityLevel* levels_;
+    size_t levelCount_;
+    size_t current_;
+
+    int64_t targetFrameUs_;
+
+    StageTimes average_;
+    size_t framesAtLevel_;
+    size_t slowFrames_;
+    size_t fastFrames_;
+
+    void changeLevel(const size_t newLevel, const char* reason, const int64_t frameUs, const int64_t predictedUs);
+
+public:
+    // frames ignored after a level change (sensor switch, first frame with a new size)
+    static const size_t settleFrames = 3;
+    static const size_t slowFramesToStepDown = 2;
+    static const size_t fastFramesToStepUp = 8;
+    // margins in percent of the target frame time
+    static const int64_t slowMargin = 110;
+    static const int64_t headroomMargin = 85;
+
+    Governor(const QualityLevel* levels, const size_t levelCount, const float targetFps, const size_t initialLevel = 0);
+
+    // feed the stage times of the last frame, returns true when the level changed
+    bool update(const StageTimes& times);
+
+    inline const QualityLevel& level() const { return levels_[current_]; }
+    inline size_t levelIndex() const { return current_; }
+    inline const StageTimes& average() const { return average_; }
+    inline int64_t targetFrameUs() const { return targetFrameUs_; }
+};
+
+}// namespace governor
@@ -0,0 +1,256 @@
+#include "Netpbm.h"
+
+#include "esp32-hal-log.h"
+
+#include <cctype>
+#include <cstring>
+
+// rows are written straight from the matrix memory
+static_assert(sizeof(PIXELFORMAT_RGB) == 3, "PIXELFORMAT_RGB must match the P6 pixel layout");
+
+namespace netpbm {
+
+const char* formatToString(const EFormat format) {
+    switch (format) {
+        case EFormat::pbm: return "P4";
+        case EFormat::pgm: return "P5";
+        case EFormat::ppm: return "P6";
+        default: return "invalid";
+    }
+}
+
+size_t rowBytes(const EFormat format, const size_t width) {
+    switch (format) {
+        case EFormat::pbm: return (width + 7) / 8;
+        case EFormat::pgm: return width;
+        case EFormat::ppm: return width * 3;
+        default: return 0;
+    }
+}
+
+namespace {
+
+    // bits of the last byte of a count bits run that are used
+    inline uint8_t tailMask(const size_t count) {
+        return count % 8 == 0 ? 0xFF : static_cast<uint8_t>(0xFF << (8 - count % 8));
+    }
+
+    // dst gets the count bits of src starting at bit offset, inverted, the padding bits of its last byte are cleared
+    void extractInverted(const uint8_t* src, const size_t offset, uint8_t* dst, const size_t count) {
+        const uint8_t* s = src + offset / 8;
+        const size_t shift = offset % 8;
+        const size_t bytes = (count + 7) / 8;
+        const uint8_t* last = src + (offset + count - 1) / 8; // never read past the run
+        for (size_t i = 0; i < bytes; ++i) {
+            uint8_t value = s[i] << shift;
+            if (shift != 0 && s + i + 1 <= last) value |= s[i + 1] >> (8 - shift);
+            dst[i] = ~value;
+        }
+        dst[bytes - 1] &= tailMask(count);
+    }
+
+    // the count bits of dst starting at bit offset get src, inverted, the bits around the run are kept
+    void depositInverted(const uint8_t* src, uint8_t* dst, const size_t offset, const size_t count) {
+        uint8_t* d = dst + offset / 8;
+        const size_t shift = offset % 8;
+        const size_t bytes = (count + 7) / 8;
+        for (size_t i = 0; i < bytes; ++i) {
+            const uint8_t mask = i + 1 == bytes ? tailMask(count) : 0xFF;
+            const uint8_t value = ~src[i] & mask;
+            d[i] = (d[i] & ~(mask >> shift)) | (value >> shift);
+            const uint8_t spill = static_cast<uint8_t>(mask << (8 - shift));
+            if (shift != 0 && spill != 0)
+                d[i + 1] = (d[i + 1] & ~spill) | static_cast<uint8_t>(value << (8 - shift));
+        }
+    }
+
+    // whitespace and # comments between the header fields
+    bool skipSeparators(std::FILE* file) {
+        int c = std::fgetc(file);
+        while (c != EOF) {
+            if (c == '#') {
+                while (c != EOF && c != '\n') c = std::fgetc(file);
+            } else if (!std::isspace(c)) {
+                std::ungetc(c, file);
+                return true;
+            } else {
+                c = std::fgetc(file);
+            }
+        }
+        return false;
+    }
+
+    bool readNumber(std::FILE* file, size_t& value) {
+        if (!skipSeparators(file)) return false;
+        value = 0;
+        int c = std::fgetc(file);
+        if (!std::isdigit(c)) return false;
+        while (std::isdigit(c)) {
+            value = value * 10 + (c - '0');
+            c = std::fgetc(file);
+        }
+        // a single whitespace ends the last field, the pixels start right after it
+        return c != EOF && std::isspace(c);
+    }
+
+    bool expect(const Header& header, const EFormat format) {
+        if (header.format == format) return true;
+        log_e("netpbm: %s file where a %s was expected", formatToString(header.format), formatToString(format));
+        return false;
+    }
+
+    void rescale(uint8_t* samples, const size_t count, const uint16_t maxValue) {
+        if (maxValue == 255) return;
+        for (size_t i = 0; i < count; ++i)
+            samples[i] = static_cast<uint8_t>(std::min<size_t>(samples[i], maxValue) * 255 / maxValue);
+    }
+
+    template <typename T>
+    bool writeSamples(std::FILE* file, const Matrix<T>& mat, const EFormat format) {
+        if (!writeHeader(file, format, mat.width(), mat.height())) return false;
+        const size_t bytes = rowBytes(format, mat.width());
+        const uint8_t* row = reinterpret_cast<const uint8_t*>(mat.data());
+        for (size_t r = 0; r < mat.height(); ++r, row += bytes) {
+            if (std::fwrite(row, 1, bytes, file) != bytes) {
+                log_e("netpbm: write failed at row %zu", r);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    bool readSamples(std::FILE* file, Matrix<T>& mat, const EFormat format) {
+        Header header;
+        if (!readHeader(file, header) || !expect(header, format)) return false;
+        if (mat.width() != header.width || mat.height() != header.height)
+            mat = Matrix<T>(header.width, header.height, mat.owner());
+        if (mat.data() == nullptr && mat.len() != 0) {
+            log_e("netpbm: can't allocate %zux%zu", header.width, header.height);
+            return false;
+        }
+
+        const size_t bytes = rowBytes(format, header.width);
+        uint8_t* row = reinterpret_cast<uint8_t*>(mat.data());
+        for (size_t r = 0; r < header.height; ++r, row += bytes) {
+            if (std::fread(row, 1, bytes, file) != bytes) {
+                log_e("netpbm: file truncated at row %zu", r);
+                return false;
+            }
+            rescale(row, bytes, header.maxValue);
+        }
+        return true;
+    }
+}
+
+bool writeHeader(std::FILE* file, const EFormat format, const size_t width, const size_t height) {
+    const int written = format == EFormat::pbm ?
+        std::fprintf(file, "%s\n%u %u\n", formatToString(format), static_cast<unsigned>(width), static_cast<unsigned>(height)) :
+        std::fprintf(file, "%s\n%u %u\n255\n", formatToString(format), static_cast<unsigned>(width), static_cast<unsigned>(height));
+    if (written < 0) {
+        log_e("netpbm: header write failed");
+        return false;
+    }
+    return true;
+}
+
+bool readHeader(std::FILE* file, Header& header) {
+    char magic[2];
+    if (std::fread(magic, 1, 2, file) != 2 || magic[0] != 'P') {
+        log_e("netpbm: not a netpbm file");
+        return false;
+    }
+    switch (magic[1]) {
+        case '4': header.format = EFormat::pbm; break;
+        case '5': header.format = EFormat::pgm; break;
+        case '6': header.format = EFormat::ppm; break;
+        default:
+            log_e("netpbm: P%c is not supported, only the binary P4, P5 and P6", magic[1]);
+            return false;
+    }
+
+    size_t maxValue = 1;
+    if (!readNumber(file, header.width) || !readNumber(file, header.height) ||
+        (header.format != EFormat::pbm && !readNumber(file, maxValue))) {
+        log_e("netpbm: invalid header");
+        return false;
+    }
+    if (maxValue == 0 || maxValue > 255) {
+        log_e("netpbm: max value %zu is not supported, 8 bit samples only", maxValue);
+        return false;
+    }
+    header.maxValue = static_cast<uint16_t>(maxValue);
+    return true;
+}
+
+bool writePackedRow(std::FILE* file, const uint8_t* packed, const size_t offset, const size_t width) {
+    uint8_t chunk[NETPBM_CHUNK_BYTES];
+    for (size_t done = 0; done < width; done += NETPBM_CHUNK_BYTES * 8) {
+        const size_t count = std::min<size_t>(width - done, NETPBM_CHUNK_BYTES * 8);
+        const size_t bytes = (count + 7) / 8;
+        extractInverted(packed, offset + done, chunk, count);
+        if (std::fwrite(chunk, 1, bytes, file) != bytes) {
+            log_e("netpbm: row write failed");
+            return false;
+        }
+    }
+    return true;
+}
+
+void packedToRow(const uint8_t* packed, const size_t offset, const size_t width, uint8_t* row) {
+    if (width != 0) extractInverted(packed, offset, row, width);
+}
+
+bool readPackedRow(std::FILE* file, uint8_t* packed, const size_t offset, const size_t width) {
+    uint8_t chunk[NETPBM_CHUNK_BYTES];
+    for (size_t done = 0; done < width; done += NETPBM_CHUNK_BYTES * 8) {
+        const size_t count = std::min<size_t>(width - done, NETPBM_CHUNK_BYTES * 8);
+        const size_t bytes = (count + 7) / 8;
+        if (std::fread(chunk, 1, bytes, file) != bytes) {
+            log_e("netpbm: file truncated");
+            return false;
+        }
+        depositInverted(chunk, packed, offset + done, count);
+    }
+    return true;
+}
+
+bool write(std::FILE* file, const PrinterMatrix& mat) {
+    if (!writeHeader(file, EFormat::pbm, mat.width(), mat.height())) return false;
+    for (size_t r = 0; r < mat.height(); ++r)
+        if (!writePackedRow(file, mat.data(), r * mat.width(), mat.width())) return false;
+    return true;
+}
+
+bool write(std::FILE* file, const Matrix<uint8_t>& mat) {
+    return writeSamples(file, mat, EFormat::pgm);
+}
+
+bool write(std::FILE* file, const Matrix<PIXELFORMAT_RGB>& mat) {
+    return writeSamples(file, mat, EFormat::ppm);
+}
+
+bool read(std::FILE* file, PrinterMatrix& mat) {
+    Header header;
+    if (!readHeader(file, header) || !expect(header, EFormat::pbm)) return false;
+    if (mat.width() != header.width || mat.height() != header.height)
+        mat = PrinterMatrix(header.width, header.height, mat.owner());
+    if (mat.data() == nullptr && mat.len() != 0) {
+        log_e("netpbm: can't allocate %zux%zu", header.width, header.height);
+        return false;
+    }
+
+    for (size_t r = 0; r < header.height; ++r)
+        if (!readPackedRow(file, mat.data(), r * header.width, header.width)) return false;
+    return true;
+}
+
+bool read(std::FILE* file, Matrix<uint8_t>& mat) {
+    return readSamples(file, mat, EFormat::pgm);
+}
+
+bool read(std::FILE* file, Matrix<PIXELFORMAT_RGB>& mat) {
+    return readSamples(file, mat, EFormat::ppm);
+}
+
+}// namespace netpbm
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "Matrix.h"
+#include "PrinterMatrix.h"
+
+// Binary netpbm files (P4 PBM, P5 PGM, P6 PPM) streamed row by row through a FILE*,
+// on the device the SD card is mounted in the VFS so fopen("/sdcard/...") works the same as on the host.
+// PGM and PPM rows are read and written straight from the Matrix rows, PBM rows go through a small stack buffer:
+// a PBM row is byte padded with a set bit for a black dot, PrinterMatrix packs its rows back to back with a set bit for a white pixel.
+
+#define NETPBM_CHUNK_BYTES 64 // stack buffer of the PBM rows, longer rows are streamed in several chunks
+
+namespace netpbm {
+
+enum class EFormat : uint8_t {
+    pbm, // P4
+    pgm, // P5
+    ppm  // P6
+};
+
+const char* formatToString(const EFormat format);
+
+struct Header {
+    EFormat format;
+    size_t width;
+    size_t height;
+    uint16_t maxValue; // 1 for a PBM, at most 255 (8 bit samples only)
+};
+
+// bytes of one row in the file
+size_t rowBytes(const EFormat format, const size_t width);
+
+bool writeHeader(std::FILE* file, const EFormat format, const size_t width, const size_t height);
+// leaves the file at the first pixel byte
+bool readHeader(std::FILE* file, Header& header);
+
+// One PBM row from / to width packed pixels (MSB first, a set bit is a white pixel) starting at bit offset of packed,
+// the layout of PrinterMatrix (offset = row * width) and of the RowDitherer rows (offset 0)
+bool writePackedRow(std::FILE* file, const uint8_t* packed, const size_t offset, const size_t width);
+bool readPackedRow(std::FILE* file, uint8_t* packed, const size_t offset, const size_t width);
+// Same conversion into memory, row gets rowBytes(EFormat::pbm, width) bytes
+void packedToRow(const uint8_t* packed, const size_t offset, const size_t width, uint8_t* row);
+
+bool write(std::FILE* file, const PrinterMatrix& mat);
+bool write(std::FILE* file, const Matrix<uint8_t>& mat);
+bool write(std::FILE* file, const Matrix<PIXELFORMAT_RGB>& mat);
+
+// Read into an existing matrix, only reallocated (for the same owner) when the size changes.
+// Samples of a file with a maxValue below 255 are rescaled to 0..255.
+bool read(std::FILE* file, PrinterMatrix& mat);
+bool read(std::FILE* file, Matrix<uint8_t>& mat);
+bool read(std::FILE* file, Matrix<PIXELFORMAT_RGB>& mat);
+
+}// namespace netpbm
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+
+#ifdef ARDUINO
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#else
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace pipeline {
+
+// Wake-up for a consumer task: producers notify, the consumer blocks in wait instead of polling.
+// Notifications don't stack, one wait consumes all the notifications made since the previous one.
+class Signal {
+private:
+#ifdef ARDUINO
+    StaticSemaphore_t buffer_;
+    SemaphoreHandle_t semaphore_;
+#else
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool set_;
+#endif
+
+public:
+#ifdef ARDUINO
+    Signal() : semaphore_{xSemaphoreCreateBinaryStatic(&buffer_)} {}
+#else
+    Signal() : set_{false} {}
+#endif
+
+    Signal(const Signal&) = delete;
+    Signal& operator=(const Signal&) = delete;
+
+    inline void notify() {
+#ifdef ARDUINO
+        xSemaphoreGive(semaphore_);
+#else
+        std::lock_guard<std::mutex> lock(mutex_);
+        set_ = true;
+        condition_.notify_one();
+#endif
+    }
+
+    // true when notified, false on timeout. While every task waits the idle task halts the CPU until the next interrupt.
+    inline bool wait(const uint32_t timeoutMs) {
+#ifdef ARDUINO
+        return xSemaphoreTake(semaphore_, timeoutMs / portTICK_PERIOD_MS) == pdTRUE;
+#else
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] { return set_; });
+        const bool notified = set_;
+        set_ = false;
+        return notified;
+#endif
+    }
+};
+
+}// namespace pipeline
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace pipeline {
+
+// Lock-free single producer / single consumer ring.
+// Only the producer calls push and only the consumer calls pop, each side owns one of the two counters.
+template <class T, size_t N>
+class SpscRing {
+private:
+    std::array<T, N> buffer_;
+    std::atomic<size_t> head_; // next slot to read, written by the consumer
+    std::atomic<size_t> tail_; // next slot to write, written by the producer
+
+public:
+    SpscRing() : buffer_{}, head_{0}, tail_{0} {}
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    bool push(const T& value) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if(tail - head_.load(std::memory_order_acquire) >= N) return false; // full
+
+        buffer_[tail % N] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& value) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if(head == tail_.load(std::memory_order_acquire)) return false; // empty
+
+        value = buffer_[head % N];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // approximate when called concurrently, fine for statistics
+    inline size_t size() const { return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire); }
+    inline bool empty() const { return size() == 0; }
+    inline constexpr size_t capacity() const { return N; }
+};
+
+}// namespace pipeline
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+
+#ifdef ARDUINO
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#else
+#include <chrono>
+#include <thread>
+#endif
+
+namespace pipeline {
+
+typedef void (*TaskFunction)(void* arg);
+
+// Start fn(arg) pinned on a core. On the host it runs on a detached std::thread, core and priority are ignored.
+inline bool startTask(const char* name, TaskFunction fn, void* arg, const uint32_t stackSize, const unsigned int priority, const int core) {
+#ifdef ARDUINO
+    return xTaskCreatePinnedToCore(fn, name, stackSize, arg, priority, nullptr, core) == pdPASS;
+#else
+    (void)name; (void)stackSize; (void)priority; (void)core;
+    std::thread(fn, arg).detach();
+    return true;
+#endif
+}
+
+// Let the other tasks run (and the idle task feed the watchdog)
+inline void sleepMs(const uint32_t ms) {
+#ifdef ARDUINO
+    vTaskDelay(ms / portTICK_PERIOD_MS > 0 ? ms / portTICK_PERIOD_MS : 1);
+#else
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+#endif
+}
+
+inline int64_t nowUs() {
+#ifdef ARDUINO
+    return esp_timer_get_time();
+#else
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+inline int currentCore() {
+#ifdef ARDUINO
+    return xPortGetCoreID();
+#else
+    return 0;
+#endif
+}
+
+}// namespace pipeline
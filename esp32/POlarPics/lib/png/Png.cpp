@@ -0,0 +1,404 @@
+#include "Png.h"
+
+#include "esp32-hal-log.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "Netpbm.h"
+
+namespace png {
+
+namespace {
+
+    #define PNG_MIN_MATCH 3
+    #define PNG_MAX_MATCH 258
+    #define PNG_MIN_LOOKAHEAD (PNG_MAX_MATCH + PNG_MIN_MATCH) // bytes kept ahead of the compressed position until the flush
+    #define PNG_ROW_BYTES (PNG_MAX_WIDTH / 8 + 1) // filter type byte included
+
+    const uint16_t noPosition = 0xFFFF;
+    const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+    // RFC 1951 3.2.5
+    const uint16_t lengthBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    const uint8_t lengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    const uint16_t distanceBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073,
+        4097, 6145, 8193, 12289, 16385, 24577};
+    const uint8_t distanceExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+    inline uint32_t reverseBits(uint32_t code, const size_t count) {
+        uint32_t reversed = 0;
+        for (size_t i = 0; i < count; ++i, code >>= 1) reversed = (reversed << 1) | (code & 1);
+        return reversed;
+    }
+
+    // fixed literal / length codes (RFC 1951 3.2.6), bit reversed since deflate packs Huffman codes from the MSB
+    struct FixedCodes {
+        uint16_t code[288];
+        uint8_t length[288];
+
+        FixedCodes() {
+            for (size_t s = 0; s < 288; ++s) {
+                uint32_t c;
+                if (s < 144) { c = 0x30 + s; length[s] = 8; }
+                else if (s < 256) { c = 0x190 + s - 144; length[s] = 9; }
+                else if (s < 280) { c = s - 256; length[s] = 7; }
+                else { c = 0xC0 + s - 280; length[s] = 8; }
+                code[s] = static_cast<uint16_t>(reverseBits(c, length[s]));
+            }
+        }
+    };
+
+    const FixedCodes& fixedCodes() {
+        static const FixedCodes codes;
+        return codes;
+    }
+
+    struct CrcTable {
+        uint32_t entries[256];
+
+        CrcTable() {
+            for (uint32_t n = 0; n < 256; ++n) {
+                uint32_t c = n;
+                for (size_t k = 0; k < 8; ++k) c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                entries[n] = c;
+            }
+        }
+    };
+
+    uint32_t crc(uint32_t value, const uint8_t* data, const size_t len) {
+        static const CrcTable table;
+        for (size_t i = 0; i < len; ++i) value = table.entries[(value ^ data[i]) & 0xFF] ^ (value >> 8);
+        return value;
+    }
+
+    uint32_t adler32(uint32_t adler, const uint8_t* data, size_t len) {
+        uint32_t a = adler & 0xFFFF;
+        uint32_t b = adler >> 16;
+        while (len > 0) {
+            const size_t block = len < 5552 ? len : 5552; // largest run without a 32 bit overflow
+            for (size_t i = 0; i < block; ++i) {
+                a += data[i];
+                b += a;
+            }
+            a %= 65521;
+            b %= 65521;
+            data += block;
+            len -= block;
+        }
+        return (b << 16) | a;
+    }
+
+    inline void putBigEndian(uint8_t* p, const uint32_t value) {
+        p[0] = value >> 24;
+        p[1] = value >> 16;
+        p[2] = value >> 8;
+        p[3] = value;
+    }
+
+    inline size_t hash(const uint8_t* p) {
+        return ((static_cast<uint32_t>(p[0]) << 16 | p[1] << 8 | p[2]) * 2654435761u) >> (32 - PNG_HASH_BITS);
+    }
+
+    inline uint8_t tailMask(const size_t width) {
+        return width % 8 == 0 ? 0xFF : static_cast<uint8_t>(0xFF << (8 - width % 8));
+    }
+
+    size_t absoluteSum(const uint8_t* data, const size_t len) {
+        size_t sum = 0;
+        for (size_t i = 0; i < len; ++i) {
+            const int8_t v = static_cast<int8_t>(data[i]);
+            sum += v < 0 ? -v : v;
+        }
+        return sum;
+    }
+
+    void applyFilter(const EFilter filter, const uint8_t* current, const uint8_t* previous, uint8_t* out, const size_t len) {
+        switch (filter) {
+            case EFilter::sub:
+                out[0] = current[0];
+                for (size_t i = 1; i < len; ++i) out[i] = current[i] - current[i - 1];
+                break;
+            case EFilter::up:
+                for (size_t i = 0; i < len; ++i) out[i] = current[i] - previous[i];
+                break;
+            default:
+                std::memcpy(out, current, len);
+                break;
+        }
+    }
+
+    // PNG filter type byte
+    uint8_t filterType(const EFilter filter) {
+        switch (filter) {
+            case EFilter::sub: return 1;
+            case EFilter::up: return 2;
+            default: return 0;
+        }
+    }
+}
+
+const char* filterToString(const EFilter filter) {
+    switch (filter) {
+        case EFilter::none: return "none";
+        case EFilter::sub: return "sub";
+        case EFilter::up: return "up";
+        case EFilter::adaptive: return "adaptive";
+        default: return "invalid";
+    }
+}
+
+bool writeFile(void* arg, const uint8_t* data, const size_t len) {
+    return std::fwrite(data, 1, len, static_cast<std::FILE*>(arg)) == len;
+}
+
+size_t maxBytes(const size_t width, const size_t height) {
+    // zlib header, block header, 9 bit literals and block end, Adler-32
+    const size_t deflated = 2 + (((width + 7) / 8 + 1) * height * 9 + 3 + 7 + 7) / 8 + 4;
+    const size_t chunks = deflated / PNG_IDAT_BYTES + 1;
+    return sizeof(signature) + 12 + 13 + deflated + chunks * 12 + 12;
+}
+
+Encoder::Encoder(const memory::EOwner owner) :
+    buffers_{owner}, chains_{owner}, write_{nullptr}, arg_{nullptr}, width_{0}, rowsLeft_{0}, maxChain_{0}, filter_{EFilter::none},
+    windowPos_{0}, windowEnd_{0}, outLen_{0}, bits_{0}, bitCount_{0}, adler_{1}, bytesOut_{0}, failed_{false} {}
+
+bool Encoder::emit(const uint8_t* data, const size_t len) {
+    if (failed_) return false;
+    if (!write_(arg_, data, len)) {
+        log_e("png: write failed after %zu bytes", bytesOut_);
+        failed_ = true;
+        return false;
+    }
+    bytesOut_ += len;
+    return true;
+}
+
+bool Encoder::chunk(const char* type, const uint8_t* data, const size_t len) {
+    uint8_t header[8];
+    putBigEndian(header, len);
+    std::memcpy(header + 4, type, 4);
+    uint8_t trailer[4];
+    putBigEndian(trailer, crc(crc(0xFFFFFFFFu, header + 4, 4), data, len) ^ 0xFFFFFFFFu);
+    return emit(header, 8) && (len == 0 || emit(data, len)) && emit(trailer, 4);
+}
+
+void Encoder::putByte(const uint8_t byte) {
+    out()[outLen_++] = byte;
+    if (outLen_ == PNG_IDAT_BYTES) {
+        chunk("IDAT", out(), outLen_);
+        outLen_ = 0;
+    }
+}
+
+// deflate packs the bits from the LSB of each byte
+void Encoder::putBits(const uint32_t bits, const size_t count) {
+    bits_ |= bits << bitCount_;
+    bitCount_ += count;
+    while (bitCount_ >= 8) {
+        putByte(bits_ & 0xFF);
+        bits_ >>= 8;
+        bitCount_ -= 8;
+    }
+}
+
+void Encoder::putLiteral(const uint8_t byte) {
+    const FixedCodes& codes = fixedCodes();
+    putBits(codes.code[byte], codes.length[byte]);
+}
+
+void Encoder::putMatch(const size_t length, const size_t distance) {
+    const FixedCodes& codes = fixedCodes();
+    size_t l = 0;
+    while (l < 28 && lengthBase[l + 1] <= length) ++l;
+    putBits(codes.code[257 + l], codes.length[257 + l]);
+    if (lengthExtra[l] != 0) putBits(length - lengthBase[l], lengthExtra[l]);
+
+    size_t d = 0;
+    while (d < 29 && distanceBase[d + 1] <= distance) ++d;
+    putBits(reverseBits(d, 5), 5);
+    if (distanceExtra[d] != 0) putBits(distance - distanceBase[d], distanceExtra[d]);
+}
+
+void Encoder::insert(const size_t pos) {
+    if (windowEnd_ - pos < PNG_MIN_MATCH) return;
+    uint16_t& head = heads()[hash(window() + pos)];
+    previous()[pos & (PNG_WINDOW_BYTES - 1)] = head;
+    head = static_cast<uint16_t>(pos);
+}
+
+// drop the oldest half of the window, positions move down with it
+void Encoder::slide() {
+    std::memmove(window(), window() + PNG_WINDOW_BYTES, PNG_WINDOW_BYTES);
+    windowPos_ -= PNG_WINDOW_BYTES;
+    windowEnd_ -= PNG_WINDOW_BYTES;
+    uint16_t* positions = chains_.data();
+    for (size_t i = 0; i < chains_.len(); ++i)
+        positions[i] = positions[i] == noPosition || positions[i] < PNG_WINDOW_BYTES ? noPosition : positions[i] - PNG_WINDOW_BYTES;
+}
+
+// greedy matching, a match needs PNG_MAX_MATCH bytes ahead unless this is the end of the data
+void Encoder::compress(const bool flush) {
+    const uint8_t* w = window();
+    while (windowPos_ < windowEnd_ && (flush || windowEnd_ - windowPos_ >= PNG_MIN_LOOKAHEAD)) {
+        size_t bestLength = 0;
+        size_t bestDistance = 0;
+        const size_t available = windowEnd_ - windowPos_;
+        if (maxChain_ > 0 && available >= PNG_MIN_MATCH) {
+            const size_t maxLength = available < PNG_MAX_MATCH ? available : PNG_MAX_MATCH;
+            uint16_t candidate = heads()[hash(w + windowPos_)];
+            for (size_t chain = maxChain_; candidate != noPosition && chain > 0; --chain) {
+                const size_t distance = windowPos_ - candidate;
+                if (distance >= PNG_WINDOW_BYTES) break;
+                if (w[candidate + bestLength] == w[windowPos_ + bestLength]) {
+                    size_t length = 0;
+                    while (length < maxLength && w[candidate + length] == w[windowPos_ + length]) ++length;
+                    if (length > bestLength) {
+                        bestLength = length;
+                        bestDistance = distance;
+                        if (length == maxLength) break;
+                    }
+                }
+                candidate = previous()[candidate & (PNG_WINDOW_BYTES - 1)];
+            }
+        }
+
+        if (bestLength >= PNG_MIN_MATCH) {
+            putMatch(bestLength, bestDistance);
+            for (size_t i = 0; i < bestLength; ++i) insert(windowPos_++);
+        } else {
+            if (maxChain_ > 0) insert(windowPos_);
+            putLiteral(w[windowPos_++]);
+        }
+    }
+}
+
+void Encoder::deflate(const uint8_t* data, size_t len) {
+    adler_ = adler32(adler_, data, len);
+    while (len > 0) {
+        if (windowEnd_ == 2 * PNG_WINDOW_BYTES) slide();
+        const size_t n = std::min(len, 2 * PNG_WINDOW_BYTES - windowEnd_);
+        std::memcpy(window() + windowEnd_, data, n);
+        windowEnd_ += n;
+        data += n;
+        len -= n;
+        compress(false);
+    }
+}
+
+bool Encoder::begin(const size_t width, const size_t height, WriteFn write, void* arg, const uint8_t level, const EFilter filter) {
+    if (width == 0 || width > PNG_MAX_WIDTH || height == 0 || level > 9) {
+        log_e("png: %zux%zu at level %u is not supported", width, height, level);
+        return false;
+    }
+    if (buffers_.data() == nullptr) buffers_ = Matrix<uint8_t>(2 * PNG_WINDOW_BYTES + PNG_IDAT_BYTES + 3 * PNG_ROW_BYTES, 1, buffers_.owner());
+    if (chains_.data() == nullptr) chains_ = Matrix<uint16_t>((1 << PNG_HASH_BITS) + PNG_WINDOW_BYTES, 1, chains_.owner());
+    if (buffers_.data() == nullptr || chains_.data() == nullptr) {
+        log_e("png: can't allocate the encoder");
+        return false;
+    }
+
+    write_ = write;
+    arg_ = arg;
+    width_ = width;
+    rowsLeft_ = height;
+    maxChain_ = level == 0 ? 0 : size_t(1) << (level - 1);
+    filter_ = filter;
+    windowPos_ = 0;
+    windowEnd_ = 0;
+    outLen_ = 0;
+    bits_ = 0;
+    bitCount_ = 0;
+    adler_ = 1;
+    bytesOut_ = 0;
+    failed_ = false;
+    std::fill(chains_.begin(), chains_.end(), noPosition);
+    std::fill(row(1), row(1) + PNG_ROW_BYTES, 0); // the row above the first one is zeros
+
+    uint8_t header[13];
+    putBigEndian(header, width);
+    putBigEndian(header + 4, height);
+    header[8] = 1; // bit depth
+    header[9] = 0; // grayscale
+    header[10] = 0; // deflate
+    header[11] = 0; // adaptive filtering
+    header[12] = 0; // no interlace
+    if (!emit(signature, sizeof(signature)) || !chunk("IHDR", header, sizeof(header))) return false;
+
+    // zlib header (deflate, no dictionary) then a single final fixed Huffman block
+    putByte(0x78);
+    putByte(0x01);
+    putBits(1, 1);
+    putBits(1, 2);
+    return !failed_;
+}
+
+bool Encoder::writeRows(const uint8_t* rows, const size_t count) {
+    if (count > rowsLeft_) {
+        log_e("png: %zu rows past the end of the image", count - rowsLeft_);
+        return false;
+    }
+
+    const size_t bytes = (width_ + 7) / 8;
+    uint8_t* current = row(0);
+    uint8_t* previous = row(1);
+    uint8_t* filtered = row(2);
+    for (size_t r = 0; r < count; ++r, rows += bytes) {
+        // a set PNG sample is white, the padding bits are cleared so they don't break runs
+        for (size_t i = 0; i < bytes; ++i) current[i] = ~rows[i];
+        current[bytes - 1] &= tailMask(width_);
+
+        EFilter chosen = filter_;
+        if (filter_ == EFilter::adaptive) {
+            size_t best = absoluteSum(current, bytes);
+            chosen = EFilter::none;
+            for (const EFilter candidate : {EFilter::sub, EFilter::up}) {
+                applyFilter(candidate, current, previous, filtered + 1, bytes);
+                const size_t sum = absoluteSum(filtered + 1, bytes);
+                if (sum < best) {
+                    best = sum;
+                    chosen = candidate;
+                }
+            }
+        }
+        filtered[0] = filterType(chosen);
+        applyFilter(chosen, current, previous, filtered + 1, bytes);
+        deflate(filtered, bytes + 1);
+        std::memcpy(previous, current, bytes);
+    }
+    rowsLeft_ -= count;
+    return !failed_;
+}
+
+bool Encoder::end() {
+    if (rowsLeft_ != 0) {
+        log_e("png: %zu rows missing", rowsLeft_);
+        return false;
+    }
+
+    compress(true);
+    const FixedCodes& codes = fixedCodes();
+    putBits(codes.code[256], codes.length[256]); // end of block
+    if (bitCount_ > 0) putBits(0, 8 - bitCount_);
+
+    uint8_t adler[4];
+    putBigEndian(adler, adler_);
+    for (const uint8_t byte : adler) putByte(byte);
+    if (outLen_ > 0) chunk("IDAT", out(), outLen_);
+    outLen_ = 0;
+    return chunk("IEND", nullptr, 0) && !failed_;
+}
+
+bool write(WriteFn write, void* arg, const PrinterMatrix& mat, const uint8_t level, const EFilter filter, const memory::EOwner owner) {
+    Encoder encoder(owner);
+    if (!encoder.begin(mat.width(), mat.height(), write, arg, level, filter)) return false;
+    uint8_t row[PNG_MAX_WIDTH / 8];
+    for (size_t r = 0; r < mat.height(); ++r) {
+        netpbm::packedToRow(mat.data(), r * mat.width(), mat.width(), row);
+        if (!encoder.writeRows(row, 1)) return false;
+    }
+    return encoder.end();
+}
+
+}// namespace png
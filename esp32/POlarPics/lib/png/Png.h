@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Matrix.h"
+#include "PrinterMatrix.h"
+
+// Streaming 1 bit grayscale PNG encoder with a bounded memory (about 12 KB whatever the image size).
+// The deflate stream is a single fixed Huffman block (no code tables to build nor send) with LZ77 matches searched
+// in a small window through hash chains, the level is the longest chain walked. IDAT chunks are written as the
+// output buffer fills, nothing but the window and the previous row is kept.
+
+#define PNG_WINDOW_BYTES 2048 // LZ77 window, matches are at most that far back
+#define PNG_HASH_BITS 11 // hash chain heads, 2^bits entries
+#define PNG_IDAT_BYTES 1024 // compressed bytes per IDAT chunk
+#define PNG_MAX_WIDTH 2048 // pixels per row
+#define PNG_DEFAULT_LEVEL 3
+
+namespace png {
+
+// Row filter, 1 bit pixels are filtered byte by byte
+enum class EFilter : uint8_t {
+    none,
+    sub, // previous byte of the row
+    up, // same byte of the previous row, long runs of identical rows become runs of zeros
+    adaptive // per row the one with the smallest sum of absolute values (the libpng heuristic) among the above
+};
+
+const char* filterToString(const EFilter filter);
+
+// Receives the PNG bytes, false aborts the encode
+typedef bool (*WriteFn)(void* arg, const uint8_t* data, const size_t len);
+
+// WriteFn of a std::FILE*
+bool writeFile(void* arg, const uint8_t* data, const size_t len);
+
+// Largest PNG the Encoder can produce for that size: every byte a 9 bit literal, for a buffer encoded frames go to
+size_t maxBytes(const size_t width, const size_t height);
+
+class Encoder {
+private:
+    Matrix<uint8_t> buffers_; // window (2 x PNG_WINDOW_BYTES), IDAT output, current and previous filtered rows
+    Matrix<uint16_t> chains_; // hash heads then the previous position of each window position
+    WriteFn write_;
+    void* arg_;
+    size_t width_;
+    size_t rowsLeft_;
+    size_t maxChain_; // 0: literals only
+    EFilter filter_;
+
+    size_t windowPos_; // next window byte to compress
+    size_t windowEnd_; // window bytes filled
+    size_t outLen_; // bytes in the IDAT buffer
+    uint32_t bits_;
+    size_t bitCount_;
+    uint32_t adler_;
+    size_t bytesOut_;
+    bool failed_;
+
+    uint8_t* window() { return buffers_.data(); }
+    uint8_t* out() { return buffers_.data() + 2 * PNG_WINDOW_BYTES; }
+    uint8_t* row(const size_t i) { return buffers_.data() + 2 * PNG_WINDOW_BYTES + PNG_IDAT_BYTES + i * (PNG_MAX_WIDTH / 8 + 1); }
+    uint16_t* heads() { return chains_.data(); }
+    uint16_t* previous() { return chains_.data() + (1 << PNG_HASH_BITS); }
+
+    bool emit(const uint8_t* data, const size_t len);
+    bool chunk(const char* type, const uint8_t* data, const size_t len);
+    void putByte(const uint8_t byte);
+    void putBits(const uint32_t bits, const size_t count);
+    void putLiteral(const uint8_t byte);
+    void putMatch(const size_t length, const size_t distance);
+    void insert(const size_t pos);
+    void slide();
+    void compress(const bool flush);
+    void deflate(const uint8_t* data, size_t len);
+
+public:
+    explicit Encoder(const memory::EOwner owner = memory::EOwner::unknown);
+
+    // level 0 only codes literals, 1 to 9 walk up to 2^(level - 1) hash chain entries per match
+    bool begin(const size_t width, const size_t height, WriteFn write, void* arg,
+        const uint8_t level = PNG_DEFAULT_LEVEL, const EFilter filter = EFilter::none);
+    // rows in the thermal dot convention, byte padded (netpbm P4, printing::Band and gallery layout)
+    bool writeRows(const uint8_t* rows, const size_t count);
+    // once every row is written: the end of the deflate stream and IEND
+    bool end();
+
+    inline size_t rowsLeft() const { return rowsLeft_; }
+    // PNG bytes given to write so far
+    inline size_t bytesOut() const { return bytesOut_; }
+};
+
+// Whole PrinterMatrix (a set bit is white) through an Encoder
+bool write(WriteFn write, void* arg, const PrinterMatrix& mat, const uint8_t level = PNG_DEFAULT_LEVEL,
+    const EFilter filter = EFilter::none, const memory::EOwner owner = memory::EOwner::unknown);
+
+}// namespace png
@@ -0,0 +1,89 @@
+#include "CaptureTee.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "esp32-hal-log.h"
+
+#include "Task.h"
+
+namespace thermal {
+
+namespace {
+    inline void put16(uint8_t* p, const uint16_t v) { p[0] = v & 0xFF; p[1] = v >> 8; }
+    inline void put32(uint8_t* p, const uint32_t v) { put16(p, v & 0xFFFF); put16(p + 2, v >> 16); }
+}
+
+CaptureTee::CaptureTee(Print& out, const memory::EOwner owner) :
+    out_{&out}, buffer_{owner}, file_{nullptr}, used_{0}, startUs_{0}, bytesCaptured_{0}, failed_{false} {}
+
+bool CaptureTee::open(const char* path, const PrinterSettings& settings) {
+    close();
+    if (buffer_.data() == nullptr) buffer_ = Matrix<uint8_t>(CAPTURE_BUFFER_BYTES, 1, buffer_.owner());
+    if (buffer_.data() == nullptr) {
+        log_e("capture: can't allocate the buffer");
+        return false;
+    }
+    file_ = std::fopen(path, "wb");
+    if (file_ == nullptr) {
+        log_e("capture: can't create %s", path);
+        return false;
+    }
+
+    uint8_t header[CAPTURE_HEADER_BYTES] = {};
+    std::memcpy(header, CAPTURE_MAGIC, 8);
+    put32(header + 8, CAPTURE_VERSION);
+    put32(header + 12, settings.baud);
+    header[16] = static_cast<uint8_t>(settings.command);
+    used_ = 0;
+    bytesCaptured_ = 0;
+    failed_ = std::fwrite(header, 1, sizeof(header), file_) != sizeof(header);
+    startUs_ = pipeline::nowUs();
+    return !failed_;
+}
+
+bool CaptureTee::writeBuffer() {
+    if (!failed_ && used_ > 0 && std::fwrite(buffer_.data(), 1, used_, file_) != used_) {
+        log_e("capture: write failed after %zu bytes", bytesCaptured_);
+        failed_ = true;
+    }
+    used_ = 0;
+    return !failed_;
+}
+
+bool CaptureTee::close() {
+    if (file_ == nullptr) return true;
+    writeBuffer();
+    const bool ok = std::fclose(file_) == 0 && !failed_;
+    file_ = nullptr;
+    return ok;
+}
+
+// the time is taken when the driver hands the bytes over, before the UART has sent them
+void CaptureTee::record(const uint8_t* data, size_t size) {
+    const uint32_t timeUs = static_cast<uint32_t>(pipeline::nowUs() - startUs_); // wraps after 71 minutes
+    while (size > 0 && !failed_) {
+        const size_t n = std::min<size_t>(size, CAPTURE_BUFFER_BYTES - CAPTURE_RECORD_HEADER_BYTES);
+        if (used_ + CAPTURE_RECORD_HEADER_BYTES + n > CAPTURE_BUFFER_BYTES && !writeBuffer()) return;
+
+        uint8_t* p = buffer_.data() + used_;
+        put32(p, timeUs);
+        put16(p + 4, static_cast<uint16_t>(n));
+        std::memcpy(p + CAPTURE_RECORD_HEADER_BYTES, data, n);
+        used_ += CAPTURE_RECORD_HEADER_BYTES + n;
+        bytesCaptured_ += n;
+        data += n;
+        size -= n;
+    }
+}
+
+size_t CaptureTee::write(const uint8_t byte) {
+    return write(&byte, 1);
+}
+
+size_t CaptureTee::write(const uint8_t* data, const size_t size) {
+    if (file_ != nullptr) record(data, size);
+    return out_->write(data, size);
+}
+
+}// namespace thermal
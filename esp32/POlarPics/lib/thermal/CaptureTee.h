@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Print.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "Matrix.h"
+#include "RasterPrinter.h"
+
+// Printer byte stream recorder: a Print in front of the printer output that forwards every write untouched and,
+// while a capture is open, also appends it to a file with the time it was written. The records go through a RAM
+// buffer written to the file when full or on close, most rows never wait for the SD card.
+// File layout, little endian: header {"POLARCAP", uint32 version, uint32 baud, uint8 raster command, 3 zero bytes},
+// then records {uint32 us since open, uint16 length, the bytes}. tools/replayPrint.py replays it.
+
+#define CAPTURE_MAGIC "POLARCAP" // 8 bytes, no terminator in the file
+#define CAPTURE_VERSION 1
+#define CAPTURE_HEADER_BYTES 20
+#define CAPTURE_RECORD_HEADER_BYTES 6
+#define CAPTURE_BUFFER_BYTES 4096 // records buffered before a file write, a larger write is split
+
+namespace thermal {
+
+class CaptureTee : public Print {
+private:
+    Print* out_;
+    Matrix<uint8_t> buffer_;
+    std::FILE* file_;
+    size_t used_; // bytes of buffer_ not written yet
+    int64_t startUs_;
+    size_t bytesCaptured_;
+    bool failed_; // a file write failed, the rest of the capture is dropped
+
+    void record(const uint8_t* data, size_t size);
+    bool writeBuffer();
+
+public:
+    explicit CaptureTee(Print& out, const memory::EOwner owner = memory::EOwner::unknown);
+    ~CaptureTee() { close(); }
+
+    // Start recording to path (overwritten), the settings go in the header for the replay
+    bool open(const char* path, const PrinterSettings& settings);
+    // write what is still buffered, false when some of the capture was lost
+    bool close();
+
+    inline bool isOpen() const { return file_ != nullptr; }
+    // printer bytes recorded since open
+    inline size_t bytesCaptured() const { return bytesCaptured_; }
+
+    size_t write(uint8_t byte) override;
+    size_t write(const uint8_t* data, size_t size) override;
+};
+
+}// namespace thermal
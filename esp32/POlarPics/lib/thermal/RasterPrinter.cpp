@@ -0,0 +1,123 @@
+#include "RasterPrinter.h"
+
+#include <algorithm>
+
+#include "Task.h"
+
+namespace thermal {
+
+namespace {
+    const uint8_t ESC = 0x1B;
+    const uint8_t GS = 0x1D;
+    const uint8_t DC2 = 0x12;
+
+    inline uint8_t popcount(const uint8_t b) { return static_cast<uint8_t>(__builtin_popcount(b)); }
+}
+
+RasterPrinter::RasterPrinter(Print& out, const PrinterSettings& settings) :
+    out_{&out}, settings_(settings), wireDoneUs_{0}, printDoneUs_{0}, bytesSent_{0}, dotLines_{0} {}
+
+void RasterPrinter::write(const uint8_t* data, const size_t size) {
+    out_->write(data, size);
+    bytesSent_ += size;
+
+    const int64_t now = pipeline::nowUs();
+    wireDoneUs_ = std::max(wireDoneUs_, now) + static_cast<int64_t>(size) * byteUs();
+}
+
+void RasterPrinter::writeBytes(const uint8_t a, const uint8_t b, const uint8_t c) {
+    const uint8_t bytes[] = {a, b, c};
+    write(bytes, sizeof(bytes));
+}
+
+void RasterPrinter::writeHeader(const size_t rowBytes, const size_t rows) {
+    if (settings_.command == ERasterCommand::gsV0) {
+        const uint8_t header[] = {GS, 'v', '0', 0,
+            static_cast<uint8_t>(rowBytes), static_cast<uint8_t>(rowBytes >> 8),
+            static_cast<uint8_t>(rows), static_cast<uint8_t>(rows >> 8)};
+        write(header, sizeof(header));
+    } else {
+        const uint8_t header[] = {DC2, '*', static_cast<uint8_t>(rows), static_cast<uint8_t>(rowBytes)};
+        write(header, sizeof(header));
+    }
+}
+
+uint32_t RasterPrinter::dotLineUs(const uint8_t* row, const size_t rowBytes) const {
+    size_t dots = 0;
+    for (size_t i = 0; i < rowBytes; ++i) dots += popcount(row[i]);
+
+    const size_t dotsPerPass = (settings_.maxHeatingDots + 1) * 8;
+    const size_t passes = (dots + dotsPerPass - 1) / dotsPerPass;
+    return std::max<uint32_t>(settings_.feedUs, passes * settings_.heatTime * 10 + settings_.heatInterval * 10);
+}
+
+// Wait while the rows received but not printed yet would overflow the printer buffer
+void RasterPrinter::waitBuffer(const size_t rowBytes, const uint32_t lineUs) {
+    const int64_t maxAheadUs = static_cast<int64_t>(settings_.bufferBytes / rowBytes) * lineUs;
+    for(;;) {
+        const int64_t aheadUs = printDoneUs_ - std::max(pipeline::nowUs(), wireDoneUs_);
+        if (aheadUs <= maxAheadUs) return;
+        pipeline::sleepMs(static_cast<uint32_t>((aheadUs - maxAheadUs) / 1000) + 1);
+    }
+}
+
+void RasterPrinter::begin() {
+    wake();
+
+    const uint8_t reset[] = {ESC, '@'};
+    write(reset, sizeof(reset));
+
+    const uint8_t heat[] = {ESC, '7', settings_.maxHeatingDots, settings_.heatTime, settings_.heatInterval};
+    write(heat, sizeof(heat));
+
+    writeBytes(DC2, '#', static_cast<uint8_t>(settings_.breakTime << 5 | settings_.density));
+    waitIdle();
+}
+
+void RasterPrinter::printRows(const uint8_t* rows, const size_t rowBytes, const size_t count) {
+    for (size_t first = 0; first < count; first += maxRowsPerCommand()) {
+        const size_t chunk = std::min(count - first, maxRowsPerCommand());
+        writeHeader(rowBytes, chunk);
+
+        for (size_t r = first; r < first + chunk; ++r) {
+            const uint8_t* row = rows + r * rowBytes;
+            const uint32_t lineUs = dotLineUs(row, rowBytes);
+            waitBuffer(rowBytes, lineUs);
+            write(row, rowBytes);
+            printDoneUs_ = std::max(printDoneUs_, wireDoneUs_) + lineUs;
+        }
+        dotLines_ += chunk;
+    }
+}
+
+void RasterPrinter::feedRows(size_t count) {
+    while (count > 0) {
+        const uint8_t n = static_cast<uint8_t>(std::min<size_t>(count, 255));
+        writeBytes(ESC, 'J', n);
+        printDoneUs_ = std::max(printDoneUs_, wireDoneUs_) + static_cast<int64_t>(n) * settings_.feedUs;
+        count -= n;
+    }
+}
+
+void RasterPrinter::sleep() {
+    waitIdle();
+    writeBytes(ESC, '8', 1); // asleep after 1 s
+    const uint8_t zero = 0; // high byte of the delay (firmware >= 2.64)
+    write(&zero, 1);
+}
+
+void RasterPrinter::wake() {
+    const uint8_t wakeByte = 0xFF;
+    write(&wakeByte, 1);
+    pipeline::sleepMs(50);
+    const uint8_t noSleep[] = {ESC, '8', 0, 0};
+    write(noSleep, sizeof(noSleep));
+}
+
+void RasterPrinter::waitIdle() {
+    const int64_t doneUs = std::max(printDoneUs_, wireDoneUs_);
+    const int64_t now = pipeline::nowUs();
+    if (doneUs > now) pipeline::sleepMs(static_cast<uint32_t>((doneUs - now) / 1000) + 1);
+}
+
+}// namespace thermal
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Print.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace thermal {
+
+enum class ERasterCommand {
+    gsV0, // GS v 0 m xL xH yL yH, up to 65535 rows per command
+    dc2Star // DC2 * r n, up to 255 rows per command (what Adafruit_Thermal::printBitmap sends)
+};
+
+struct PrinterSettings {
+    uint32_t baud;
+    uint8_t maxHeatingDots; // heated together: (maxHeatingDots + 1) * 8 dots
+    uint8_t heatTime; // 10 us units
+    uint8_t heatInterval; // 10 us units
+    uint8_t density;
+    uint8_t breakTime;
+    uint32_t feedUs; // paper motion for one dot row
+    size_t bufferBytes; // printer receive buffer, sending is paced so it never overflows
+    ERasterCommand command;
+};
+
+// Adafruit_Thermal::begin() defaults
+constexpr PrinterSettings defaultSettings {9600, 11, 120, 40, 10, 2, 2100, 1024, ERasterCommand::gsV0};
+
+// Native ESC/POS raster encoder: packed rows (a set bit burns a dot) are sent in maximal chunks.
+// Pacing follows a model of the printer (wire time from the baud rate, burn time from the heat settings) instead of fixed per row timeouts.
+class RasterPrinter {
+private:
+    Print* out_;
+    PrinterSettings settings_;
+
+    int64_t wireDoneUs_; // when the last byte written reaches the printer
+    int64_t printDoneUs_; // when the printer is done with everything received
+
+    size_t bytesSent_;
+    size_t dotLines_;
+
+    void write(const uint8_t* data, const size_t size);
+    void writeBytes(const uint8_t a, const uint8_t b, const uint8_t c);
+    void writeHeader(const size_t rowBytes, const size_t rows);
+    void waitBuffer(const size_t rowBytes, const uint32_t lineUs);
+
+public:
+    RasterPrinter(Print& out, const PrinterSettings& settings = defaultSettings);
+
+    // wake, reset and heat configuration
+    void begin();
+
+    // rows of rowBytes bytes (at most 48), sent with as few raster commands as possible
+    void printRows(const uint8_t* rows, const size_t rowBytes, const size_t count);
+    void feedRows(size_t count);
+
+    void sleep();
+    void wake();
+
+    // block until the printer model says everything has been printed
+    void waitIdle();
+
+    // burn time of one dot row
+    uint32_t dotLineUs(const uint8_t* row, const size_t rowBytes) const;
+    inline uint32_t byteUs() const { return (10 * 1000000 + settings_.baud / 2) / settings_.baud; } // 8N1
+
+    inline const PrinterSettings& settings() const { return settings_; }
+    inline size_t bytesSent() const { return bytesSent_; }
+    inline size_t dotLines() const { return dotLines_; }
+    inline size_t headerBytes() const { return settings_.command == ERasterCommand::gsV0 ? 8 : 4; }
+    inline size_t maxRowsPerCommand() const { return settings_.command == ERasterCommand::gsV0 ? 65535 : 255; }
+};
+
+}// namespace thermal
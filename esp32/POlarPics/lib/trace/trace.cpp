@@ -0,0 +1,120 @@
+#include "trace.h"
+
+namespace trace {
+
+const char* stageToString(const EStage stage) {
+    switch (stage) {
+        case stageCapture: return "capture";
+        case stageDecode: return "decode";
+        case stageGrayscale: return "grayscale";
+        case stageDither: return "dither";
+        case stageDisplay: return "display";
+        case stagePrint: return "print";
+        case stageMenu: return "menu";
+        default: return "unknown";
+    }
+}
+
+const char* counterToString(const ECounter counter) {
+    switch (counter) {
+        case counterPrintQueue: return "print queue";
+        case counterReadyFrames: return "ready frames";
+        default: return "unknown";
+    }
+}
+
+}// namespace trace
+
+#ifdef POLARPICS_TRACE
+
+#include <array>
+#include <atomic>
+
+#include "Task.h"
+
+namespace trace {
+
+namespace {
+    std::array<Event, TRACE_RING_SIZE> ring;
+    std::atomic<uint32_t> next {0}; // total events recorded, the slot is next % TRACE_RING_SIZE
+
+    // copy kept out of the ring while the (slow) serial output runs
+    std::array<Event, TRACE_RING_SIZE> exported;
+
+    inline void push(const Event& event) {
+        const uint32_t slot = next.fetch_add(1, std::memory_order_relaxed) % TRACE_RING_SIZE;
+        ring[slot] = event;
+    }
+
+    inline uint8_t core() { return static_cast<uint8_t>(pipeline::currentCore()); }
+}
+
+void record(const EStage stage, const int64_t startUs, const int64_t endUs, const uint32_t frameId) {
+    push(Event{EEventKind::span, stage, core(), frameId, startUs, endUs});
+}
+
+void sample(const ECounter counter, const uint32_t value) {
+    const int64_t now = pipeline::nowUs();
+    push(Event{EEventKind::counter, counter, core(), value, now, now});
+}
+
+size_t snapshot(Event* out, const size_t maxEvents) {
+    const uint32_t end = next.load(std::memory_order_acquire);
+    const uint32_t available = end < TRACE_RING_SIZE ? end : TRACE_RING_SIZE;
+    const uint32_t count = available < maxEvents ? available : static_cast<uint32_t>(maxEvents);
+
+    for (uint32_t i = 0; i < count; ++i) out[i] = ring[(end - count + i) % TRACE_RING_SIZE];
+    return count;
+}
+
+uint32_t recorded() { return next.load(); }
+
+void clear() { next = 0; }
+
+void dump(std::FILE* out) {
+    const size_t count = snapshot(exported.data(), exported.size());
+
+    std::fprintf(out, "stage,core,frame,start_us,end_us,duration_us\n");
+    for (size_t i = 0; i < count; ++i) {
+        const Event& e = exported[i];
+        if (e.kind != EEventKind::span) continue;
+        std::fprintf(out, "%s,%u,%u,%lld,%lld,%lld\n", stageToString(static_cast<EStage>(e.id)), static_cast<unsigned>(e.core), static_cast<unsigned>(e.value),
+            static_cast<long long>(e.startUs), static_cast<long long>(e.endUs), static_cast<long long>(e.endUs - e.startUs));
+    }
+    std::fprintf(out, "# %u events, %u recorded since the last clear\n", static_cast<unsigned>(count), static_cast<unsigned>(recorded()));
+}
+
+void exportChromeTrace(std::FILE* out, const bool markers) {
+    const size_t count = snapshot(exported.data(), exported.size());
+
+    if (markers) std::fprintf(out, "\n# trace begin\n");
+    std::fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+    // track names, tid is the core
+    std::fprintf(out, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"POlarPics\"}}");
+    for (unsigned c = 0; c < 2; ++c)
+        std::fprintf(out, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"core %u\"}}", c, c);
+
+    for (size_t i = 0; i < count; ++i) {
+        const Event& e = exported[i];
+        if (e.kind == EEventKind::span) {
+            std::fprintf(out, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%lld,\"dur\":%lld,\"args\":{\"id\":%u}}",
+                stageToString(static_cast<EStage>(e.id)), static_cast<unsigned>(e.core),
+                static_cast<long long>(e.startUs), static_cast<long long>(e.endUs - e.startUs), static_cast<unsigned>(e.value));
+        } else {
+            std::fprintf(out, ",\n{\"name\":\"%s\",\"ph\":\"C\",\"pid\":0,\"ts\":%lld,\"args\":{\"value\":%u}}",
+                counterToString(static_cast<ECounter>(e.id)), static_cast<long long>(e.startUs), static_cast<unsigned>(e.value));
+        }
+    }
+
+    std::fprintf(out, "\n]}\n");
+    if (markers) std::fprintf(out, "# trace end\n");
+}
+
+ScopedTimer::ScopedTimer(const EStage stage, const uint32_t frameId) : stage_{stage}, frameId_{frameId}, startUs_{pipeline::nowUs()} {}
+
+ScopedTimer::~ScopedTimer() { record(stage_, startUs_, pipeline::nowUs(), frameId_); }
+
+}// namespace trace
+
+#endif // POLARPICS_TRACE
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+// Stage timing into a fixed-size ring buffer, only compiled in with -DPOLARPICS_TRACE.
+// Without it the TRACE_* macros expand to nothing, only the stage names are left (the governor logs them).
+
+#define TRACE_RING_SIZE 256 // events kept (24 bytes each), the oldest ones are overwritten
+
+namespace trace {
+
+// the stages of a preview frame come first, the governor times those (governor::StageTimes)
+enum EStage : uint8_t {
+    stageCapture,
+    stageDecode,
+    stageGrayscale,
+    stageDither,
+    stageDisplay,
+    stagePreviewCount,
+    stagePrint = stagePreviewCount,
+    stageMenu,
+    stageCount
+};
+
+const char* stageToString(const EStage stage);
+
+// sampled values drawn as counter tracks
+enum ECounter : uint8_t {
+    counterPrintQueue, // print jobs waiting or printing
+    counterReadyFrames, // preview frames waiting for loop()
+    counterCount
+};
+
+const char* counterToString(const ECounter counter);
+
+enum class EEventKind : uint8_t {
+    span,
+    counter
+};
+
+struct Event {
+    EEventKind kind;
+    uint8_t id; // EStage or ECounter
+    uint8_t core;
+    uint32_t value; // preview frame or print job of a span, value of a counter
+    int64_t startUs;
+    int64_t endUs; // same as startUs for a counter
+};
+
+// Safe from any task or core, a slot is claimed with a single atomic increment
+void record(const EStage stage, const int64_t startUs, const int64_t endUs, const uint32_t frameId);
+void sample(const ECounter counter, const uint32_t value);
+
+// Copy the events still in the ring, oldest first, returns the number copied.
+// Events recorded during the copy may come out torn, stop the producers for an exact snapshot.
+size_t snapshot(Event* out, const size_t maxEvents);
+
+// Events recorded since the last clear (or boot), including the overwritten ones
+uint32_t recorded();
+
+void clear();
+
+// CSV of the ring content (stage,core,frame,start_us,end_us,duration_us), stdout is the serial port on the device.
+// That port is also the printer line: unplug the printer and read it with a USB-serial adapter, main.cpp skips the dump while printing.
+void dump(std::FILE* out = stdout);
+
+// Chrome trace JSON of the ring content (chrome://tracing, ui.perfetto.dev): one track per core and one per counter.
+// With markers the JSON is framed by "# trace begin" / "# trace end" lines to pick it out of a serial log (tools/extractTrace.py).
+// Same port as the printer, see dump().
+void exportChromeTrace(std::FILE* out = stdout, const bool markers = true);
+
+class ScopedTimer {
+private:
+    EStage stage_;
+    uint32_t frameId_;
+    int64_t startUs_;
+
+public:
+    ScopedTimer(const EStage stage, const uint32_t frameId);
+    ~ScopedTimer();
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+
+}// namespace trace
+
+#ifdef POLARPICS_TRACE
+    #define TRACE_CONCAT_(a, b) a##b
+    #define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+    // time the rest of the enclosing block
+    #define TRACE_SCOPE(stage, frameId) trace::ScopedTimer TRACE_CONCAT(traceScope_, __LINE__)(trace::stage, frameId)
+    // record a span already measured
+    #define TRACE_RECORD(stage, startUs, endUs, frameId) trace::record(trace::stage, startUs, endUs, frameId)
+    #define TRACE_COUNTER(counter, value) trace::sample(trace::counter, value)
+#else
+    #define TRACE_SCOPE(stage, frameId) do {} while (0)
+    #define TRACE_RECORD(stage, startUs, endUs, frameId) do {} while (0)
+    #define TRACE_COUNTER(counter, value) do {} while (0)
+#endif
@@ -0,0 +1,240 @@
+#ifdef POLARPICS_BENCH
+
+#include "bench.hpp"
+
+#include <Arduino.h>
+
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "img_converters.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "Matrix.h"
+#include "PrinterMatrix.h"
+#include "MemoryAccounting.h"
+#include "filtering.h"
+#include "capture.hpp"
+#include "printing.hpp"
+#include "Netpbm.h"
+#include "Png.h"
+#include "FaxG4.h"
+
+#include "benchPhoto.h"
+
+namespace bench {
+
+    namespace {
+
+        enum EContent {
+            contentFlat,
+            contentGradient,
+            contentPhoto,
+            contentCount
+        };
+
+        const char* contentToString(const EContent content) {
+            switch (content) {
+                case contentFlat: return "flat";
+                case contentGradient: return "gradient";
+                case contentPhoto: return "photo";
+                default: return "unknown";
+            }
+        }
+
+        const framesize_t framesizes[] = { FRAMESIZE_QQVGA, FRAMESIZE_QVGA, FRAMESIZE_VGA, FRAMESIZE_SVGA, FRAMESIZE_XGA, FRAMESIZE_SXGA, FRAMESIZE_UXGA };
+        const float thresholds[] = { 0.35f, 0.5f, 0.65f };
+
+        // The dithering diffuses the error in place, the input is written again before every run
+        void fill(Matrix<uint8_t>& mat, const EContent content, const Matrix<uint8_t>& photo) {
+            const size_t cols = mat.width();
+            const size_t rows = mat.height();
+            switch (content) {
+                case contentFlat:
+                    std::fill(mat.begin(), mat.end(), 128);
+                    break;
+                case contentGradient:
+                    for (size_t r = 0; r < rows; ++r)
+                        for (size_t c = 0; c < cols; ++c)
+                            mat(r, c) = static_cast<uint8_t>(c * 255 / (cols - 1));
+                    break;
+                case contentPhoto: // nearest neighbour, the photo is smaller than most of the resolutions
+                    for (size_t r = 0; r < rows; ++r) {
+                        const size_t photoRow = r * photo.height() / rows;
+                        for (size_t c = 0; c < cols; ++c)
+                            mat(r, c) = photo(photoRow, c * photo.width() / cols);
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        // Loads and stores the dithering loop makes: the source pixel, the packed output byte (read modify write)
+        // and a read and a write for every tap of the pattern that lands inside the image
+        size_t bytesTouched(const std::vector<filtering::PatternPart>& pattern, const size_t cols, const size_t rows) {
+            size_t bytes = cols * rows * 3;
+            for (const filtering::PatternPart& part : pattern) {
+                const size_t dc = static_cast<size_t>(std::abs(part.deltaCols));
+                const size_t dr = static_cast<size_t>(part.deltaRows);
+                if (dc < cols && dr < rows)
+                    bytes += 2 * (cols - dc) * (rows - dr);
+            }
+            return bytes;
+        }
+
+        struct CodecConfig {
+            const char* codec;
+            uint8_t level;
+            png::EFilter filter;
+        };
+
+        const CodecConfig codecConfigs[] = {
+            {"png", 0, png::EFilter::none}, {"png", 1, png::EFilter::none}, {"png", 2, png::EFilter::none}, {"png", 3, png::EFilter::none},
+            {"png", 3, png::EFilter::sub}, {"png", 3, png::EFilter::up}, {"png", 3, png::EFilter::adaptive}, {"png", 6, png::EFilter::none},
+            {"g4", 0, png::EFilter::none}
+        };
+
+        bool countBytes(void* arg, const uint8_t* data, const size_t len) {
+            *static_cast<size_t*>(arg) += len;
+            return true;
+        }
+
+        // the frame row by row, like the gallery and the server feed the encoders, returns the encoded bytes
+        size_t encode(const CodecConfig& config, const PrinterMatrix& frame, png::Encoder& pngEncoder, ccitt::G4Encoder& g4Encoder) {
+            size_t bytes = 0;
+            const bool isPng = std::strcmp(config.codec, "png") == 0;
+            if (isPng ? !pngEncoder.begin(frame.width(), frame.height(), countBytes, &bytes, config.level, config.filter) :
+                !g4Encoder.begin(frame.width(), frame.height(), countBytes, &bytes)) return 0;
+            uint8_t row[PRINTER_WIDTH / 8];
+            for (size_t r = 0; r < frame.height(); ++r) {
+                netpbm::packedToRow(frame.data(), r * frame.width(), frame.width(), row);
+                if (isPng ? !pngEncoder.writeRows(row, 1) : !g4Encoder.writeRows(row, 1)) return 0;
+            }
+            return (isPng ? pngEncoder.end() : g4Encoder.end()) ? bytes : 0;
+        }
+
+        void runCodecs(const Matrix<uint8_t>& photo, const bool hasPhoto) {
+            const size_t cols = PRINTER_WIDTH;
+            const size_t rows = hasPhoto ? PRINTER_WIDTH * photo.height() / photo.width() : PRINTER_WIDTH * 3 / 4;
+            Matrix<uint8_t> input(cols, rows, memory::EOwner::dither);
+            PrinterMatrix frame(cols, rows, memory::EOwner::dither);
+            png::Encoder pngEncoder {memory::EOwner::dither};
+            ccitt::G4Encoder g4Encoder {memory::EOwner::dither};
+            if (input.data() == nullptr || frame.data() == nullptr) {
+                log_w("bench: not enough memory for the codec frame, skipped");
+                return;
+            }
+            const size_t rawBytes = netpbm::rowBytes(netpbm::EFormat::pbm, cols) * rows;
+
+            printf("# codec begin\n");
+            printf("codec,level,filter,width,height,content,repeats,bytes,ratio,ns_per_pixel\n");
+            for (size_t content = 0; content < contentCount; ++content) {
+                if (content == contentPhoto && !hasPhoto) continue;
+                fill(input, static_cast<EContent>(content), photo);
+                filtering::errorDiffusionPrinter(input, frame, 0.5f, filtering::EFilteringMethod::floydSteinberg);
+
+                for (const CodecConfig& config : codecConfigs) {
+                    size_t bytes = 0;
+                    int64_t elapsedUs = 0;
+                    for (size_t i = 0; i < BENCH_CODEC_REPEATS; ++i) {
+                        const int64_t start = esp_timer_get_time();
+                        bytes = encode(config, frame, pngEncoder, g4Encoder);
+                        elapsedUs += esp_timer_get_time() - start;
+                        delay(1);
+                    }
+                    if (bytes == 0) continue;
+                    printf("%s,%u,%s,%u,%u,%s,%u,%u,%.2f,%.2f\n", config.codec, config.level, png::filterToString(config.filter), cols, rows,
+                        contentToString(static_cast<EContent>(content)), BENCH_CODEC_REPEATS, bytes, static_cast<double>(rawBytes) / bytes,
+                        elapsedUs * 1000.0 / (static_cast<double>(cols) * rows * BENCH_CODEC_REPEATS));
+                }
+            }
+            printf("# codec end\n");
+        }
+
+        bool decodePhoto(Matrix<uint8_t>& photo) {
+            const uint16_t width = 400;
+            const uint16_t height = 296;
+            Matrix<PIXELFORMAT_RGB> rgb(width, height, memory::EOwner::decode);
+            if (rgb.data() == nullptr || !fmt2rgb888(benchPhoto_data, benchPhoto_len, PIXFORMAT_JPEG, (uint8_t*)rgb.begin())) {
+                log_e("bench: photo decode failed");
+                return false;
+            }
+            filtering::convertToGrayscale(rgb, photo);
+            return true;
+        }
+    }
+
+    void run() {
+        Matrix<uint8_t> photo {memory::EOwner::decode};
+        const bool hasPhoto = decodePhoto(photo);
+
+        // Xtensa LX6 has no data cache in front of the internal RAM and the PSRAM cache has no counters, the column stays empty
+        printf("# bench begin\n");
+        printf("method,taps,width,height,threshold,content,repeats,ns_per_pixel,cycles_per_pixel,bytes_touched,bytes_per_pixel,heap,cache_misses\n");
+
+        Matrix<uint8_t> input {memory::EOwner::dither};
+        PrinterMatrix output {memory::EOwner::dither};
+
+        for (const framesize_t framesize : framesizes) {
+            size_t cols, rows;
+            if (!capture::framesizeDimensions(framesize, cols, rows)) continue;
+
+            // free the previous resolution first, UXGA only fits in PSRAM
+            input = Matrix<uint8_t>(memory::EOwner::dither);
+            output = PrinterMatrix(memory::EOwner::dither);
+            input = Matrix<uint8_t>(cols, rows, memory::EOwner::dither);
+            output = PrinterMatrix(cols, rows, memory::EOwner::dither);
+            if (input.data() == nullptr || output.data() == nullptr) {
+                log_w("bench: not enough memory for %ux%u, skipped", cols, rows);
+                continue;
+            }
+            const char* heap = memory::heapToString(memory::heapOf(input.data()));
+
+            const size_t pixels = cols * rows;
+            const size_t repeats = std::max<size_t>(1, std::min<size_t>(BENCH_MAX_REPEATS, BENCH_MIN_PIXELS / pixels));
+
+            for (const auto& entry : filtering::diffusionPatterns) {
+                const size_t bytes = bytesTouched(entry.second, cols, rows);
+
+                for (const float threshold : thresholds) {
+                    for (size_t content = 0; content < contentCount; ++content) {
+                        if (content == contentPhoto && !hasPhoto) continue;
+
+                        int64_t elapsedUs = 0;
+                        uint64_t cycles = 0;
+                        for (size_t i = 0; i < repeats; ++i) {
+                            fill(input, static_cast<EContent>(content), photo);
+
+                            const int64_t start = esp_timer_get_time();
+                            const uint32_t startCycles = ESP.getCycleCount();
+                            filtering::errorDiffusionPrinter(input, output, threshold, entry.first);
+                            cycles += ESP.getCycleCount() - startCycles; // wraps after ~17 s at 240 MHz, one run is far below
+                            elapsedUs += esp_timer_get_time() - start;
+
+                            delay(1); // let the idle task feed the watchdog
+                        }
+
+                        const double runPixels = static_cast<double>(pixels) * repeats;
+                        printf("%s,%u,%u,%u,%.2f,%s,%u,%.2f,%.2f,%u,%.2f,%s,\n",
+                            filtering::methodToString(entry.first), entry.second.size(), cols, rows, threshold,
+                            contentToString(static_cast<EContent>(content)), repeats,
+                            elapsedUs * 1000.0 / runPixels, cycles / runPixels,
+                            bytes, static_cast<double>(bytes) / pixels, heap);
+                    }
+                }
+            }
+        }
+
+        printf("# bench end\n");
+
+        input = Matrix<uint8_t>(memory::EOwner::dither);
+        output = PrinterMatrix(memory::EOwner::dither);
+        runCodecs(photo, hasPhoto);
+        fflush(stdout);
+    }
+}
+
+#endif
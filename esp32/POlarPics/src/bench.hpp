@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+
+// Dithering micro-benchmark, built with -DPOLARPICS_BENCH (env esp32cam-bench): setup() runs it instead of the application
+namespace bench {
+
+    // every configuration dithers at least that many pixels, small resolutions are repeated
+    #define BENCH_MIN_PIXELS (1000 * 1000)
+    #define BENCH_MAX_REPEATS 16
+    #define BENCH_CODEC_REPEATS 8 // encodes of every PNG / G4 configuration
+
+    // Sweep every filtering method across the sensor resolutions (QQVGA to UXGA), thresholds and input contents
+    // and print one CSV row per configuration between "# bench begin" and "# bench end" markers,
+    // then encode a printer width frame of every dithered content in PNG and G4 ("# codec begin" and "# codec end")
+    void run();
+}
@@ -0,0 +1,787 @@
+#ifndef _benchPhoto_h_ 
+#define _benchPhoto_h_ 
+
+#define benchPhoto_len 24910 
+static const uint8_t PROGMEM benchPhoto_data[] = {
+0xff,0xd8,0xff,0xe0,0x0,0x10,0x4a,0x46,0x49,0x46,0x0,0x1,0x1,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xff,0xdb,0x0,0x43,0x0,0xa,0x7,0x8,0x9,0x8,0x6,0xa,
+0x9,0x8,0x9,0xb,0xb,0xa,0xc,0xf,0x19,0x10,0xf,0xe,0xe,0xf,0x1f,0x16,0x17,0x12,0x19,0x24,0x20,0x26,0x26,0x24,0x20,0x23,0x22,0x28,0x2d,0x3a,0x31,0x28,
+0x2b,0x36,0x2b,0x22,0x23,0x32,0x44,0x33,0x36,0x3b,0x3d,0x40,0x41,0x40,0x27,0x30,0x47,0x4c,0x46,0x3f,0x4b,0x3a,0x3f,0x40,0x3e,0xff,0xdb,0x0,0x43,0x1,0xb,0xb,
+0xb,0xf,0xd,0xf,0x1d,0x10,0x10,0x1d,0x3e,0x29,0x23,0x29,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,
+0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0xff,0xc4,
+0x0,0x1f,0x0,0x0,0x1,0x5,0x1,0x1,0x1,0x1,0x1,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x2,0x3,0x4,0x5,0x6,0x7,0x8,0x9,0xa,0xb,0xff,
+0xc4,0x0,0xb5,0x10,0x0,0x2,0x1,0x3,0x3,0x2,0x4,0x3,0x5,0x5,0x4,0x4,0x0,0x0,0x1,0x7d,0x1,0x2,0x3,0x0,0x4,0x11,0x5,0x12,0x21,0x31,0x41,0x6,
+0x13,0x51,0x61,0x7,0x22,0x71,0x14,0x32,0x81,0x91,0xa1,0x8,0x23,0x42,0xb1,0xc1,0x15,0x52,0xd1,0xf0,0x24,0x33,0x62,0x72,0x82,0x9,0xa,0x16,0x17,0x18,0x19,0x1a,
+0x25,0x26,0x27,0x28,0x29,0x2a,0x34,0x35,0x36,0x37,0x38,0x39,0x3a,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x63,0x64,0x65,
+0x66,0x67,0x68,0x69,0x6a,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x83,0x84,0x85,0x86,0x87,0x88,0x89,0x8a,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9a,0xa2,0xa3,
+0xa4,0xa5,0xa6,0xa7,0xa8,0xa9,0xaa,0xb2,0xb3,0xb4,0xb5,0xb6,0xb7,0xb8,0xb9,0xba,0xc2,0xc3,0xc4,0xc5,0xc6,0xc7,0xc8,0xc9,0xca,0xd2,0xd3,0xd4,0xd5,0xd6,0xd7,0xd8,
+0xd9,0xda,0xe1,0xe2,0xe3,0xe4,0xe5,0xe6,0xe7,0xe8,0xe9,0xea,0xf1,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,0xfa,0xff,0xc4,0x0,0x1f,0x1,0x0,0x3,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x2,0x3,0x4,0x5,0x6,0x7,0x8,0x9,0xa,0xb,0xff,0xc4,0x0,0xb5,0x11,0x0,0x2,0x1,0x2,
+0x4,0x4,0x3,0x4,0x7,0x5,0x4,0x4,0x0,0x1,0x2,0x77,0x0,0x1,0x2,0x3,0x11,0x4,0x5,0x21,0x31,0x6,0x12,0x41,0x51,0x7,0x61,0x71,0x13,0x22,0x32,0x81,
+0x8,0x14,0x42,0x91,0xa1,0xb1,0xc1,0x9,0x23,0x33,0x52,0xf0,0x15,0x62,0x72,0xd1,0xa,0x16,0x24,0x34,0xe1,0x25,0xf1,0x17,0x18,0x19,0x1a,0x26,0x27,0x28,0x29,0x2a,
+0x35,0x36,0x37,0x38,0x39,0x3a,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x73,0x74,
+0x75,0x76,0x77,0x78,0x79,0x7a,0x82,0x83,0x84,0x85,0x86,0x87,0x88,0x89,0x8a,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9a,0xa2,0xa3,0xa4,0xa5,0xa6,0xa7,0xa8,0xa9,
+0xaa,0xb2,0xb3,0xb4,0xb5,0xb6,0xb7,0xb8,0xb9,0xba,0xc2,0xc3,0xc4,0xc5,0xc6,0xc7,0xc8,0xc9,0xca,0xd2,0xd3,0xd4,0xd5,0xd6,0xd7,0xd8,0xd9,0xda,0xe2,0xe3,0xe4,0xe5,
+0xe6,0xe7,0xe8,0xe9,0xea,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,0xfa,0xff,0xc0,0x0,0x11,0x8,0x1,0x28,0x1,0x90,0x3,0x1,0x21,0x0,0x2,0x11,0x1,0x3,0x11,
+0x1,0xff,0xda,0x0,0xc,0x3,0x1,0x0,0x2,0x11,0x3,0x11,0x0,0x3f,0x0,0xf3,0x85,0xf2,0xf9,0x26,0x38,0xa4,0xc8,0xc6,0x77,0xb0,0xd8,0x7d,0x69,0x83,0x0,0x36,
+0xf3,0x1b,0x2f,0xca,0x37,0x87,0xe9,0x9e,0xf4,0x5e,0xfa,0x89,0x2e,0x4d,0x87,0x26,0xc8,0x7a,0x9,0xa,0xef,0x3,0x2d,0xcd,0x39,0x95,0x96,0xe0,0x19,0x54,0x27,0xcb,
+0xc8,0xcf,0x6a,0xd5,0x4a,0xc8,0x6e,0xef,0x71,0x4f,0xdc,0x7f,0xc0,0xa7,0x3d,0x45,0x27,0x98,0x19,0x57,0x6c,0x6f,0xb4,0x9f,0x97,0x73,0x81,0x5c,0xf1,0x57,0x77,0x32,
+0x8c,0x39,0x85,0x63,0x1f,0xd,0x18,0x63,0xb5,0x78,0xe7,0x75,0x9,0xf3,0x9f,0x91,0x64,0xc9,0xee,0x71,0x81,0x5a,0xec,0x68,0x82,0x4c,0xe0,0x63,0xc9,0xc6,0x33,0xb5,
+0xc1,0xde,0x4d,0x38,0xf4,0x98,0x45,0x12,0xf9,0xa8,0xc1,0x76,0xfd,0xec,0xd6,0x4e,0xa7,0x62,0x5,0x5f,0x25,0x8e,0x73,0x26,0xff,0x0,0x4e,0x36,0xd4,0x6c,0x32,0xb,
+0x2,0x6,0x78,0xe3,0xef,0x1a,0xb5,0x7e,0x6b,0x9a,0x26,0xf6,0x14,0x2,0x5f,0xf8,0x71,0xea,0x39,0xcd,0x39,0x62,0x24,0x22,0x6e,0xe7,0x76,0x3d,0x73,0xed,0x47,0xb4,
+0x8f,0x62,0x3c,0x86,0x3b,0x1f,0x2d,0x98,0x60,0x73,0xb1,0x7d,0x37,0x54,0xb2,0xf9,0x2b,0x2b,0x79,0x64,0x12,0x7f,0x84,0x36,0x76,0xd4,0xf2,0xab,0x5d,0x7,0xbc,0xb6,
+0x21,0xdd,0xfe,0x8e,0x41,0x57,0x43,0x4f,0x24,0x1f,0xb8,0xa,0xe4,0xf1,0x59,0xc3,0xdd,0x13,0x52,0x11,0x1f,0xf,0xe5,0x9f,0xe0,0xcf,0x53,0xd6,0x9b,0xc8,0xce,0x13,
+0xe5,0xff,0x0,0x7b,0x2d,0x5a,0xaa,0x7d,0xc9,0xd0,0x18,0x37,0x3c,0x36,0xf1,0xeb,0x4d,0x91,0x95,0xb,0x63,0xcc,0xf5,0x3c,0xa,0x76,0xec,0x5f,0x2f,0x41,0xe4,0xe1,
+0xf6,0x65,0x4b,0x7a,0x67,0x9a,0x8f,0xa1,0xf9,0xf3,0x8c,0xd2,0x34,0xe5,0x8a,0x40,0x7b,0x61,0x86,0x3e,0x94,0x99,0x40,0xa5,0x5a,0x65,0x3e,0x88,0x5,0x34,0xee,0xb6,
+0x26,0x42,0x39,0xe0,0x75,0x0,0xc,0xe4,0x75,0x34,0x63,0x76,0xdf,0xc0,0xe7,0x35,0x7c,0xf6,0x23,0xcc,0xe,0xd6,0x2f,0xc7,0x43,0xb7,0xaf,0x5a,0x4c,0x0,0x19,0xb3,
+0x8c,0xb7,0x15,0x8c,0x5c,0xfa,0x1a,0x6a,0x38,0xf2,0x8c,0xc7,0x25,0x73,0xfc,0x22,0xad,0xe9,0x3f,0x35,0xea,0xa0,0xf2,0xfc,0xc7,0x3b,0x55,0xa5,0x3f,0x24,0x7e,0xf5,
+0x5c,0xdd,0x48,0x7a,0xee,0x68,0x98,0x6d,0xfc,0xa6,0x30,0x48,0x5f,0x4e,0xb4,0x23,0xcf,0xb9,0xdd,0xf3,0x4a,0xd9,0xe9,0x55,0xae,0x59,0x91,0x7e,0xd9,0xe5,0xe2,0x79,
+0x5b,0xcf,0x28,0xe3,0x84,0x8b,0xa2,0xd6,0x77,0x26,0xfa,0x96,0x6d,0xe2,0x8e,0x51,0x1c,0x12,0xc8,0xb1,0xda,0xdb,0x7e,0xf2,0xe6,0x76,0x7c,0x64,0xb0,0xfb,0xb5,0xa7,
+0x1a,0xad,0xf4,0xa3,0x52,0xbd,0xf2,0xed,0x34,0xfb,0x7c,0x98,0x62,0x6e,0x37,0x8f,0xef,0x57,0x3c,0xbd,0xd6,0x67,0x2d,0x5,0xb2,0x83,0xfb,0x5a,0xe3,0xfb,0x57,0x51,
+0x2,0x1b,0x15,0xe6,0x18,0x5f,0xe5,0xc0,0xfe,0xfd,0x57,0xfd,0xef,0x89,0xae,0x71,0x8,0x7b,0x6d,0x12,0x29,0x36,0xb4,0x83,0x1b,0xee,0x1a,0xb5,0x4f,0xa9,0x28,0xbf,
+0xa8,0xea,0xd6,0xda,0x50,0x5b,0x3d,0x2e,0xda,0x39,0xb5,0x9,0x4e,0xc8,0x6d,0x53,0xe6,0x11,0x52,0x5a,0xe8,0xbb,0x19,0xf5,0x2f,0x10,0x5c,0xc7,0x2c,0xf1,0x7c,0xcf,
+0xb4,0xed,0x86,0x11,0x4d,0xca,0xcb,0x95,0x75,0x12,0xee,0x66,0x4d,0x7c,0xda,0x94,0x37,0x7a,0x84,0x16,0xdb,0x74,0xcd,0x3d,0x5c,0x42,0xcf,0xd6,0x59,0xf,0x43,0x4b,
+0xe5,0xdf,0x4b,0x6d,0x67,0xa0,0xe9,0xf1,0x43,0x1d,0xcc,0xb0,0x79,0x97,0x37,0x32,0x36,0xef,0x2c,0x75,0xa2,0x56,0x8e,0xa3,0x69,0x6c,0xcd,0xf9,0x3f,0xb2,0x7c,0x33,
+0xa2,0xab,0x36,0x7c,0x85,0xfb,0xac,0x7f,0xd6,0xdd,0x3d,0x61,0xc2,0xd2,0x6a,0x97,0x4b,0xac,0xea,0x91,0x1b,0x7d,0x3d,0x17,0xf7,0x11,0x16,0xf9,0x4f,0xa9,0xa5,0x1d,
+0xae,0x17,0x6f,0x52,0x5d,0x16,0x54,0xfb,0x15,0xc6,0xaf,0xa9,0xaa,0x45,0xe6,0x7d,0xd3,0xb3,0x22,0x38,0xc7,0x4a,0x8c,0xf9,0xfe,0x28,0x93,0x74,0x4a,0xd6,0xba,0xc,
+0xd,0x82,0xe7,0x89,0x2e,0xd,0x67,0x19,0x5a,0xf2,0x27,0x96,0xc3,0x75,0xb4,0x86,0xd6,0x38,0x74,0x7b,0x3c,0x47,0x71,0x71,0xc2,0xae,0xfe,0x62,0x1e,0xb5,0x4f,0x51,
+0x82,0x4b,0xdb,0xbb,0x7d,0x22,0xc9,0x36,0xf9,0x7f,0x35,0xc4,0xb1,0xb7,0x1,0x6a,0xf6,0xdc,0xb4,0xaf,0xab,0x3a,0xd,0x42,0xee,0xcb,0x46,0xb3,0x12,0xcc,0x98,0x80,
+0x7c,0xb1,0x47,0x1f,0xca,0x64,0xac,0x24,0xd2,0x75,0x2d,0x72,0x7f,0xed,0x4d,0x57,0x64,0x31,0x37,0xfa,0xb8,0x57,0xb,0xc5,0x4c,0x27,0xc9,0xa8,0x53,0xb5,0xf9,0x8c,
+0x51,0x9f,0x9d,0x57,0xcb,0x2c,0xd9,0x6e,0x25,0xed,0xc0,0xa6,0x3e,0xd5,0x51,0xba,0x25,0xef,0x90,0x45,0x75,0x4a,0xef,0x63,0xaa,0xfa,0x82,0x62,0x13,0xb4,0xb6,0xcd,
+0xbd,0xf7,0x1e,0x69,0xd9,0x7,0x73,0x29,0xdc,0x8c,0xc7,0x73,0x6e,0xe3,0x91,0x43,0xb8,0xb9,0x87,0x36,0xcc,0x4,0xde,0xb9,0x5c,0x11,0x80,0x5b,0x2,0x9a,0x48,0xd9,
+0xf3,0x29,0xc0,0xe7,0x20,0xf2,0x3b,0x66,0xa1,0x27,0xb0,0xfc,0xd0,0xf7,0xda,0xbd,0x38,0x19,0x19,0xe7,0xe6,0xe2,0x95,0x73,0xf3,0x63,0xcc,0x4,0x1e,0xcf,0xc5,0x6f,
+0xc8,0xe4,0x81,0xbe,0xe1,0xd4,0x8e,0xcb,0xe9,0x9e,0xb4,0xe4,0x27,0x3e,0x78,0xf3,0x43,0x8f,0x95,0xbb,0x74,0xae,0x69,0xc1,0x44,0x87,0xd1,0x91,0x47,0x95,0x89,0x55,
+0xb8,0x60,0xe,0x64,0xc8,0xa7,0x66,0x28,0xf7,0x72,0x37,0x2f,0x59,0x6,0x72,0xd5,0x5a,0xdf,0x95,0x14,0xd8,0xfd,0xdb,0x72,0x73,0x1e,0xe0,0x46,0xd0,0xb5,0x1c,0x79,
+0x89,0x94,0xc3,0x18,0x28,0xf,0x1f,0x3e,0x1a,0x8e,0x55,0xb1,0x9d,0xed,0xb0,0xad,0xe5,0xc,0x83,0xca,0xab,0xff,0x0,0x11,0xc7,0x39,0xcd,0x29,0xea,0xd8,0x3d,0x49,
+0x92,0x43,0x9a,0x94,0xee,0x52,0xa8,0xe3,0xb8,0x98,0x1b,0x6,0x6,0xf0,0xdf,0xdd,0x6c,0x53,0x64,0x51,0xb8,0x1c,0x7c,0x9c,0x6f,0xfe,0xb4,0x46,0x5c,0xce,0xc5,0xc6,
+0xa2,0xbd,0xd8,0x2b,0x87,0x20,0x44,0xfb,0x93,0x34,0xf1,0xc3,0xf,0x91,0xd9,0x4b,0xec,0x27,0xd2,0xb4,0x94,0xf4,0xb1,0x3c,0xb1,0xea,0x22,0x79,0xad,0x6f,0xbb,0x6f,
+0xef,0x99,0xbe,0xea,0x8c,0xd3,0x25,0x5c,0x33,0x2b,0xaf,0x2c,0xd8,0x3f,0x36,0x29,0x2b,0x5,0xc7,0x3b,0x2,0xec,0xdf,0x30,0xcf,0xa1,0xe6,0x9a,0xbb,0x38,0xdc,0xbf,
+0xc5,0xc7,0x3f,0xa5,0x1c,0xa5,0x2e,0xc3,0x41,0xe9,0x85,0x2d,0xdf,0xf5,0xa1,0x78,0x43,0x8c,0x88,0xc9,0xe5,0x4b,0x64,0x13,0x4c,0x6d,0x2b,0x3,0x63,0x3f,0x3e,0x41,
+0xf4,0xa4,0xea,0x2a,0x9d,0xe5,0x61,0x5c,0x40,0xed,0x8e,0x77,0x6d,0xed,0xd2,0x93,0xaf,0xca,0x57,0x8c,0xe4,0x36,0xec,0x51,0xb3,0x1a,0x97,0x42,0x4e,0xc3,0x69,0x38,
+0xdf,0xfc,0x26,0xa5,0xf9,0x18,0x37,0x9d,0xe6,0xe7,0x66,0xfc,0xa3,0xe0,0xad,0x2d,0x9,0x91,0xb7,0xd,0xd0,0x9e,0xd5,0x64,0xbb,0xdd,0xe4,0x5a,0xb8,0x16,0xba,0x7c,
+0x71,0x80,0x24,0x93,0x1d,0x69,0xb7,0xb1,0xdd,0xcb,0x3b,0x43,0x78,0xad,0x26,0xa1,0x77,0xb1,0x8a,0x71,0x88,0x90,0x73,0x5c,0xdd,0x74,0x26,0xd1,0xb9,0x4e,0xd2,0x2f,
+0xb6,0x21,0xb2,0xe,0xc2,0x29,0x49,0xb9,0xba,0xf9,0xf9,0xdb,0xc5,0x69,0x8f,0x27,0x5b,0xbe,0x79,0x64,0xcc,0x5a,0x3d,0x8c,0x9b,0x17,0x32,0x7d,0xf3,0xeb,0x57,0x38,
+0xb6,0xc9,0x6e,0xe4,0xed,0xe6,0xf8,0xbe,0xf9,0x60,0x88,0xb4,0x5a,0x3c,0x2f,0xf3,0xac,0x6d,0xfe,0xbd,0xfd,0x28,0xd4,0xaf,0xfc,0xfb,0x81,0xa1,0xf8,0x7f,0xb,0xe5,
+0x9c,0x49,0x2c,0x63,0xf7,0x70,0x2f,0x7a,0xcd,0x76,0xec,0x4e,0x85,0xd8,0xbf,0xb2,0xbc,0x31,0xa6,0x1b,0x82,0x7e,0xaf,0xb8,0x19,0xa7,0x7e,0x86,0xa9,0x7d,0x8e,0xff,
+0x0,0xc4,0x52,0xdb,0xbe,0xa4,0x86,0xcb,0x4a,0x2d,0x98,0xec,0xd4,0x9f,0x32,0x73,0x8e,0x28,0xbe,0x97,0x64,0xff,0x0,0x78,0x65,0xfb,0x59,0x5e,0xdf,0xae,0x9d,0x6d,
+0x24,0x69,0x69,0x61,0x86,0x97,0x73,0x71,0xf2,0xff,0x0,0xd,0x43,0xa4,0x4f,0x6d,0xa7,0xe8,0xaf,0xab,0xde,0x64,0x49,0x75,0x29,0xfd,0xd2,0x9f,0x99,0x8f,0x65,0xa5,
+0xca,0xed,0x61,0x3d,0x4b,0xba,0x5e,0x99,0x3e,0xad,0x79,0x1e,0xaf,0xae,0x29,0x62,0x7e,0x6b,0x3b,0x2d,0xf9,0x54,0x4a,0x87,0x59,0xbc,0x8f,0x51,0xd4,0x22,0xd1,0x6c,
+0x98,0x5c,0x43,0xff,0x0,0x2f,0x33,0x42,0xc3,0x85,0xfe,0xe5,0x35,0xef,0x6a,0x11,0x5a,0xd8,0xad,0x15,0xa9,0xd5,0x2e,0xbc,0x9f,0x35,0x97,0x48,0xb3,0x29,0x8f,0x2f,
+0xee,0xbb,0x8e,0xd5,0xa7,0xab,0x6b,0x6b,0xa7,0x88,0x6d,0x2c,0x22,0x8e,0x4b,0xef,0xb9,0x5,0xa2,0xe,0x21,0xa3,0x72,0xdd,0xb6,0x89,0x42,0xd6,0xd1,0x74,0x4b,0x3b,
+0xbb,0xed,0x45,0x4c,0xf7,0xe5,0x4b,0x5c,0x36,0xe0,0x48,0xcf,0x6a,0xab,0xa6,0xcb,0x1e,0x99,0xa2,0x5c,0x6a,0x57,0x1,0x8c,0xf3,0x9c,0x9f,0xde,0xe3,0x3f,0xdd,0x5a,
+0x76,0xe6,0x8,0xbb,0xdd,0x13,0xd8,0xe9,0xd2,0xea,0x97,0x7f,0xda,0x9a,0xe2,0x1f,0x2d,0x93,0xfd,0x1a,0xd8,0xb9,0xe0,0x76,0x35,0xa9,0xae,0x6a,0x90,0xe9,0xe3,0x6c,
+0xa5,0xa4,0xbc,0x94,0x67,0xcb,0x5f,0xf9,0x66,0x3b,0x1a,0x94,0xb9,0xa6,0x4e,0x89,0xd8,0xe1,0x25,0x6c,0x47,0x90,0xb9,0x3e,0x94,0xa8,0x62,0xde,0x4f,0xcc,0x83,0xdf,
+0xe6,0xfc,0x6b,0xb9,0xbe,0x68,0x9d,0x52,0x6e,0xd7,0x15,0x5b,0x6c,0x87,0x6d,0xda,0x7d,0xdf,0xbc,0x21,0x39,0xc5,0x21,0x31,0xb2,0x48,0x5b,0xef,0xed,0xd9,0xbb,0x77,
+0xcc,0x4e,0x73,0x9a,0x98,0x73,0x9,0xca,0xe8,0x70,0x7c,0xf2,0xa1,0x10,0xfe,0x40,0xd0,0x8,0x2c,0xdf,0x26,0xa,0x91,0xbb,0xe6,0xca,0xb5,0x55,0x45,0x6d,0x84,0x9b,
+0x68,0x79,0x96,0x23,0x29,0x2f,0x1b,0x46,0x5a,0x4d,0xc4,0x23,0x67,0x23,0xbd,0x33,0xef,0x6d,0x66,0xf3,0x37,0x83,0xeb,0x95,0x35,0x11,0x94,0xee,0x2f,0x21,0xe4,0x48,
+0xe8,0xea,0x6,0xc3,0xd0,0x31,0xe0,0xa,0x3c,0xc2,0x31,0x95,0x3f,0x31,0xc5,0xd,0x26,0xc4,0xb6,0xd0,0x5c,0xcb,0xf3,0x97,0x81,0x3f,0xbc,0x7b,0xe,0x99,0x14,0xbb,
+0xd8,0xaf,0xef,0xce,0xed,0xc9,0x95,0x25,0xb7,0x7c,0xd4,0xe4,0xe2,0xb6,0x13,0x44,0x6d,0x26,0x3a,0x85,0x38,0x38,0xdd,0x9f,0xbb,0x8e,0xd4,0xb9,0x56,0x2a,0x76,0xaf,
+0xa8,0xef,0x49,0x6a,0xc1,0x43,0xb0,0xe7,0x6f,0x97,0x5,0x7,0xca,0x7d,0x73,0x51,0x9d,0xc4,0x0,0x38,0x6d,0xe1,0xe9,0x59,0x22,0xe0,0xb4,0x15,0xa4,0x47,0x71,0xfb,
+0xbf,0xe2,0x1c,0x7b,0xd3,0xf7,0x36,0x7f,0x78,0x42,0xff,0x0,0x70,0xa8,0xe9,0x54,0xe3,0xad,0xc1,0xab,0xc,0x92,0x66,0x62,0xa2,0xe2,0x4e,0x43,0x7f,0x17,0x14,0x6,
+0x73,0x20,0xfb,0xc8,0x64,0x1b,0x40,0xdd,0xd4,0x53,0x70,0x57,0x1e,0x96,0x19,0x23,0xa6,0xd5,0xc0,0xdc,0x47,0xfe,0x3b,0xde,0x90,0xc8,0x48,0x3b,0x47,0x1c,0x60,0xee,
+0xa3,0xa9,0x31,0x5d,0xc0,0x3b,0x7a,0x9e,0x3d,0xe9,0x63,0x62,0xe7,0x5,0x86,0x37,0x77,0xed,0xef,0x4e,0x68,0xd1,0xc8,0x6,0xf5,0x54,0xc,0xf9,0x50,0x7a,0xe,0xf4,
+0xab,0x26,0xe5,0x1f,0xbb,0x8c,0xae,0x7a,0x63,0x8c,0x56,0x76,0x5b,0x99,0x4a,0x4d,0xad,0x5,0xf9,0xb7,0x7c,0x89,0xf2,0x12,0x7,0xdf,0xcd,0x31,0xff,0x0,0x75,0xfb,
+0xc6,0xd8,0x30,0xdf,0x75,0x98,0x67,0x15,0x7c,0xf7,0x61,0x17,0x64,0x27,0x98,0x7b,0x4,0x21,0x8f,0x6a,0x7e,0x71,0xb7,0x23,0x38,0x6c,0xf4,0xa4,0xa2,0x8b,0x5b,0x8b,
+0xbf,0x83,0xb0,0x27,0xde,0xdf,0xb9,0x4d,0x5a,0xd3,0xd6,0xe2,0xe2,0x3b,0x8b,0x58,0x13,0x33,0xdd,0x7c,0xbb,0xb8,0x0,0x28,0xe6,0xa7,0x41,0x48,0x99,0xae,0x8d,0x86,
+0xa1,0x2b,0xa2,0xc7,0x75,0x3e,0xdf,0x20,0x33,0x73,0xe5,0x1f,0xef,0x55,0xdf,0x2e,0x28,0x6d,0xda,0xd6,0xde,0xe1,0xa6,0xd4,0x2e,0x98,0x19,0x24,0x66,0x23,0xcb,0x18,
+0xe5,0xa8,0xe4,0x49,0x18,0x39,0x14,0xb3,0x12,0xfd,0xa2,0xcb,0x4e,0x65,0x3f,0x68,0x95,0x22,0x1d,0x97,0xa1,0xdc,0x6a,0xf3,0x38,0xb9,0x74,0xd1,0x20,0xe,0x22,0x80,
+0x7f,0xa4,0x48,0x3e,0x53,0xb4,0x7f,0x5,0x27,0x11,0xcb,0x98,0xb3,0x7d,0x78,0xf7,0x52,0x26,0x87,0xa0,0xed,0x54,0x5c,0xac,0xd7,0x1f,0xc1,0x12,0xf7,0x5a,0xb1,0x3d,
+0xd5,0xbf,0x86,0xf4,0xb5,0xd2,0x74,0xd8,0xc,0xb7,0xf3,0x9f,0x96,0x31,0xcb,0x31,0xfe,0xfd,0x65,0xcb,0xd1,0x93,0x61,0xd6,0xba,0x46,0xdb,0xaf,0xed,0x3f,0x10,0x49,
+0xc,0xb3,0x46,0x3,0xe0,0xe3,0xc9,0x80,0x62,0xa3,0x97,0x59,0xbb,0xf1,0x0,0x96,0xdb,0x4b,0xc5,0xbc,0x12,0x36,0xd9,0xef,0xe4,0x3f,0x39,0x1d,0xc5,0x4f,0x98,0xd6,
+0xa5,0x49,0xad,0x85,0xb4,0x31,0x68,0x96,0xa,0x8c,0x5b,0x6,0xe5,0xc0,0xc1,0xda,0x47,0x26,0x8d,0x6,0xda,0x3b,0xdd,0x54,0xcc,0x53,0x7c,0x5a,0x7f,0xee,0x6d,0x54,
+0x36,0x44,0x87,0xd6,0xb4,0xe6,0xf7,0x42,0x53,0xea,0x5a,0xd4,0x75,0x5b,0x8d,0x46,0x77,0xd2,0x34,0xf,0x9e,0x4c,0x66,0xea,0xe8,0x60,0x5,0x4e,0x84,0x55,0x7b,0xaf,
+0x2b,0xc3,0xf6,0xb,0x69,0x60,0xf,0xda,0x26,0x93,0xcb,0x8d,0xd8,0xf,0x98,0xe7,0xef,0x54,0xbd,0x7d,0xd4,0x42,0xbe,0xc3,0x64,0xb8,0x1a,0x4c,0x69,0xa5,0x58,0x6d,
+0xb8,0xbd,0x96,0x4f,0xdd,0x29,0x1c,0x2,0x7f,0x8a,0xad,0xe9,0x16,0x50,0x69,0x16,0x93,0x5f,0x5d,0x14,0x69,0xcf,0xcd,0x35,0xcb,0x0,0x59,0x3d,0x45,0x26,0x9d,0x8b,
+0x5a,0x2b,0xb2,0x83,0xcd,0x37,0x88,0x6e,0x52,0x58,0xad,0xf6,0x69,0x56,0xcf,0xf2,0x7c,0xa3,0x7c,0xcf,0xeb,0x50,0x94,0x97,0x5b,0xd4,0x94,0x4c,0xb8,0xd3,0xed,0x5f,
+0xe6,0x3d,0x7c,0xe6,0xcd,0x1c,0xca,0x28,0x8d,0x20,0x5d,0xbf,0xd7,0x17,0x4e,0x95,0x6d,0x74,0xe8,0xfc,0xcb,0xb3,0x8f,0x28,0xf,0x99,0x54,0xd4,0x36,0x3a,0x13,0x21,
+0x7b,0xbd,0x59,0xda,0x4b,0xb9,0x9b,0xcc,0x20,0x37,0x19,0xcd,0x27,0x2e,0x51,0xdd,0xc7,0xde,0x39,0xe4,0xcb,0x10,0x9b,0x6,0xec,0x6e,0xe9,0xda,0x9a,0x0,0xc8,0xc0,
+0xe1,0x97,0x22,0xbb,0x1c,0xbb,0x1d,0xc9,0x69,0xca,0x4a,0x58,0xb3,0x79,0x6f,0x2,0xc6,0x47,0x40,0xbd,0xe9,0x9f,0x23,0xa7,0x99,0xb4,0x1e,0x9d,0xa8,0x75,0x25,0x1f,
+0x79,0x19,0x68,0x3b,0xe4,0xc6,0x1b,0x9,0xcf,0xaf,0xde,0xa6,0xa4,0xb9,0xe4,0xa2,0xaf,0x63,0x9f,0xe1,0xa8,0xf6,0x92,0x71,0x2b,0xe2,0x42,0xbb,0x6e,0x43,0xb5,0xf2,
+0x5b,0xa7,0x18,0xef,0x48,0x79,0x20,0xf4,0xdb,0xe9,0xc6,0x1b,0xd2,0x8a,0x12,0x96,0xf6,0x22,0xd1,0x1d,0xbb,0xf7,0x65,0x95,0xb3,0x9f,0xbe,0x30,0x49,0x2d,0x9e,0x94,
+0xff,0x0,0xbb,0x39,0x4,0x1c,0x74,0x3e,0xb4,0xb9,0x65,0xcc,0x1e,0xec,0x51,0xa,0x60,0xb6,0xe7,0x44,0x4,0x75,0xc6,0x7f,0x3a,0x74,0xbf,0xba,0xdc,0xf8,0xdb,0xf3,
+0x1c,0x9f,0xe5,0x53,0xad,0xf5,0x12,0x96,0xb6,0x1e,0x1f,0x1c,0xa9,0x4f,0xde,0x76,0x75,0x38,0x39,0xa1,0xfe,0x51,0x9,0xf2,0xe2,0x7,0x27,0x6e,0xd5,0xc0,0xa4,0xb7,
+0x2a,0xed,0x3b,0x2,0xc,0xe3,0x98,0x9b,0x27,0xb7,0x21,0xa9,0x24,0x65,0x56,0x2b,0x21,0x8,0xfe,0xcf,0xd6,0xb5,0x7e,0xf3,0xb0,0x5d,0x74,0xd,0xa4,0xf9,0x67,0xe5,
+0xa,0x39,0xcf,0x40,0xbc,0x53,0x49,0x4e,0xf3,0xaf,0x99,0xd9,0x40,0xce,0xe1,0x53,0x2e,0x64,0xac,0x87,0xbe,0xe2,0xa8,0xe3,0x2a,0xaa,0xdd,0xb0,0x46,0x68,0x2b,0x8f,
+0xe2,0x3d,0x70,0x1b,0x1c,0x8a,0x14,0xa4,0x8c,0xa7,0xb8,0xc3,0xf2,0xe3,0x1b,0x3,0x2,0x7e,0x75,0x14,0x6e,0x62,0xfc,0xbc,0x6f,0x93,0xc9,0x27,0x15,0x7e,0xf6,0xe6,
+0x96,0x8d,0xc4,0x8f,0x95,0x7,0xe5,0x3c,0xe7,0x1,0x7b,0xfa,0xd3,0x89,0x6c,0xf4,0x5c,0xe7,0xb8,0xe2,0x9f,0x35,0xc7,0xf1,0xb1,0xea,0xa5,0x9b,0x1b,0x50,0xe,0xe1,
+0x13,0xa5,0x34,0xc,0xc6,0x8c,0x9e,0x5a,0x8e,0xa4,0x1e,0x30,0x2b,0x29,0x5f,0x64,0x1b,0x6a,0x39,0xf6,0xf3,0xb4,0x1f,0x9b,0xa8,0xa6,0xbc,0x6a,0x91,0x3,0xb6,0x3f,
+0x95,0x81,0x3f,0x27,0x5a,0xb8,0xb7,0xd4,0x49,0xd9,0xf,0x24,0x72,0xae,0xfb,0xfb,0x63,0x6e,0x31,0xed,0x4d,0x90,0xec,0x93,0xee,0xaf,0x4e,0xc2,0xa2,0xf6,0x91,0x3e,
+0x43,0xdb,0x1b,0x47,0x23,0x0,0xe7,0x34,0xb0,0x5c,0x98,0xdb,0x74,0x73,0x46,0x37,0x8f,0x2f,0x71,0x72,0xbb,0x7d,0xe9,0x42,0xec,0x2d,0xd8,0xbd,0x7b,0x26,0x9a,0xa8,
+0xc9,0xa5,0x42,0xf7,0xc,0x17,0x13,0x4a,0xf2,0xb0,0xcb,0x7a,0xd4,0xb6,0x4f,0x74,0x96,0x5f,0xd9,0xd6,0x31,0x8f,0xb6,0xcf,0x21,0x33,0x87,0x5e,0x63,0x1d,0x29,0x4a,
+0x4e,0xd6,0x63,0xb7,0x71,0xbe,0x78,0xb3,0xbd,0x4d,0xb1,0x89,0x21,0xb1,0x5f,0x20,0xe7,0xef,0x33,0x35,0x49,0x71,0xe7,0x69,0x7a,0x76,0xd9,0x88,0x9e,0xf3,0x50,0x76,
+0xe9,0xf3,0xc,0xd0,0xe5,0x63,0x3e,0xa5,0xa1,0x71,0xfd,0x89,0x69,0xe,0x95,0xa7,0x41,0x1c,0xd7,0xf7,0x19,0xea,0xbf,0x32,0x9f,0x5a,0xb1,0x6f,0x1c,0x1a,0xc,0x12,
+0xea,0x5a,0x8d,0xc2,0x49,0x7d,0x2f,0xcc,0xd2,0xb0,0xf9,0x99,0x8f,0x55,0xac,0x6f,0xd0,0x52,0x56,0x21,0x8a,0xc2,0xf7,0xc4,0x53,0x43,0x71,0xa9,0x42,0x2d,0xac,0x30,
+0x36,0xda,0xc2,0x7e,0x69,0x3d,0xea,0xd6,0xab,0xad,0x41,0xb,0xad,0x9e,0x8b,0x4,0x13,0xdd,0x29,0x11,0x44,0xb0,0xc7,0x95,0x83,0xb5,0x37,0xef,0x3d,0x9,0xeb,0x64,
+0x63,0x4f,0xbf,0x4d,0x8e,0x44,0x4,0x4d,0xa8,0xdc,0x71,0x23,0xb6,0x49,0x2d,0x52,0xcc,0x97,0x2f,0x3c,0x5a,0x16,0x99,0x34,0x4a,0xaa,0x83,0xcf,0x9f,0xee,0x84,0xec,
+0x6a,0x9b,0x4b,0x53,0x47,0x4,0xf7,0x37,0x37,0x69,0x9e,0x1e,0xd1,0x46,0x30,0xb6,0xcb,0xff,0x0,0x7f,0x2e,0x64,0xc5,0x62,0xa4,0xf2,0x79,0x93,0xea,0x7a,0xb2,0x2a,
+0xcf,0x22,0x86,0x8e,0xdd,0x63,0x3f,0xba,0x5a,0x5a,0xd8,0x98,0x77,0x17,0x47,0x7b,0x7b,0x78,0x67,0xd4,0xb5,0x9,0x2,0xcf,0x70,0x48,0x91,0x8a,0x67,0x66,0x3b,0x54,
+0x11,0x5a,0xdd,0x6b,0xd7,0x31,0x5d,0xdf,0xa4,0x30,0x58,0xa7,0xdc,0x55,0xe1,0x9f,0x9e,0x95,0x6b,0xab,0x2a,0xe6,0x86,0xb7,0x7f,0x14,0x30,0x47,0x67,0x67,0xf6,0x4f,
+0xb5,0xb8,0x31,0x2c,0x10,0x29,0xfd,0xd8,0x35,0x42,0x59,0x8e,0x95,0xa6,0xc1,0x6f,0x64,0x99,0x9c,0xfe,0xed,0x30,0x7e,0xfb,0x1e,0xf5,0x95,0xb9,0x7e,0x23,0x1e,0x5e,
+0xe5,0xed,0x2f,0x4f,0x5d,0x31,0x94,0xdd,0xb,0x53,0x78,0x64,0xdc,0xf2,0xba,0xe7,0xca,0xff,0x0,0x66,0xaa,0x6a,0x5a,0xfe,0x64,0xfb,0x16,0x92,0x23,0x6d,0xff,0x0,
+0x7e,0x64,0x1f,0xa5,0x44,0x61,0x29,0xbe,0x73,0x55,0x15,0x26,0x60,0x67,0xe5,0x69,0x11,0x8b,0x95,0x1b,0x46,0xd1,0xef,0xd2,0x9a,0xe4,0x2b,0x9f,0x9b,0xe5,0xf5,0xcf,
+0x15,0xd6,0xd2,0xe5,0xd0,0xda,0x33,0xb8,0xbc,0x24,0x98,0x3,0x69,0xce,0x33,0xbb,0x34,0x8f,0xe5,0xc,0x72,0x38,0x3b,0x7e,0x51,0xd3,0xd6,0xaa,0xcc,0x15,0xae,0x4d,
+0xfb,0xa2,0x4b,0x71,0xb9,0x71,0xf2,0x12,0xc3,0x6,0x93,0x2a,0xaf,0x9f,0x27,0xb8,0x6f,0x9c,0xe4,0x13,0x50,0xf9,0xfe,0x0,0x56,0xea,0x29,0xf3,0x39,0x95,0xb6,0x12,
+0x7e,0x6f,0x94,0xf0,0x29,0x8d,0xe5,0x8,0xd5,0x62,0x9f,0xcd,0x6c,0x92,0x57,0x69,0x7,0x9a,0xb7,0xcc,0xf4,0x46,0x7a,0x3d,0x89,0x19,0x61,0xf3,0x44,0x81,0x0,0x7,
+0xee,0x9c,0x9f,0x5a,0x41,0xb7,0x77,0xce,0xb9,0xdd,0xea,0xd4,0x47,0x9b,0xa8,0xf9,0x5b,0x43,0x37,0x20,0x61,0xf2,0x7c,0xa2,0x3e,0x2,0xd,0xc0,0xd2,0x6e,0x11,0x61,
+0x18,0x13,0x2f,0xde,0xda,0xdc,0xab,0xe6,0xaf,0x99,0xbd,0xb,0xe5,0xba,0x26,0x27,0xe5,0x19,0xdd,0xb5,0x7f,0x3a,0x6a,0xe0,0x95,0xf2,0x83,0x36,0x3d,0x1,0xac,0x23,
+0xce,0x4c,0x52,0x8e,0xe0,0x7e,0x70,0x1d,0xbe,0x64,0x61,0x8c,0x67,0x8a,0x23,0xdb,0xe5,0x8d,0x80,0xe,0xe2,0xaa,0x72,0x91,0x4f,0x5d,0x88,0xfc,0xbf,0x9f,0x3d,0x79,
+0xce,0x4f,0x53,0x53,0x4b,0xbe,0x34,0xf2,0xf6,0x9c,0xff,0x0,0x0,0x27,0x82,0x4d,0x39,0x73,0x5e,0xc8,0x87,0x6b,0x91,0xb6,0xc6,0xca,0xa0,0x3f,0x7b,0x77,0xa6,0x29,
+0x17,0x1c,0x79,0x78,0xe4,0xe7,0xe6,0xce,0x5,0x27,0x6,0x8a,0x4b,0xb8,0xf9,0x76,0x9e,0x44,0x6a,0x3a,0x92,0x23,0xe6,0x98,0xf1,0x80,0xd9,0xdd,0xfc,0x5c,0xff,0x0,
+0xbb,0x55,0x4a,0x52,0x43,0x4e,0x24,0x82,0x30,0xa7,0x68,0xf,0x95,0xec,0xa3,0x34,0x4,0x91,0x94,0xc8,0x8a,0x76,0x67,0x7,0xe7,0xa8,0xd5,0xb1,0x5e,0x31,0x7a,0x8c,
+0x6d,0xa4,0x80,0xcb,0xbc,0x64,0x9d,0xbf,0x4a,0x7a,0xb0,0x61,0xf2,0xb0,0x6d,0x98,0x18,0xed,0x4d,0x27,0x18,0xdd,0x94,0xd2,0x3,0x8c,0xe4,0x86,0x3d,0x7a,0xf0,0xa6,
+0x9b,0x27,0x92,0x92,0x29,0x7c,0x7d,0xce,0x98,0x3f,0x7b,0xd6,0xa7,0x56,0xc9,0xf2,0x17,0xdc,0x2e,0x37,0x72,0x77,0x67,0x75,0x46,0x7a,0x11,0xb7,0x8e,0xa7,0x15,0x52,
+0xdd,0xe,0x36,0xb8,0xe3,0xfe,0xa1,0x4f,0xf7,0x5b,0x70,0xfa,0xf4,0xa6,0xe,0xac,0x36,0xe7,0x9e,0x3d,0xe9,0xaf,0x21,0xe8,0x6a,0x2d,0xeb,0x43,0xa4,0x8d,0x2e,0x2b,
+0xa8,0xfe,0xcd,0x76,0x48,0x6f,0x31,0xbe,0xe9,0xe3,0x9a,0x8e,0x79,0x7c,0x92,0x67,0x4b,0xb5,0xfb,0x45,0xc8,0x31,0xcb,0xe6,0x46,0xc0,0x26,0x3a,0x56,0x31,0x8b,0x13,
+0x1e,0xeb,0x14,0x6a,0xb6,0xd6,0xca,0x1d,0x13,0x6c,0xb2,0x49,0x83,0x99,0x2a,0xda,0x4b,0x2c,0x16,0x72,0x6a,0xb7,0x4e,0x3f,0xb9,0x2,0xec,0xf9,0x95,0x33,0xd2,0x8b,
+0x5d,0x6a,0x43,0xe5,0x16,0x29,0x60,0xb0,0x8e,0x4d,0x5a,0xf4,0xff,0x0,0xa7,0x4e,0x78,0xf2,0x89,0xef,0xfc,0x35,0x6a,0xc2,0xc0,0x4d,0x7d,0xfd,0xa7,0xac,0xcb,0x6f,
+0x98,0xfe,0x61,0x16,0x48,0x8e,0x2c,0x77,0xac,0xdc,0x64,0x8c,0xe5,0xe6,0x25,0xcd,0xfe,0xa3,0xad,0xc6,0x6,0x96,0x26,0xb5,0xb6,0x67,0xc4,0xb7,0xce,0xc7,0xe7,0xa9,
+0xe4,0x6b,0x1f,0xe,0x42,0x90,0xda,0xa3,0xc8,0x4b,0x7d,0xc2,0xc4,0x3c,0xfe,0x94,0x96,0xfc,0xa0,0x96,0x96,0x33,0x84,0xcf,0xf,0x9f,0x79,0x70,0x23,0xfb,0x74,0xd9,
+0x58,0x22,0x71,0xbf,0xcb,0xfe,0xea,0xd1,0x4,0xc3,0x46,0xd3,0x8b,0xdc,0x31,0x7b,0x89,0x64,0x6d,0xdb,0xf,0xfa,0xd6,0xe3,0x8a,0xb9,0xa2,0xd1,0x62,0xc2,0xc6,0x7b,
+0xfb,0xc9,0x35,0x2d,0x62,0x12,0xf2,0x28,0x1f,0x66,0xb6,0x3f,0x75,0x7b,0xd4,0x17,0x45,0xb5,0x5d,0x59,0x17,0xe5,0x36,0x91,0x36,0xe6,0x95,0x89,0x3e,0x73,0x52,0xbd,
+0xf6,0x25,0x72,0xf3,0x68,0x47,0x64,0x8d,0xaa,0xde,0x46,0xf2,0x44,0xa2,0xd6,0x27,0xd9,0x18,0x23,0xef,0xb6,0x7a,0xd4,0xf7,0xfa,0x84,0x93,0x5e,0xb,0x2d,0xe,0x3f,
+0x32,0x45,0xff,0x0,0x5b,0x30,0x5e,0x12,0x8d,0x56,0xa0,0xec,0x2d,0xb5,0x9d,0xbe,0x8f,0xa7,0xcf,0x77,0x33,0xb3,0xdd,0x6d,0xe6,0x52,0x7f,0xf1,0xda,0x83,0x4a,0x88,
+0xc9,0xe6,0xdf,0xdf,0x42,0x30,0xf8,0xf2,0xb7,0xe5,0xb6,0x28,0xea,0x69,0x6a,0xc2,0xf1,0x6a,0xe5,0x6b,0x9b,0xb9,0xf5,0x7b,0x8f,0xec,0xdb,0x11,0xb6,0xd1,0xdb,0xfd,
+0x64,0x99,0xe9,0xeb,0x5b,0x36,0xf6,0x36,0x16,0x96,0xe7,0xec,0xd0,0xb7,0xee,0xfe,0xfc,0xad,0xdc,0xd1,0x29,0x4a,0x2b,0x96,0x20,0xf4,0x39,0x30,0xf1,0xa2,0x85,0x91,
+0xc6,0x7d,0x40,0xc5,0x42,0x4c,0x6f,0xe,0x6,0x14,0x9f,0xbf,0x9e,0x2b,0xbb,0xea,0xf2,0xbf,0x31,0x5f,0xe,0xc5,0x9d,0xcc,0xb,0xb1,0x50,0xf,0xf7,0xb6,0x75,0xf6,
+0xa6,0xee,0x62,0x3e,0x51,0xbb,0x3,0x8d,0xe4,0xe7,0x14,0x96,0xb2,0x29,0xbb,0x8,0xfc,0xb9,0xe4,0x1e,0x73,0xf2,0x52,0xc7,0xfe,0xb7,0x7c,0x98,0xdc,0xc7,0xa3,0x7a,
+0x55,0x3a,0x83,0x8a,0xbe,0xa2,0x9f,0x95,0x38,0x9a,0x27,0x19,0xff,0x0,0x96,0x7b,0xaa,0x46,0x92,0xe3,0xcb,0x53,0xb8,0xb4,0x4b,0xda,0xa1,0x13,0xa5,0xc8,0xbe,0x4d,
+0xaa,0xf,0x1,0x6,0x7,0xe7,0x4e,0x7e,0x1b,0x25,0xe2,0xf,0x8e,0x9e,0x94,0x6a,0x5b,0x6c,0x62,0xb7,0x97,0x90,0xac,0xe7,0x77,0x3f,0x28,0xf9,0x77,0x54,0xab,0x20,
+0xda,0x4a,0xb9,0xde,0xc3,0xe6,0xdb,0xdc,0xe2,0x94,0xd4,0xb7,0x44,0x8c,0xc9,0xce,0x77,0x26,0x7f,0x43,0x4f,0x46,0x21,0x9f,0xee,0x2b,0xf,0xbb,0xb1,0x7a,0x9a,0x71,
+0xd6,0x21,0x68,0x5c,0x3f,0x79,0x1f,0xcd,0xf3,0x70,0x31,0x81,0xc0,0xa6,0x79,0xdb,0xb,0x49,0xe5,0xc7,0x83,0xe8,0xb4,0xac,0xd8,0x9a,0x8c,0xb6,0x1c,0xbf,0x2f,0xde,
+0x90,0x29,0xff,0x0,0x64,0x66,0x99,0xb4,0x7f,0xc,0xed,0xbf,0x7e,0xf2,0xcd,0x1d,0x69,0x1b,0xf4,0x1,0x1b,0x78,0xe5,0x48,0x2d,0xd3,0xeb,0x52,0xef,0xce,0x0,0x76,
+0xfa,0x72,0x2a,0x41,0xb1,0x5b,0x86,0x55,0x23,0xa8,0xdf,0x43,0x36,0xcf,0xf5,0x4d,0x95,0x1f,0x7c,0x79,0x79,0xc9,0xa8,0xbc,0x9e,0xe2,0xf8,0xb7,0x10,0xe3,0x77,0xef,
+0x1c,0x2c,0xa7,0x1f,0x75,0x4d,0x37,0xe5,0xf3,0xe,0x44,0x4c,0x7f,0xdc,0xe9,0x4f,0x5e,0x53,0x4b,0x44,0x31,0x9d,0xe1,0x24,0x85,0x78,0xfe,0x2e,0xb4,0xb2,0x1c,0xab,
+0x79,0x7b,0xd7,0x1d,0x32,0xbd,0x5,0x38,0xfb,0xda,0x9,0xa4,0x21,0x62,0x7e,0xeb,0x60,0x7d,0x33,0x4b,0x17,0xdc,0xfb,0xec,0xa3,0x7f,0xcc,0x71,0x9c,0xd5,0x35,0xa6,
+0x83,0x76,0x15,0x89,0x2e,0xe0,0x63,0x68,0xfe,0x33,0xc9,0x34,0x9f,0x36,0x4a,0xee,0xdc,0x99,0x27,0x25,0x3f,0x2a,0xc9,0x2e,0x6d,0x19,0x3e,0xec,0x43,0x5,0x80,0x0,
+0x36,0x7,0x56,0xdb,0x81,0x90,0x2a,0x31,0xc7,0x23,0xbd,0x3b,0xdb,0xdd,0x2a,0xc9,0x9a,0x7a,0x74,0xfa,0x5c,0x36,0xca,0x2f,0x76,0x31,0x19,0xe3,0xc8,0xdc,0x5a,0xa0,
+0x49,0xe0,0x47,0xba,0x1b,0x27,0x9e,0x2b,0xa4,0xf2,0xed,0xe4,0x2b,0xf3,0x6,0xc8,0x35,0x36,0x9f,0x52,0x5c,0x7,0x2b,0xcc,0xb1,0xfd,0x88,0xa0,0x8e,0x79,0xe5,0x2e,
+0xfb,0xd3,0xe7,0xdb,0x52,0x5b,0x18,0x64,0xba,0x8d,0xa4,0x68,0x4,0x56,0x83,0x2a,0x24,0x53,0x82,0x69,0xdb,0x42,0x39,0x49,0x63,0x30,0xdf,0xdc,0x9b,0xdb,0x92,0xbf,
+0x65,0x52,0xde,0x58,0x3c,0x7e,0x35,0x2a,0x43,0x2f,0x88,0x2e,0x3f,0x7b,0x2b,0xc5,0x60,0x1b,0xe4,0x41,0xcb,0xcb,0x51,0x26,0xca,0x2e,0xdd,0x6b,0x2b,0x15,0xc7,0xd8,
+0xb4,0x7b,0x68,0x6e,0x25,0x4c,0x47,0x18,0x8d,0x7f,0x75,0x1e,0x6a,0x28,0x6c,0x22,0xb2,0xb5,0x9b,0x50,0xd4,0xe7,0x32,0xdd,0x6,0x21,0xdd,0x89,0xfa,0xe2,0xb3,0xbf,
+0x2e,0x86,0x5e,0xec,0x4a,0x6b,0x89,0x2e,0xfe,0xdb,0x29,0xf2,0xe1,0xb,0x9b,0x70,0xc4,0x2,0xaa,0x7f,0x8a,0xa4,0xd2,0xa0,0x96,0xf2,0x7f,0xed,0xb,0xc5,0x64,0x64,
+0x93,0xf7,0x2a,0x13,0xe5,0x1e,0xb5,0x72,0x9e,0x81,0xcf,0x61,0xf7,0x3a,0x95,0xd6,0xa5,0x70,0xf6,0x1a,0x6c,0xc3,0x6b,0xf1,0x71,0x71,0xcf,0xdd,0xef,0x55,0x27,0x55,
+0x82,0x38,0xf4,0xfb,0x59,0x50,0x79,0xbf,0x7d,0x76,0xe7,0xe4,0xee,0x69,0x43,0x4d,0x91,0x51,0x82,0x44,0x92,0x48,0xd2,0x95,0xd3,0x74,0xad,0x88,0xae,0x76,0xc9,0x38,
+0xfb,0xa8,0x3a,0x1a,0xb9,0x1b,0xda,0xe8,0x3a,0x73,0xc6,0x43,0xb4,0x62,0x5e,0x7b,0x34,0x8d,0x53,0x3f,0x7f,0xdc,0xb,0xd8,0xa5,0x5,0xb4,0xda,0xbc,0xbf,0x69,0xbb,
+0xfd,0xdc,0x3f,0x78,0x40,0x72,0x57,0x81,0xd6,0xaa,0x5c,0x48,0xfa,0x8d,0xc8,0x82,0xca,0x5c,0x42,0x17,0xf7,0x8c,0x13,0xa,0x9e,0xd5,0x51,0x98,0x95,0x8d,0x90,0xd6,
+0xba,0x36,0x9e,0x70,0xab,0xe5,0x71,0xfe,0xfc,0xad,0x59,0x2c,0xd7,0xfa,0xc6,0xe9,0x6,0x12,0xc5,0x65,0x24,0x74,0x19,0x35,0x31,0xbc,0x7f,0x78,0x3b,0xfd,0xa3,0x1d,
+0x71,0xe8,0xb,0x77,0xe3,0xa5,0x0,0x7,0xe5,0xf2,0x49,0x4f,0xd6,0xbb,0xe5,0x35,0xf1,0x1a,0x6f,0xa8,0xf7,0x72,0x33,0x9e,0xbe,0xf4,0xa4,0xfd,0xc3,0x83,0x85,0xe1,
+0x58,0x7a,0xd2,0x8f,0x72,0xad,0x76,0x26,0xe3,0xc6,0x3b,0x1c,0xe0,0x53,0xd9,0xfa,0x9c,0x7d,0xe3,0xc0,0xaa,0x9a,0xb9,0x1e,0xf2,0x62,0xc4,0x33,0xff,0x0,0x3d,0x78,
+0xe7,0x6e,0xec,0xc,0xd3,0x5c,0x2f,0x95,0x95,0x12,0x29,0xcf,0xf1,0x1c,0xd6,0x7b,0xbd,0x4b,0xbb,0xea,0x3b,0xe5,0xea,0xcb,0xb8,0x7b,0xd0,0x3e,0x40,0xce,0x8c,0xf9,
+0xc1,0xa4,0xee,0xb4,0x44,0xfa,0x87,0xcd,0xc7,0x38,0xe,0x3,0x13,0xef,0x8a,0x7e,0xdc,0x1e,0x91,0xaa,0xbf,0xfb,0x58,0xc6,0x28,0xdc,0x56,0xb6,0xc2,0x2a,0xff,0x0,
+0xb4,0xbc,0x72,0x39,0xa4,0x6f,0x97,0xf7,0x8d,0x9d,0xbd,0x7,0xfb,0x54,0x97,0x60,0xb0,0x0,0x0,0x0,0xb6,0xd6,0x1f,0xc1,0x9d,0xdc,0x51,0xd0,0xed,0xe8,0x29,0xb5,
+0xd4,0x4b,0x7b,0x2,0x9e,0x78,0x1c,0x7b,0xd3,0x7e,0xf6,0x7d,0x7,0x1b,0xbd,0x6a,0x95,0xb7,0x2e,0xd6,0x1d,0x9d,0xd2,0xa6,0x1b,0x82,0x3e,0x63,0xef,0x4f,0x6c,0x63,
+0x68,0x6d,0xf8,0xe4,0x7c,0xf4,0x4f,0x95,0x3b,0x99,0xbb,0xc9,0xd8,0x14,0xca,0x32,0xa8,0xde,0x59,0x23,0xa6,0xd0,0xd9,0xa5,0xc6,0x51,0x77,0x1e,0x4f,0x0,0xd4,0x73,
+0x47,0x98,0xa5,0x11,0xa0,0x92,0x1b,0xd8,0xe2,0x9a,0x77,0x60,0xed,0xc7,0x3f,0xc5,0xc6,0x69,0xb6,0x97,0xba,0x5f,0x90,0x9b,0xd8,0x8c,0x7c,0xd9,0xa9,0xe,0x7f,0x84,
+0x64,0x13,0xc8,0xdf,0x8a,0x3a,0xd8,0x89,0x68,0x34,0xb0,0xfc,0x7d,0x33,0x4b,0x8a,0x5c,0xc2,0x8c,0x6e,0xae,0x37,0xbb,0x72,0x42,0x8e,0xfd,0x8d,0x19,0xf2,0xc9,0xee,
+0xca,0x78,0x20,0xe7,0x75,0x1c,0xcb,0xa0,0x6e,0x84,0x3f,0x23,0x6d,0xf,0xfc,0x79,0xc8,0x61,0x8c,0xd0,0x73,0x95,0x1b,0xf8,0xe7,0x70,0xa0,0x68,0x9a,0xd6,0xe5,0xa0,
+0xb8,0x8d,0xa3,0x46,0x67,0x7,0x85,0x5e,0xb5,0xa3,0x77,0x71,0x7b,0xa8,0x41,0x1c,0x12,0x5b,0xc5,0x17,0x96,0xe1,0xe3,0x73,0x26,0xe6,0xcd,0x43,0x57,0xea,0x6,0x74,
+0x93,0xcc,0x6e,0x7e,0xd1,0x36,0x7c,0xe5,0xc0,0xe3,0x1d,0x5,0x3d,0xb,0x8b,0x25,0xb3,0x56,0xff,0x0,0x5c,0x43,0xc8,0xdb,0xb8,0xc7,0x7a,0xbf,0x77,0xa9,0x2e,0xec,
+0x95,0xfc,0xbb,0x89,0x45,0xa2,0x7e,0xea,0xda,0x2f,0xbf,0xb7,0x6,0xac,0xc9,0x34,0xf7,0xee,0xd6,0x76,0x38,0x8a,0x35,0x3c,0xca,0xbc,0x63,0x1d,0xab,0x27,0xb8,0x9e,
+0x85,0xb9,0x2e,0x6c,0xf4,0x4b,0x5f,0xb1,0xda,0x47,0x39,0x9a,0x51,0xf7,0x14,0xfc,0xcc,0x7d,0x6a,0x8,0xed,0xae,0xaf,0xe5,0x17,0x5a,0x98,0x7c,0x21,0xf9,0x22,0x7,
+0x1e,0x5e,0x3b,0xd4,0x72,0xad,0xc5,0xcb,0xf6,0x8a,0xdb,0x5b,0x51,0x94,0x47,0x14,0x7b,0xac,0xa2,0x93,0x7b,0x1c,0xa8,0xcd,0x12,0xb1,0xb9,0x98,0xd9,0x5b,0x17,0xa,
+0x83,0x2f,0x20,0xed,0xdf,0x15,0x65,0x32,0xc3,0x5c,0xdb,0x68,0xf6,0xcb,0x4,0x4b,0x74,0x8c,0xc3,0x77,0xe,0x3e,0x6f,0x7a,0xa6,0x8e,0xf0,0x8,0xa3,0x5d,0xdf,0x68,
+0xb8,0x7c,0xf5,0x18,0x5,0xaa,0xd2,0xea,0xc3,0xcc,0x9a,0x19,0xd3,0x4f,0xb5,0x2,0x5f,0xbd,0xc9,0x2b,0x9f,0xbc,0xf4,0x96,0x50,0x89,0xe7,0xfe,0xd0,0xbe,0xdb,0xe6,
+0x37,0xef,0x12,0x3d,0xbf,0x28,0xf7,0xa8,0x92,0xb6,0xa6,0x7c,0xbb,0xb1,0x6f,0x2f,0x64,0xd4,0x3f,0xd1,0x6c,0x63,0xcc,0x5c,0x2b,0xce,0xdc,0xd4,0xde,0x62,0x69,0x96,
+0x6b,0xd0,0xc6,0xe,0xdf,0x97,0xac,0xd5,0x3c,0xba,0x58,0x6b,0x6b,0x14,0xa2,0xb5,0x7d,0x46,0x43,0x77,0x7a,0x76,0x2b,0x30,0xc2,0x29,0xe7,0x1e,0x95,0xa1,0x73,0x75,
+0x5,0xa0,0xc3,0x37,0x97,0xb4,0x61,0x62,0x15,0x5c,0xaa,0x42,0x6d,0xde,0xc8,0xe7,0x5e,0x66,0xc0,0x5,0x10,0x8f,0x41,0xc5,0x0,0x28,0xc,0xac,0x6,0xd3,0xfc,0x4d,
+0x9e,0x3d,0xab,0x77,0xb,0x68,0x6b,0xcb,0xa6,0x82,0x4,0x42,0x57,0x90,0x3,0x74,0xa4,0x55,0xdb,0xf7,0x8b,0x64,0xe3,0x23,0xf1,0xa4,0xa5,0x64,0x52,0x9e,0xa3,0xdb,
+0x84,0xc9,0x8c,0x8f,0xd6,0x97,0xf7,0x68,0xc5,0x5d,0x99,0x57,0xb6,0xd1,0x9a,0x4a,0xa3,0x5b,0xe,0xc2,0xfa,0xa7,0xaf,0x1c,0x52,0x30,0xd8,0xbf,0x77,0xa3,0x67,0xf1,
+0xa2,0x15,0x2c,0xec,0xd1,0xb,0x7b,0xe,0x5e,0x9f,0x32,0x16,0xde,0x7e,0x5c,0x2,0x28,0x57,0x19,0xdd,0x85,0x3b,0x79,0x19,0xed,0x4f,0x66,0x53,0xf2,0x11,0xd7,0x1b,
+0xbb,0x29,0x6e,0x36,0xf7,0xc8,0xa7,0x74,0x44,0x2f,0x1c,0x63,0xaf,0xcc,0x17,0x9a,0xb7,0x53,0xdd,0xd0,0x69,0x68,0xd,0xcf,0x53,0xb6,0x95,0xb0,0xb8,0x38,0xef,0xdc,
+0x56,0x7c,0xee,0x4e,0xc8,0x2d,0xa0,0xe1,0x86,0x1f,0x75,0x9c,0x67,0xae,0xde,0x29,0x36,0x5,0x91,0xbe,0xe4,0x64,0x1d,0xbd,0x7a,0xd3,0x73,0xe8,0x66,0xae,0x47,0xbb,
+0x70,0xe6,0x46,0xe4,0x7e,0x54,0xaa,0x73,0x2e,0x15,0x80,0xeb,0x95,0x1c,0x6d,0xaa,0xbd,0xba,0x1a,0xc9,0x74,0x1c,0x4c,0x7c,0x99,0x66,0xd8,0x54,0xff,0x0,0x2,0xd2,
+0x65,0x71,0x8f,0xe0,0xff,0x0,0x67,0xe5,0xa5,0x67,0x26,0x4c,0x6e,0xb,0xf7,0x8b,0xf0,0x3f,0x77,0xbc,0x8f,0x7c,0xd2,0x1f,0xbd,0xcf,0xcb,0x8e,0x4e,0x7,0x18,0xac,
+0xfe,0xd0,0x7c,0xc7,0x9f,0xdd,0x37,0x3f,0x5a,0x6f,0x0,0x8e,0x2a,0x9c,0xba,0x92,0xee,0x39,0x77,0x33,0x9f,0x94,0x63,0xd8,0x52,0xe5,0x33,0xf7,0x54,0x90,0x70,0x78,
+0xa5,0x29,0xf6,0x1f,0x29,0x1e,0x44,0x63,0x60,0x2d,0xc9,0xe7,0x77,0x6a,0x25,0x60,0x65,0xce,0xe4,0xc3,0x1f,0xe1,0x3d,0xa9,0xef,0xab,0xd,0x86,0x96,0xf9,0x9d,0x71,
+0x91,0x4d,0x2d,0xcf,0xbf,0xd2,0xa6,0x28,0x23,0x62,0x50,0x8c,0xa,0xb3,0xc4,0xdb,0x7e,0x9d,0x69,0x9d,0xf1,0xdc,0x75,0xab,0xe6,0xd,0x4,0xe,0x63,0x7c,0xaf,0x5c,
+0xd6,0x8d,0xb3,0x5e,0x5c,0x9c,0x79,0xd1,0x44,0x3f,0xbc,0xb1,0x64,0xd2,0x6e,0xc2,0x71,0x5f,0x10,0xdb,0xcb,0x58,0x61,0x8f,0x71,0xbb,0xf3,0x67,0xee,0xac,0x36,0xee,
+0xaa,0x51,0xca,0x13,0x7f,0x38,0xe3,0x8f,0xad,0xa,0x4e,0x5d,0x9,0xd7,0xa1,0x69,0xa5,0xfb,0x3c,0x4d,0x1c,0x5f,0x3b,0xbe,0x59,0x95,0xfd,0xfa,0xd5,0x95,0x97,0xec,
+0xab,0x1c,0x16,0x9b,0xa6,0x61,0xbb,0x8e,0xb8,0x1e,0xb5,0x9b,0x7a,0x95,0x6b,0xee,0x4b,0x2,0xdb,0xe9,0x96,0xed,0x73,0x71,0xb2,0x59,0xfc,0xc2,0x77,0xff,0x0,0x4a,
+0x6e,0xe9,0x35,0x69,0x3f,0x78,0xcd,0x6d,0x6a,0x3a,0x46,0xc3,0x99,0x6a,0x5d,0xed,0xcc,0x2b,0x76,0x22,0x9a,0x68,0xe3,0x67,0xb5,0xb1,0x48,0xc6,0x5f,0x4,0xed,0xe8,
+0xbd,0xd,0x22,0xba,0xe9,0xd6,0x88,0xa3,0x63,0x6e,0xe9,0xf2,0xed,0x2d,0x55,0xef,0x58,0x2c,0x44,0x22,0x51,0x14,0xf7,0x57,0x3e,0x5c,0xae,0xcb,0xe6,0x1,0xc9,0xa7,
+0x43,0x22,0x2a,0x4b,0x75,0x36,0x51,0x9b,0xee,0x4,0x4d,0xdc,0x7a,0x53,0x6e,0xeb,0x41,0xda,0xe2,0xf9,0x72,0x5c,0x30,0x9e,0xec,0xfc,0xa8,0x30,0x9f,0x28,0x5d,0xbe,
+0xf4,0xeb,0xbb,0x97,0xd4,0x5b,0x64,0x70,0xc5,0xd,0xb3,0x39,0x69,0x1a,0x14,0xfb,0xed,0x52,0x89,0x69,0x5c,0x59,0x65,0x82,0xca,0x33,0xb1,0x17,0x3c,0xd,0x8b,0xc1,
+0x3c,0x54,0x29,0xb,0x5c,0x5c,0x7d,0xaa,0xe5,0x57,0x91,0xf2,0xc7,0xd3,0x68,0xa7,0xd2,0xe1,0x15,0xd4,0x9a,0xe2,0xf9,0x22,0x25,0x76,0x86,0x98,0x30,0xa,0x8,0xf9,
+0x45,0x41,0x6d,0x68,0xb2,0xbb,0x4d,0x78,0xfb,0x9d,0x88,0x20,0x1a,0x77,0x71,0x43,0x5e,0xee,0xa5,0x2,0x56,0x32,0xcd,0x8d,0xdf,0x8d,0x2f,0xcd,0xe6,0x63,0x24,0x2f,
+0xf1,0x6e,0xae,0x89,0x34,0x16,0x42,0xe4,0x2b,0x61,0x55,0x76,0xf5,0xf6,0xa6,0x31,0xdd,0x9d,0xb8,0xcf,0xb7,0x4c,0x56,0x69,0x75,0x2b,0x97,0x97,0x52,0x52,0x63,0xd8,
+0xe9,0x8f,0x97,0xa0,0x60,0xbc,0xf5,0xcd,0x34,0xb2,0xb1,0xc6,0xc5,0xdc,0x7b,0x92,0x6b,0x4b,0x75,0x1a,0x7a,0xe,0x59,0x33,0x19,0xfd,0xf2,0xe0,0x7c,0xd8,0xd9,0xde,
+0x90,0xec,0xc0,0x6f,0x97,0x24,0x93,0x95,0xa4,0xac,0x4e,0xdb,0x4,0x8f,0xf7,0x4a,0x9f,0x96,0xa4,0x4f,0x93,0xa,0xca,0x9f,0x27,0x5d,0xa8,0xe,0xea,0x57,0xb2,0x1d,
+0x86,0xe7,0x9e,0x49,0xe3,0x80,0x4f,0x14,0x8b,0xe5,0xb1,0x1c,0xe5,0x79,0x62,0x71,0xfa,0x50,0x1a,0x8f,0xcf,0x99,0x23,0x64,0x2e,0x5f,0x93,0x44,0x98,0x69,0xb,0xc,
+0x7e,0x9,0x4a,0xdc,0xaf,0x40,0x57,0x10,0x18,0x32,0x37,0xd,0xc3,0xfd,0xa1,0x48,0x70,0xd1,0xa8,0x4c,0xef,0x5e,0x86,0xa1,0xb7,0x1d,0xc5,0x5,0x2e,0x83,0x98,0xab,
+0x27,0xca,0x31,0xf3,0x8e,0x9e,0x94,0x84,0xe7,0x60,0x20,0x30,0x56,0xdc,0x72,0x3a,0xd3,0x83,0xee,0x1b,0xb1,0x16,0x4f,0x2e,0x45,0x23,0x3,0x9f,0xe2,0x6e,0xd4,0x17,
+0xd,0x96,0x29,0x82,0xdc,0x9e,0x6b,0x45,0xb9,0x7c,0xab,0x98,0x5c,0x96,0x72,0x4e,0xdf,0x9b,0xd2,0x96,0x4e,0x39,0x61,0xfc,0x59,0xcd,0x2b,0xa9,0x13,0x6d,0x6c,0x80,
+0xe5,0xc3,0x12,0x33,0x8c,0xe7,0x8a,0x66,0xec,0x81,0xb0,0xf4,0xa5,0xc8,0x96,0xa1,0x66,0x1c,0x37,0xfa,0xc8,0xfc,0xc3,0xf5,0xda,0x29,0x32,0x1,0xf9,0x69,0xe8,0xc5,
+0x6e,0x82,0xae,0xdd,0xdf,0x3f,0xd7,0xe6,0xa5,0xc4,0x42,0x52,0x9b,0x31,0xb7,0xd7,0xae,0x2a,0x56,0xe2,0x71,0xec,0x1e,0x9c,0xa9,0xa6,0x86,0x65,0xfc,0xfa,0x62,0xaa,
+0x36,0x2d,0x72,0x81,0x65,0x1d,0xb0,0x4b,0x73,0x49,0xb8,0x2,0xfb,0x81,0xeb,0x45,0xbb,0x15,0x61,0x37,0xfe,0xfb,0xbe,0xd1,0xf7,0x7e,0x5a,0x9e,0x32,0x8e,0xa7,0xed,
+0x32,0xcc,0x40,0xed,0x10,0x2,0x91,0x36,0x16,0x39,0x6c,0xa3,0x32,0x18,0xe3,0x91,0xcf,0x6c,0xf7,0xa8,0x6e,0xe,0x65,0x76,0x48,0xbc,0xb0,0xcd,0xf2,0xef,0x5a,0x49,
+0x5b,0x71,0x28,0x36,0x4b,0xd,0xc6,0xd2,0x66,0x25,0x4b,0x15,0xd9,0xc8,0xcd,0x4c,0xb2,0x2a,0x48,0x65,0x95,0x76,0xbb,0x31,0xe8,0x3b,0x52,0x9c,0x75,0xd0,0x3a,0x84,
+0x24,0x3b,0x34,0xf7,0x6b,0xbb,0x3,0x28,0x3e,0xee,0xcf,0x7a,0x92,0x5b,0xa9,0x6f,0x72,0xb6,0xe3,0x6a,0x72,0x92,0x4a,0xc7,0x3d,0x6a,0x1a,0xea,0x22,0x49,0x64,0xb5,
+0xb2,0x80,0xa2,0x33,0x96,0xe8,0xa3,0xae,0xe1,0x8a,0x8e,0xde,0x29,0x1e,0x7f,0x3e,0x6c,0x2c,0x81,0x73,0xc7,0xf0,0xfb,0xd1,0xcc,0xf9,0x76,0x27,0xd4,0x86,0x5b,0xa7,
+0xb8,0x25,0xdb,0x22,0x34,0x6f,0x37,0x1b,0x3e,0xf1,0xf5,0xa7,0xa1,0x82,0x46,0x92,0x49,0xfe,0x48,0x73,0x98,0xd4,0x71,0x8a,0x6e,0x3a,0x7b,0xa3,0xd7,0xa1,0x14,0xee,
+0x2e,0x66,0xc4,0x27,0xf7,0x6b,0xed,0xd6,0xa5,0x79,0xa1,0x81,0x36,0xd,0xde,0x6e,0xdc,0x0,0x17,0xa5,0x52,0x6f,0xa8,0xec,0x32,0xde,0x3f,0xde,0x79,0xd3,0x7c,0xd2,
+0xa9,0xc8,0x34,0x4f,0x79,0xb8,0xf9,0x71,0xd,0xc5,0xb2,0x18,0xed,0xa9,0x4c,0x9b,0x8f,0xb3,0x8c,0x45,0x86,0xa,0x3c,0xd3,0xc9,0x6c,0xd4,0x73,0xdf,0x89,0x30,0xb6,
+0xb1,0xec,0xfe,0xf1,0xe3,0x9a,0x71,0xf3,0x2e,0x1e,0xf0,0xd9,0x2d,0x0,0xcb,0x79,0xa8,0x3f,0xd8,0x19,0xe6,0x91,0xe0,0x6d,0xc4,0x6f,0x57,0x27,0xf8,0x86,0x71,0x4d,
+0x4a,0x49,0xd9,0xa2,0xe3,0x61,0x91,0xaa,0xba,0xa0,0xf9,0x17,0xdd,0xaa,0x41,0x6d,0x17,0x2e,0xd7,0xb0,0x8d,0xbd,0x46,0xca,0xa9,0x4a,0x65,0x4f,0x94,0x97,0xfb,0x3c,
+0x96,0x2a,0x26,0xe3,0x76,0xed,0xe6,0x3f,0x94,0xd4,0xa3,0x49,0x6e,0x3f,0xd2,0xa3,0xdb,0xea,0x50,0xe3,0x35,0x9c,0xa7,0x25,0xa1,0x1c,0xb1,0x43,0x7e,0xc2,0xe5,0x49,
+0xfb,0x54,0x4,0xf4,0xc1,0x53,0x41,0xd3,0x38,0xdd,0xf6,0xdb,0x5f,0x65,0xa,0xf4,0x26,0xd0,0xdb,0x44,0xd1,0xe8,0xb2,0x3a,0x6,0xfb,0x5d,0x9e,0x30,0xe,0x8,0x6c,
+0xd3,0xff,0x0,0xb1,0x5f,0xb5,0xf5,0xb7,0xbf,0xc8,0xfc,0x56,0x4e,0xab,0xec,0x44,0xa4,0x85,0x1a,0x19,0x5d,0xe8,0xd7,0x70,0x70,0xfc,0x3e,0xc2,0x77,0x53,0x9b,0x41,
+0xc,0x77,0x3d,0xfd,0xb2,0xe7,0xb0,0x8d,0xc9,0x34,0xbd,0xb5,0x45,0xf6,0x41,0x72,0x8a,0x3c,0x3c,0x9,0xf3,0x6,0xa3,0xb,0x2a,0xf5,0xcc,0xf,0xc7,0x1d,0x28,0x3e,
+0x1f,0x6f,0x95,0x93,0x52,0xb5,0x7c,0x8c,0xe0,0x46,0xf5,0x7f,0x59,0x9b,0xd6,0xc5,0xe8,0xb4,0x1c,0x3c,0x38,0xe1,0xbe,0x4d,0x46,0xd5,0xbf,0xeb,0xa2,0x38,0xc5,0x3c,
+0x78,0x6d,0xc0,0x1f,0xf1,0x32,0xb5,0x1f,0x48,0xde,0xa3,0xdb,0xf9,0xb,0x9a,0x31,0x13,0xfe,0x11,0x96,0xc7,0xfc,0x84,0xec,0xb8,0xe3,0x88,0xde,0x91,0x7c,0x39,0x29,
+0x6c,0x7f,0x68,0xd9,0xfd,0xef,0xee,0x3f,0x35,0x2b,0x13,0x2f,0xe5,0x26,0xf0,0xb8,0xf4,0xf0,0xd9,0x20,0x31,0xd4,0x62,0xc3,0x7f,0xd3,0xb1,0x6c,0x52,0x5c,0xf8,0x7e,
+0x2b,0x65,0x53,0x2e,0xb5,0x6b,0x18,0xce,0x32,0xf1,0x30,0xad,0x3e,0xb1,0x37,0xb4,0x47,0xed,0x12,0x33,0x4e,0x9e,0x93,0x36,0xcd,0x36,0xf0,0x5f,0x37,0xa4,0x56,0xf2,
+0xe,0x6a,0xe4,0x7e,0x1f,0x99,0xa4,0x1e,0x7d,0xc5,0xbc,0x1c,0xf0,0x1c,0x17,0x14,0xf9,0xda,0xdd,0xd,0xcd,0x12,0x7f,0xc2,0x33,0x99,0x77,0x2e,0xa1,0x66,0xe7,0x39,
+0xca,0xac,0x94,0x9f,0xf0,0x8e,0x90,0x87,0x66,0xa3,0x67,0xc3,0x1e,0x91,0x3d,0x67,0xf5,0x97,0x7f,0x84,0x15,0x48,0x8c,0x7f,0xe,0x49,0x82,0x4e,0xa3,0x68,0x14,0x9c,
+0xf0,0x8f,0xd6,0xa5,0x7f,0xc,0x91,0x8d,0xda,0x9d,0xa0,0xc7,0x4f,0xdd,0xbe,0x69,0x7d,0x77,0xa2,0x89,0x2d,0xc4,0x63,0xe8,0x41,0x37,0xbb,0x6a,0x30,0xbf,0x7f,0xf5,
+0x4,0xd4,0x72,0x68,0xaa,0x83,0xcc,0x93,0x53,0x81,0x99,0xfe,0x6e,0x21,0x73,0x9a,0x6a,0xbc,0xf7,0xe5,0x2d,0x59,0x8d,0xfe,0xc3,0x6d,0xbf,0xbc,0xbc,0x81,0x73,0xff,
+0x0,0x4c,0x9a,0x90,0x68,0x4e,0xed,0xfb,0x9b,0xd8,0x24,0xc7,0xf7,0x62,0x92,0xad,0x62,0x64,0x95,0xec,0x4e,0x97,0x2c,0x27,0x86,0x6e,0x3f,0xe5,0xae,0xa3,0x6b,0x1,
+0xcf,0x1b,0x95,0xf9,0xa5,0x7f,0xc,0xed,0xf,0x2c,0x9a,0xa5,0xa6,0x6,0x58,0xfe,0xea,0x43,0x47,0xb7,0x93,0xd5,0x44,0x7e,0xea,0x66,0x6c,0xf6,0x5,0x3e,0x61,0x73,
+0x1c,0x8a,0xf,0x18,0x46,0xa9,0x2d,0xb4,0xc0,0xd7,0xd1,0x25,0xc5,0xe5,0xad,0xbc,0x4c,0xd8,0x79,0x19,0x5b,0x62,0x8e,0xe6,0x87,0x52,0x56,0xd8,0x7c,0x8a,0xfa,0xb3,
+0xa4,0xd2,0xbc,0xb,0xac,0xeb,0x32,0x6e,0xb5,0x8a,0x18,0x6c,0xd7,0x6e,0x2e,0x6f,0xad,0xda,0x11,0x28,0x3d,0xe9,0xda,0xcf,0xc3,0xe9,0x34,0x98,0x1e,0x4b,0xef,0x12,
+0xe9,0x70,0x3a,0x29,0x74,0x8a,0x4d,0xc8,0xcf,0xed,0x59,0x46,0xb4,0xbb,0xa,0x52,0x85,0xec,0x72,0x7f,0x62,0x47,0xd9,0xe4,0xcc,0x66,0x49,0x1b,0xe7,0x74,0xb7,0x6d,
+0xa8,0x3b,0xd7,0x4f,0xa4,0xf8,0x26,0x4d,0x76,0x7b,0x84,0x83,0x5b,0xd3,0xda,0x18,0x1b,0x6f,0x98,0x22,0x93,0x6b,0x1a,0xd6,0x55,0xe5,0x6d,0x89,0xf7,0x56,0xac,0x5b,
+0x5f,0x4,0x49,0xab,0xdf,0xdc,0xc1,0x61,0xac,0x5a,0xcf,0x61,0x69,0x85,0x6b,0xc3,0x3,0x2a,0x19,0x7f,0xe7,0x9d,0x37,0x5d,0xf0,0xac,0xfa,0x45,0xe5,0xb6,0x95,0x6,
+0xa3,0x65,0x77,0xab,0x5c,0x32,0x28,0xb5,0x82,0x7,0xdc,0x89,0xeb,0x59,0x2a,0xb3,0x7d,0x9,0xe6,0x83,0xd1,0x1a,0xf2,0x7c,0x30,0x9e,0xc2,0xda,0xe2,0xf7,0x52,0xd6,
+0xf4,0xc8,0x63,0x5f,0xde,0x4f,0x2b,0x44,0xec,0x22,0xf5,0xac,0xed,0xf,0xc0,0x7a,0x87,0x89,0x45,0xcc,0xd6,0xf7,0xb0,0x47,0xa6,0xa3,0xb2,0x41,0x70,0xd0,0x38,0x37,
+0x1c,0xf0,0x68,0x75,0xde,0xed,0x15,0x7a,0x7b,0xdc,0x76,0x9b,0xf0,0xf2,0xe7,0x58,0xbd,0x99,0x34,0xfd,0x5a,0xca,0x5b,0x4b,0x72,0x23,0xfb,0x40,0x89,0xf6,0x49,0x27,
+0xf7,0x6a,0xbd,0x8f,0x81,0xa6,0xd5,0xb5,0x4b,0xab,0x3b,0xd,0x4e,0xd2,0x4b,0x4b,0x3e,0x26,0xbc,0x10,0xbf,0x97,0xbf,0x3c,0xa5,0x57,0xd6,0x67,0xbd,0x85,0xed,0x21,
+0xdc,0x67,0x89,0x3c,0x24,0x7c,0x3e,0xf6,0xd6,0x83,0x53,0xb5,0xbb,0xd4,0xa6,0xe2,0x3b,0x28,0x6d,0xdf,0x71,0x52,0xf,0x35,0xb3,0x67,0xf0,0xa6,0xf7,0x3,0xcc,0xd5,
+0xec,0x56,0x6c,0x6,0x75,0x10,0xb3,0xf9,0x75,0x2e,0xb4,0xd7,0x4d,0x4a,0x93,0xa6,0xb5,0xb9,0x86,0x3c,0x2f,0x3d,0xef,0x8a,0x22,0xd1,0xf4,0x7d,0x42,0xb,0xf1,0xf7,
+0xa7,0xbb,0x48,0x18,0x47,0xe,0x9,0xd,0x5b,0x12,0x7c,0x31,0x96,0xd2,0xc6,0x5b,0x99,0x35,0xfb,0x5,0xb7,0x85,0x37,0x49,0x2b,0xc3,0x20,0xda,0x2a,0xbe,0xb0,0xf6,
+0xb1,0x1c,0xf4,0xd6,0xec,0xc2,0xd1,0xfc,0x25,0x7b,0xe2,0x4b,0xf9,0x13,0x4b,0x96,0x16,0xd3,0xe0,0x72,0xbf,0x6e,0x96,0x36,0x8d,0x18,0x2,0x79,0xad,0xf1,0xf0,0xb2,
+0xe2,0x8,0x25,0x9b,0xfb,0x5a,0xc9,0xd2,0x31,0xb9,0x8f,0x92,0xe3,0x14,0xbe,0xb5,0x3b,0xfb,0xab,0x52,0xb9,0xa9,0x75,0x67,0x18,0xc1,0x78,0xf3,0xe,0x2,0xfd,0xec,
+0x75,0xf6,0xaa,0xcc,0xcc,0xab,0xb7,0x77,0x98,0xd9,0xe0,0x6e,0x38,0xae,0xde,0x69,0x48,0xa9,0x34,0xc5,0x20,0xc7,0x39,0x84,0x44,0x7c,0xc1,0xf3,0x60,0x91,0x8a,0x68,
+0x32,0x3b,0x65,0xd4,0x23,0x37,0xca,0x70,0xbd,0xe9,0x73,0x12,0x96,0xb7,0x2c,0x2d,0xd6,0x55,0x97,0x31,0x63,0x79,0xdc,0xc4,0x55,0xb8,0x64,0x72,0x80,0xba,0x28,0xd,
+0xc0,0xdb,0x9f,0xfb,0xea,0xa1,0xed,0xef,0xa,0xf7,0x64,0xd1,0x11,0xe6,0x7f,0xc7,0xbc,0x38,0xed,0xb3,0x8a,0x74,0x6c,0xfb,0x4,0x52,0x1,0xc0,0xf7,0xcd,0x64,0xfd,
+0xe2,0xa7,0xb6,0xa4,0xa0,0x9e,0x36,0xa4,0x6a,0x3a,0x60,0x53,0xd7,0x7e,0xd6,0x42,0xab,0x87,0x39,0x3d,0xb3,0xe8,0x29,0x74,0xd4,0xc3,0x7d,0x58,0xfc,0xfe,0xf1,0xb7,
+0x5,0xfe,0xeb,0x82,0x3a,0x1a,0x78,0x3f,0x23,0x60,0x7a,0xf0,0x3b,0xd3,0xbd,0x8a,0x6a,0xec,0x72,0x9f,0x9c,0x6e,0x4b,0x77,0x2b,0xf2,0x67,0x34,0xf5,0x77,0x5f,0xe0,
+0x43,0xfe,0xe2,0x9e,0x2b,0x29,0x6a,0x4b,0xb3,0x60,0xbf,0x75,0x23,0x60,0x29,0xf2,0x32,0xaf,0x1c,0x2f,0xd6,0x9f,0xbd,0x7d,0xa,0x48,0x6b,0x60,0x60,0x90,0x3d,0x37,
+0x67,0xe5,0xa6,0x19,0x21,0xdc,0xb8,0x1c,0x7f,0x17,0x63,0x43,0xbe,0xe4,0x5f,0xb9,0x1b,0xc4,0xf2,0x13,0xfb,0xec,0x40,0x3a,0x47,0x1b,0xb2,0x3,0x4c,0x82,0xce,0xca,
+0xd6,0x43,0x24,0x36,0x91,0xbb,0x63,0x1f,0xe9,0x3f,0xbc,0xaa,0x52,0xe8,0x8d,0x34,0xe8,0x58,0x33,0x93,0xc1,0x11,0xae,0x46,0x30,0xa3,0x2,0x90,0xfd,0xd1,0x85,0x8f,
+0x8e,0xbd,0x69,0xbe,0x61,0xc5,0x44,0x15,0x97,0xa3,0x95,0x40,0x4f,0x38,0xe0,0xd3,0x3c,0xe6,0x1b,0x56,0x34,0xf9,0x47,0xbe,0x4d,0x73,0xbb,0xec,0x16,0x88,0x8d,0x70,
+0xdb,0x4f,0xee,0xa2,0xcf,0x4f,0x97,0x34,0xcf,0xdf,0x49,0x83,0xc,0x4d,0x31,0xee,0x23,0xa7,0x18,0xf2,0xc6,0xe1,0xca,0x89,0xd2,0xd2,0xe7,0x3f,0x3a,0x45,0x8,0xc7,
+0x56,0xe4,0xd4,0xc9,0x66,0x83,0x6,0x40,0x92,0x62,0x97,0x3b,0x16,0x91,0xd5,0x12,0xec,0x8c,0x1c,0xf9,0x63,0xf1,0xf9,0xa9,0x77,0xe3,0x6e,0x44,0x65,0x3b,0x29,0x1c,
+0x9a,0xae,0x83,0x76,0x90,0xd4,0x6,0x5d,0x9f,0x2e,0x59,0x7b,0x54,0x37,0x7b,0x92,0xca,0xe0,0xcb,0xe5,0xe1,0x1,0x3f,0x27,0x3c,0x53,0x72,0xe8,0x89,0xbf,0x43,0x3,
+0x76,0xf2,0xbb,0x87,0xde,0xeb,0x4d,0x6e,0x57,0x6a,0xfd,0xde,0x95,0xba,0x4e,0xda,0x9a,0xe9,0x73,0xb9,0xf0,0xa6,0xb7,0xaf,0xea,0x69,0xf,0x87,0x22,0xd6,0xac,0xec,
+0xd4,0x31,0xd9,0x76,0xdf,0xbc,0xb8,0x65,0xed,0x1d,0x6c,0xea,0x16,0x5e,0x8,0xf0,0xbc,0xff,0x0,0x66,0xba,0xb6,0x7d,0x5f,0x5f,0x93,0x12,0x79,0x4e,0x8d,0x3c,0xf7,
+0x4e,0xd5,0x8d,0xdb,0x76,0x46,0xf,0x47,0xee,0x9c,0x16,0xad,0xa6,0x6b,0x96,0xd7,0xf2,0xad,0xce,0x9b,0x16,0x9f,0xbe,0x4d,0xeb,0xe7,0xc9,0xbb,0xa9,0x27,0x15,0x4a,
+0xd3,0x55,0x96,0x2d,0x26,0xf3,0x4e,0x8a,0xf6,0x4,0x17,0x2c,0xbe,0x63,0x20,0x65,0xd9,0xcf,0xcd,0x5b,0xc7,0x95,0xc7,0x42,0xbd,0xdd,0x8f,0x59,0xb9,0xd6,0xf6,0xa4,
+0x3e,0x1c,0xf0,0x85,0x84,0x4d,0x7c,0x22,0x5d,0xbb,0x86,0x2d,0xec,0xa3,0xc7,0xdf,0xa6,0xc7,0x63,0xa5,0x7c,0x3e,0xb2,0x97,0x52,0xd4,0x2e,0x26,0xbe,0xd6,0x2f,0xe,
+0x3c,0xdf,0xf9,0x6f,0x72,0xdd,0xd6,0xb9,0xb5,0xf8,0x11,0x94,0x74,0x21,0x87,0x4e,0xbd,0xd6,0x47,0xf6,0xc7,0x8d,0x3c,0x8b,0x2d,0x26,0xd8,0x79,0x90,0x69,0x85,0xbf,
+0x76,0xbf,0xf4,0xd2,0x9d,0x2e,0xa1,0x27,0x8c,0xd9,0xf4,0xfd,0x7,0xcc,0x83,0x42,0x8f,0xf7,0x77,0x57,0xd1,0xa6,0xc3,0x3f,0xfd,0x31,0xa8,0xb7,0xda,0x25,0xd3,0xec,
+0x65,0xea,0x9a,0x94,0xda,0xc4,0xc3,0xc1,0xfe,0xd,0x8e,0x3b,0x7b,0x78,0x63,0xf2,0xef,0xae,0xd3,0xee,0x41,0x17,0x74,0xad,0x2b,0xfb,0xdd,0x3f,0xc0,0x9a,0x2d,0xa6,
+0x9b,0xa3,0x5b,0x7d,0xa2,0xf2,0x57,0xc5,0xad,0xb9,0x3f,0x34,0x8e,0x7f,0x8e,0xb5,0x7a,0x68,0x69,0x6b,0x6e,0x2f,0x85,0x7c,0x34,0xda,0x2b,0xcd,0xaa,0xea,0xd3,0xc5,
+0x71,0xae,0xdc,0x7c,0xf3,0xdc,0x31,0xdc,0x2d,0xb3,0xda,0xb0,0xf5,0x2d,0x6e,0xff,0x0,0xc6,0x1a,0x84,0xbe,0x1d,0xf0,0x92,0x98,0x6d,0x7,0xfc,0x7e,0x5f,0x3b,0xff,
+0x0,0xe,0x7a,0xd6,0x54,0xfd,0xe6,0xea,0x48,0x49,0x7b,0x46,0x75,0x30,0xc5,0xa4,0x78,0x47,0xc2,0xfe,0x42,0xcc,0x60,0xd3,0x21,0xcb,0x33,0xbb,0x7c,0xd7,0x32,0x57,
+0x27,0x15,0xbd,0xef,0xc4,0x1b,0xf5,0xba,0xbe,0x12,0x58,0x78,0x5a,0xd9,0xfe,0x48,0xf3,0xf3,0xdc,0x7b,0x52,0x5a,0x7b,0xe2,0x56,0x6e,0xec,0xeb,0xb5,0x5d,0x53,0x4b,
+0xf0,0xce,0x8c,0x27,0xbe,0x8e,0x3b,0x6b,0x58,0x57,0x65,0xb5,0x94,0x3c,0x34,0x9e,0xd5,0xc6,0x44,0x7c,0x5b,0xe3,0x98,0xfe,0xd1,0x75,0xe5,0xe9,0xba,0x34,0x2f,0x95,
+0x8d,0x46,0xdf,0x37,0x35,0xad,0x27,0xec,0xbf,0x79,0x1d,0xc2,0x2a,0x2f,0xde,0x91,0xc4,0x19,0x2d,0xb6,0x31,0xb9,0x8b,0xef,0x75,0x64,0x6d,0xb4,0xc5,0xb1,0xb6,0x9e,
+0x73,0xe5,0x5f,0xc6,0xbb,0xbe,0x66,0x49,0x3f,0xe5,0x98,0xae,0xcf,0x7e,0xf,0x43,0x7d,0x9e,0xa5,0x29,0x6d,0xe6,0xb7,0xb7,0x2,0x58,0x4e,0xce,0xb9,0xd8,0x71,0x4b,
+0xbf,0x3e,0x63,0x6,0xc3,0x1f,0xe2,0x5a,0x4d,0x5d,0xdc,0xa9,0x6b,0xb0,0x9e,0x5e,0xd9,0xd4,0x5c,0x2b,0x23,0x29,0xf9,0x81,0x5e,0x2a,0xdd,0x97,0x16,0xed,0xb4,0x3a,
+0xc8,0x25,0xdd,0xca,0x71,0xcd,0x5d,0x77,0xa1,0x71,0xd3,0x52,0xf2,0x26,0xde,0x7c,0xde,0x9c,0x5,0xdb,0x4f,0x62,0x7c,0xb0,0x79,0xf9,0xe,0x57,0x27,0x35,0x8c,0x17,
+0x3b,0xb9,0x3b,0xc8,0x7b,0xe6,0x3e,0x23,0xcb,0x72,0x4b,0x67,0x9a,0x7e,0xf6,0xf3,0x2,0x37,0xfa,0xb3,0xe8,0xb8,0xa9,0xb6,0xa2,0x95,0x24,0x39,0xd8,0x99,0xe,0x42,
+0x9d,0xdf,0x36,0xec,0xd2,0xa2,0xe7,0x1f,0xbd,0x8d,0x7a,0x2f,0xcc,0x7b,0xd2,0x95,0xd1,0x9a,0xe5,0xb1,0x32,0xa7,0x3,0xde,0x9e,0x32,0x70,0x38,0xdb,0xd3,0xde,0x93,
+0xdb,0x50,0x56,0x62,0x8f,0x98,0xb9,0x67,0xc1,0x7,0xe5,0xfc,0xa9,0xd8,0xce,0x3e,0x72,0x47,0x72,0x3a,0x1a,0xcb,0x99,0xa6,0x21,0x59,0x7e,0x4d,0x9f,0x98,0xac,0xdf,
+0xde,0x7,0xdb,0x39,0x7e,0x9,0xc2,0xb5,0x55,0x29,0x69,0xca,0x3f,0x52,0x68,0x8e,0xd6,0x39,0xca,0xf,0xe7,0x4f,0xdf,0xcf,0x53,0xb6,0xae,0xdd,0x8a,0xb5,0x80,0xc9,
+0x94,0x60,0xb8,0x54,0xc,0x57,0x1b,0xb3,0x4d,0xf9,0xa4,0x73,0xb0,0x17,0xee,0x79,0xe0,0x52,0x93,0x76,0x17,0x31,0x2a,0xda,0xce,0xed,0x95,0x78,0xd4,0x7f,0xb5,0xd6,
+0xa5,0x4b,0x21,0xff,0x0,0x2d,0x1c,0x16,0x27,0x3f,0x25,0x61,0xe8,0x5c,0x6d,0x62,0x74,0xb7,0x48,0xc7,0xb,0xd4,0xf7,0x35,0x27,0x1d,0xce,0x2a,0xef,0x2b,0x19,0xe8,
+0x29,0xe5,0x87,0xb5,0x26,0x3a,0x8c,0xf0,0x4e,0x73,0x59,0xf2,0xdb,0x50,0xdf,0x71,0xb8,0xfb,0xa3,0x7a,0xe7,0xbd,0x33,0x0,0xed,0x6e,0x95,0x5c,0xe1,0xd4,0x31,0xf3,
+0xc,0x1f,0xaf,0xcb,0x50,0x5e,0x46,0xb2,0x5a,0x5c,0xf9,0xa5,0x86,0x62,0xdb,0xb9,0x7d,0x33,0x55,0x1d,0x18,0xde,0xe6,0x19,0x4e,0x73,0xc0,0x38,0xec,0x29,0x87,0x82,
+0x0,0xdb,0xef,0x5b,0xee,0xb5,0x34,0x44,0xda,0x7a,0xe9,0xf1,0x6a,0x69,0xf6,0xfd,0xe2,0xd8,0x6,0xfd,0xf4,0x52,0x14,0x29,0xc5,0x77,0xde,0x19,0xf1,0x6f,0x85,0xf4,
+0xab,0x28,0xad,0x34,0xd,0x32,0xfa,0xfb,0x50,0x95,0xd8,0xb2,0xc2,0x9b,0xa4,0x6c,0xd4,0x4d,0x4a,0x5e,0x86,0x32,0x8b,0x1f,0xe2,0x7d,0xb,0xc4,0x9a,0x8f,0x87,0xef,
+0x75,0x6f,0x12,0x6a,0xb0,0xda,0xb5,0x92,0x79,0xd1,0x5a,0x58,0x8c,0x28,0xf5,0x5a,0xf3,0x79,0x26,0x57,0x5,0x6c,0xa3,0xcc,0x47,0x39,0xf9,0x7e,0x45,0xa7,0x6,0xa5,
+0xaf,0x43,0x4a,0x4d,0x47,0x54,0x74,0x1e,0x14,0xf1,0x2b,0x68,0x1f,0xdb,0x93,0xb3,0x33,0xca,0xd0,0xc6,0xdb,0x3f,0xbc,0xc3,0x85,0xae,0xe3,0x4e,0x8e,0xdf,0x48,0xb1,
+0x7f,0x14,0xf8,0x9a,0xf0,0x5e,0x6a,0x8f,0x8,0x2c,0xe4,0xee,0x16,0xcb,0xff,0x0,0x3c,0xeb,0x2a,0x86,0x53,0x7a,0xdc,0x21,0xb1,0xb8,0xf1,0xa6,0xcb,0xdf,0x10,0xa4,
+0x96,0x7a,0x31,0x39,0xb3,0xd3,0x51,0xf6,0x99,0xbf,0xe9,0xad,0x47,0xa8,0xea,0x97,0x5a,0xcb,0x9f,0xf,0x78,0x2b,0xc8,0xb6,0xd3,0xed,0x7f,0x75,0x73,0xa8,0xaa,0xfe,
+0xea,0x3f,0xf6,0x29,0x43,0xbf,0x42,0x20,0xed,0xee,0x93,0x5e,0x5e,0xe9,0xfe,0x5,0xd1,0xed,0xf4,0xad,0x2e,0x3,0x77,0xa8,0xce,0x40,0x8a,0x20,0xbf,0x3c,0xf2,0x7f,
+0x7a,0x9b,0xe1,0xdd,0x9,0xec,0x2e,0xae,0xb5,0xef,0x12,0x4c,0xad,0xab,0xb8,0x32,0x4d,0x31,0x6f,0x92,0xcd,0x3d,0x2a,0x3c,0xbb,0x8d,0x99,0x37,0x17,0x97,0x9e,0x3c,
+0x95,0xec,0x74,0x77,0x7b,0x1f,0xe,0xc0,0xdf,0xbd,0xbb,0x3f,0x2b,0x4e,0x7d,0x2b,0xa2,0x9e,0x7d,0x13,0xc1,0x7e,0x1a,0x2f,0xb7,0xc8,0xb1,0x1f,0x72,0x21,0xc4,0x97,
+0x92,0x55,0x7d,0xae,0x42,0x5e,0x9e,0xe9,0xcd,0xd9,0x69,0x7a,0x9f,0x8b,0xaf,0xe0,0xd6,0xfc,0x54,0x3e,0xcd,0xa7,0x2e,0xd7,0xb6,0xb0,0x1d,0x18,0x76,0xad,0x7f,0x14,
+0xf8,0x99,0x7c,0x3c,0x90,0xd9,0x58,0xc6,0xb7,0x3a,0xd4,0xa0,0x25,0xa5,0x92,0x8d,0xcb,0x0,0xf5,0xa2,0xea,0x52,0xf2,0x13,0xdf,0x94,0xcf,0xf0,0xff,0x0,0x84,0x2e,
+0x5f,0x51,0x5d,0x73,0xc6,0x32,0xfd,0xb6,0xfc,0xfc,0xf1,0x58,0xb8,0xf9,0x51,0xbd,0x6b,0x67,0xc4,0xbe,0x26,0xb0,0xd0,0xde,0x2b,0x6b,0xc9,0x3c,0xdd,0x46,0x6e,0x56,
+0xdd,0x3f,0xe5,0x98,0xeb,0x9a,0x17,0xef,0x25,0x74,0x56,0x92,0x7c,0xa8,0xf1,0x94,0xf2,0x70,0xdb,0x2e,0x80,0x7f,0xf6,0x41,0xe2,0x9d,0x92,0x72,0x64,0x66,0x20,0xff,
+0x0,0xcb,0x42,0xbf,0x2d,0x77,0xda,0xf7,0xb9,0xd1,0x38,0xdf,0xd4,0x96,0xb,0x96,0x41,0xe5,0xac,0xee,0x41,0xec,0xfd,0x29,0x6e,0x16,0xca,0x5d,0xff,0x0,0x68,0xdd,
+0x6f,0xc6,0xe3,0xe5,0x74,0xf7,0xa8,0xd9,0x94,0xe3,0x61,0x92,0xe9,0xf2,0xdc,0x2b,0x4d,0x15,0xca,0xdd,0x3,0xd4,0x67,0xe7,0xa6,0xc2,0xe5,0x59,0xd2,0x57,0x3b,0xbf,
+0x85,0x4a,0x81,0x8a,0x3e,0x2d,0x18,0xae,0x9e,0x88,0xbb,0x1b,0x42,0xd6,0xe9,0xb9,0x89,0x62,0x7f,0x80,0x8e,0x95,0x26,0xdc,0x82,0xbd,0x1,0xed,0x58,0x72,0xea,0x1f,
+0x3,0xd4,0x90,0x75,0x2e,0x5f,0xdc,0xed,0x19,0xfc,0x69,0xce,0x30,0x9f,0x2b,0xe7,0xdd,0xcd,0x3e,0x4e,0x56,0x66,0xf9,0x9e,0xe3,0xdf,0x62,0x34,0x9e,0x5b,0x1c,0xf,
+0xba,0x7a,0xe6,0x9d,0x83,0xe6,0x4a,0x8b,0x2e,0x30,0xc0,0x8f,0x93,0xda,0xa6,0xed,0xc8,0x6a,0x3a,0xf,0x9,0xf2,0x60,0xbc,0xae,0x1,0xc7,0xef,0x29,0xf8,0x5f,0x97,
+0xe7,0x6c,0x2d,0x39,0xc6,0xe8,0xcf,0x66,0x3b,0xa3,0x5,0x2b,0xdf,0xf3,0xa5,0xda,0x70,0x77,0x36,0x71,0x8e,0x95,0x9c,0x6e,0x5e,0xc2,0xf9,0xd8,0x93,0x63,0xb9,0xcb,
+0xfd,0xc1,0xeb,0xc5,0x35,0xe1,0x49,0x19,0x19,0x9a,0x50,0x4e,0xe1,0x84,0x6c,0x67,0xa5,0x2f,0x66,0xe3,0x52,0xe1,0x7b,0x6e,0x46,0xf6,0x68,0x42,0xec,0x7b,0x8d,0x81,
+0x86,0x72,0xe0,0xf1,0x52,0x25,0xa4,0x7b,0x7e,0x67,0x79,0x18,0xbf,0x45,0xf9,0x70,0x2a,0xf6,0x14,0xef,0x72,0x41,0x6f,0x1c,0x2c,0xc5,0x23,0x40,0xd8,0xeb,0xb7,0x9a,
+0xb1,0xf7,0xa3,0x1b,0xdc,0xb6,0x3d,0x7b,0x54,0xde,0xe2,0xe6,0xb8,0xd0,0x45,0x2e,0x3e,0xe9,0xe9,0x4a,0xda,0xdc,0xbb,0xd8,0x2,0xf6,0x53,0x8e,0x77,0x52,0x61,0x72,
+0x79,0x6d,0xd9,0xc1,0xeb,0xd6,0xaf,0x99,0xbd,0x84,0xe3,0xad,0xc5,0x6e,0x7,0x51,0x4d,0x35,0x36,0x1f,0x28,0xff,0x0,0xe0,0xdb,0x9e,0x3d,0x29,0x80,0x7c,0xf5,0x9e,
+0xec,0x62,0x1e,0xf,0xd6,0x93,0xca,0x33,0x1d,0xbb,0x8e,0xd3,0xd7,0xbd,0x55,0xac,0xc9,0x67,0x30,0x46,0xef,0x95,0x99,0xb1,0xc8,0x34,0xfd,0xa5,0x49,0x20,0xe3,0x71,
+0xcd,0x6f,0x2d,0xac,0x69,0x19,0x90,0xca,0xa7,0x63,0x94,0xdd,0xbf,0x83,0xf2,0xfa,0x8a,0xf4,0xdb,0x7f,0x18,0x5a,0x5e,0x43,0x69,0x35,0x8e,0x83,0xe2,0x19,0xdd,0x31,
+0xb1,0xad,0xe0,0x5d,0x84,0xe2,0x95,0x5a,0x7a,0x27,0x72,0x2a,0x6b,0xb3,0x12,0x58,0xb5,0x5d,0x6b,0x56,0x8a,0xe2,0xf3,0xc3,0xb7,0x90,0x59,0xc0,0x41,0xd9,0xa9,0xea,
+0x3b,0x61,0x3f,0x2f,0x15,0xce,0x78,0xc3,0x44,0x3a,0x3e,0xa5,0xe,0xa0,0xeb,0x1c,0x76,0x77,0x4c,0xff,0x0,0xba,0x8d,0x77,0x45,0xbb,0x19,0xc5,0x45,0x3f,0x7b,0x67,
+0x74,0x66,0xed,0xcc,0x71,0xec,0x2,0x23,0x85,0xb8,0x9d,0xb7,0xae,0xd2,0x5b,0x9a,0xeb,0x34,0x5b,0xbf,0xed,0xfd,0x7f,0x4c,0xb7,0x9f,0xca,0x36,0x1a,0x78,0x13,0x3c,
+0x32,0xc7,0xfe,0xb9,0xfa,0x62,0xb7,0xa9,0x1b,0xa3,0x49,0x47,0x4b,0x9d,0x36,0xab,0xa9,0xcd,0xe2,0x8d,0x46,0x7f,0xf,0xe9,0x77,0x61,0x60,0x45,0xff,0x0,0x89,0x9d,
+0xe8,0x3f,0xc1,0xff,0x0,0x3c,0xea,0xf6,0xb7,0xad,0xda,0xf8,0x4b,0x4d,0xb7,0xd1,0x74,0x4b,0x71,0x3e,0xab,0x22,0xaa,0x59,0xd9,0xa8,0xdd,0xb7,0xd1,0xeb,0x9e,0xd6,
+0xd0,0xe7,0x8c,0x75,0xd4,0x97,0xc3,0xba,0xf,0xf6,0x1f,0xda,0x75,0x8d,0x6e,0xf8,0x4f,0xac,0xbc,0x7b,0xef,0x6f,0x64,0x6c,0xad,0xa2,0x7a,0x56,0x14,0x8f,0x75,0xf1,
+0x6,0xeb,0x6c,0x26,0x5b,0xf,0x8,0x59,0xc9,0x86,0x6f,0xe3,0xba,0x6a,0x4a,0x76,0xbd,0x52,0xfc,0xce,0x8f,0x58,0xd4,0xb4,0xaf,0xa,0xe8,0xd1,0x79,0xa0,0xc5,0x6c,
+0x6,0x2d,0x6c,0xa1,0xfb,0xce,0x6b,0x1f,0x42,0xd0,0x35,0xd,0x6f,0x54,0x8f,0xc4,0x7e,0x2f,0x8f,0x7d,0xc1,0xff,0x0,0x90,0x7e,0x98,0x57,0xe5,0x8d,0x7b,0x1a,0x9d,
+0xa2,0x67,0x1f,0xe6,0x1d,0xe2,0x9f,0x18,0xbd,0xbd,0xef,0xf6,0x5e,0x81,0xff,0x0,0x13,0x1d,0x6a,0x7e,0x37,0x46,0xbb,0xc2,0x1a,0xb5,0xe1,0x5f,0xc,0xae,0x82,0xe6,
+0xe2,0xe6,0x4f,0xb6,0xf8,0x86,0xe7,0xfd,0x75,0xc6,0x77,0x8,0xf3,0xd5,0x6a,0x9c,0x79,0x63,0xca,0x55,0xb9,0x23,0x73,0x37,0xc4,0x3e,0x2d,0xb9,0x6d,0x44,0xe8,0x7e,
+0xe,0x43,0x79,0x7d,0xff,0x0,0x2d,0xef,0x23,0xe4,0x21,0xf4,0xab,0x3a,0x3f,0x83,0x6c,0xb4,0xc4,0x33,0xea,0xd2,0x7f,0x68,0xeb,0x52,0xb6,0xf9,0xa7,0x63,0x95,0x8f,
+0xfd,0x9a,0xa9,0x3e,0x45,0xcb,0x12,0xa3,0xee,0xab,0x9e,0x48,0x1f,0x8f,0x99,0x5b,0xdf,0x1c,0xe2,0xa4,0x11,0xf5,0x7e,0xb8,0xfc,0xb1,0x5d,0xef,0xb2,0x3a,0xa4,0xdb,
+0x1d,0xe6,0x3b,0xa3,0xee,0x79,0x48,0x3f,0x77,0xe6,0xe7,0xad,0x4e,0x6e,0x72,0x4c,0x33,0xbb,0x34,0x72,0x70,0xbc,0xe0,0x9a,0xc5,0xa4,0x82,0x51,0xd0,0xb2,0x36,0xcf,
+0x28,0x68,0xfc,0xef,0x30,0x72,0x3d,0x70,0x5,0x3,0xcc,0x8d,0x58,0xb4,0x27,0xcb,0xfb,0xdf,0x70,0xee,0xa2,0xcf,0xa8,0xd7,0x2d,0x8b,0x3b,0xf3,0x80,0x59,0xf8,0xed,
+0xda,0x9b,0x11,0x6c,0x38,0xdc,0x73,0xbb,0x9a,0x85,0xee,0xad,0x4c,0x5c,0x79,0x98,0xe6,0x51,0xe6,0xc0,0xfd,0x33,0xf2,0x9f,0x6f,0x4a,0x54,0xf9,0x8b,0xab,0xe,0x87,
+0xf3,0xa5,0x1f,0x7b,0x52,0xef,0xa1,0x26,0x54,0x72,0xcb,0xdf,0x19,0xcd,0x29,0xe7,0x8f,0x7c,0xd5,0x7b,0x2b,0x7b,0xc6,0x70,0x91,0x34,0x64,0xee,0xe9,0xf2,0xfd,0x69,
+0x57,0x2d,0x1a,0xef,0x5c,0x39,0xea,0xb5,0x8c,0x58,0xc4,0xf9,0xb7,0x7c,0xf1,0x48,0x88,0x8e,0x76,0x92,0x77,0x6,0xa9,0x10,0x6c,0x6,0x3f,0xe2,0x5e,0xf,0xbd,0x3e,
+0x6b,0xe,0xe3,0xd8,0x15,0xdb,0xb7,0x8,0x3c,0xce,0xe7,0xb1,0x14,0x8f,0x9d,0xf1,0xf4,0xdb,0xb8,0xd1,0x60,0xdc,0x90,0x72,0x98,0xf5,0x6c,0xd2,0xf6,0xd8,0x46,0x41,
+0x18,0xa8,0xb5,0xf4,0x22,0xd6,0x15,0x63,0xda,0xb8,0x2,0x97,0xbf,0x4a,0xce,0x12,0xf7,0x87,0xa3,0x2,0xb9,0xf5,0x19,0xf4,0xa7,0x1c,0x13,0xd8,0x62,0xb4,0x6a,0xe2,
+0xb5,0x84,0x39,0x38,0x2b,0xd8,0xd0,0xe,0x79,0xfe,0x1e,0xf4,0x31,0xbb,0xdb,0x41,0x7e,0x52,0x3e,0x4c,0xed,0xf7,0xa3,0xbe,0x3e,0x5e,0x94,0xba,0x8a,0xf6,0x1,0xc9,
+0xe9,0x48,0x7e,0x5e,0x40,0xde,0x7d,0x18,0xd1,0x3f,0x21,0x2d,0x58,0xd7,0xc,0xfb,0x48,0xd8,0xb8,0xe7,0x6,0x9b,0x9e,0x57,0x3,0xa3,0x66,0x9d,0xb5,0x2e,0xfd,0xc,
+0x6b,0xe8,0x84,0x32,0x32,0x6d,0xc6,0xf3,0xbb,0x8e,0xbd,0x73,0x55,0x48,0x20,0x22,0xa3,0xbb,0x1d,0xdf,0xc6,0xd9,0xe2,0xb7,0x5a,0x96,0xbb,0xd,0x3b,0xf6,0x1d,0x84,
+0xa3,0x67,0x87,0xd,0x8c,0x57,0x49,0xe1,0xdf,0x12,0xcd,0xa5,0x69,0xe2,0xd6,0x38,0xa3,0xc4,0x46,0x47,0x66,0x32,0xed,0x41,0x93,0x91,0x45,0xb9,0xb4,0x14,0x92,0xb1,
+0x76,0xf3,0xc6,0x77,0xde,0x41,0xc5,0xed,0xa0,0xf9,0x64,0xb,0x1d,0xae,0x24,0xfe,0x11,0x8a,0xe5,0x6f,0x2f,0xae,0xf5,0x9b,0x97,0xf3,0x66,0x3b,0x11,0x95,0xe3,0x8e,
+0x76,0xdd,0xce,0xdc,0x1a,0x39,0x39,0x76,0x32,0x82,0x46,0x63,0x1f,0xde,0x38,0x1b,0x80,0xdc,0x7e,0x95,0x2e,0x9d,0x7d,0xfd,0x9b,0x7d,0xf6,0xa0,0x19,0x80,0xfb,0xeb,
+0xbb,0xaf,0xa5,0x6b,0xc8,0x74,0xf2,0x9d,0xbf,0x86,0xf5,0x8b,0x5f,0xc,0x78,0x25,0x2e,0xe6,0x11,0xf9,0xce,0xc6,0x5f,0x2f,0x77,0x37,0x2f,0xda,0xb6,0xfc,0x21,0xa6,
+0xd,0x3e,0xda,0x7f,0x10,0x6a,0x33,0x81,0xa8,0xdd,0xaf,0x9f,0x71,0x77,0x39,0xff,0x0,0x8f,0x58,0xeb,0x96,0xa4,0x1e,0xc7,0x2b,0xba,0x28,0x66,0x7f,0x88,0x57,0x3f,
+0xf2,0xd2,0xc3,0xc2,0x36,0x52,0x7a,0xfe,0xf2,0xf1,0xeb,0x73,0xc4,0x7e,0x20,0xb2,0xf0,0xd4,0x36,0xda,0x75,0x8d,0xa0,0x93,0x50,0xdb,0xb6,0xcf,0x4d,0xb7,0x19,0xf2,
+0x47,0xad,0x4b,0x8d,0xdd,0xba,0x20,0x7f,0xca,0x55,0xf0,0xe7,0x86,0x66,0xfb,0x7f,0xf6,0xcf,0x89,0x7f,0xd3,0x75,0xa9,0xbe,0xec,0x52,0xf,0x92,0xdf,0x9a,0xad,0xad,
+0xeb,0xb7,0xda,0xf6,0xa7,0x37,0x86,0xbc,0x27,0x29,0x32,0xb9,0xff,0x0,0x89,0x86,0xa7,0x9f,0x91,0x17,0xb8,0xa4,0xbf,0x98,0x8b,0xde,0x46,0xb7,0x87,0xf4,0x1d,0x33,
+0xc2,0xf6,0x52,0x3d,0xa1,0x45,0xf2,0x97,0x33,0xea,0x53,0xf0,0x40,0xef,0x5c,0xb5,0xd6,0xbd,0xaa,0x78,0xd6,0xf8,0xe8,0xbe,0x17,0x89,0xac,0xf4,0xe2,0x48,0x96,0xf1,
+0xc9,0x1f,0x27,0x73,0x4e,0x3a,0xfb,0xf2,0x2b,0xe3,0xdc,0xeb,0xb4,0x9d,0x2b,0x4d,0xf0,0xee,0x98,0xd0,0x58,0x95,0x82,0xd2,0x21,0xbe,0xe6,0xf6,0x6e,0x37,0x7f,0xb5,
+0x5c,0xa5,0xcf,0x8c,0x6f,0xf5,0xd9,0x5e,0xc7,0xc2,0xb6,0xe,0xb6,0xd9,0x22,0x6b,0x86,0x19,0x6d,0x9f,0xc2,0x6a,0x63,0x1d,0x39,0xe4,0x4c,0x63,0xcf,0x23,0xcf,0x2e,
+0x23,0x54,0x8c,0xec,0x18,0xf3,0x3a,0xfe,0x79,0xa4,0xdd,0x17,0x59,0x60,0x88,0xff,0x0,0x13,0x3b,0x64,0x96,0xe6,0xbd,0x5d,0xce,0xd8,0x5d,0xa2,0x55,0x95,0x5b,0x7e,
+0xd4,0xb7,0xf4,0x5d,0xa7,0x6e,0xdf,0x7a,0x6a,0x6f,0x1b,0x96,0x33,0xc7,0x7c,0x54,0x69,0x9,0x6a,0x4c,0xb5,0xd0,0xb1,0xb4,0x5c,0xa3,0x38,0x21,0x7f,0x79,0xc0,0x5e,
+0xa,0x55,0xd8,0xe4,0x76,0x93,0x2d,0x20,0x3f,0x32,0x7c,0xbb,0x4e,0x7e,0x95,0x16,0xbb,0xd4,0x9e,0x5e,0x5d,0x89,0x64,0x68,0xf6,0x64,0xc3,0x19,0xb,0xdd,0xa9,0x4b,
+0x9c,0x28,0x3b,0x42,0xf,0x41,0x58,0xcf,0xde,0xd0,0x17,0x2e,0xcc,0x70,0x67,0xdb,0xbf,0x85,0x3,0x3d,0xc1,0xdd,0xef,0x4e,0xe3,0xcd,0x3b,0xf0,0x46,0x70,0x76,0xfd,
+0x2a,0x58,0x98,0xd,0xc9,0xb3,0xe5,0x5d,0xad,0x9c,0x9c,0xfd,0xda,0x79,0x8c,0xf7,0xc0,0xcf,0x66,0xe2,0xb4,0x75,0x15,0xae,0x45,0x93,0x1f,0x33,0x19,0x12,0x44,0x8c,
+0xd,0xc7,0xef,0x6c,0x7f,0xba,0x29,0xef,0xb9,0xee,0x24,0x2d,0xfd,0xe2,0xc0,0x7a,0xad,0x67,0xb,0x32,0x96,0xda,0x8f,0xf9,0xd8,0x2f,0x11,0xe0,0x7d,0xdd,0xad,0x48,
+0x64,0x7d,0xa1,0xfc,0xd8,0xc2,0x16,0xd8,0x57,0xbd,0x4c,0xac,0x4c,0x52,0x25,0xd9,0xc0,0x38,0x4d,0xa3,0xa9,0x27,0x9a,0x72,0xaf,0x27,0xef,0x3e,0x32,0x7e,0x6a,0x85,
+0x2b,0x85,0xc7,0x1f,0x41,0xd6,0x9c,0x3a,0x72,0xbf,0x98,0xaa,0xbd,0xc0,0x6c,0x99,0x30,0x48,0x18,0x95,0xf7,0x1c,0x54,0x87,0x21,0xc8,0xc8,0xfa,0xa,0x84,0x80,0x8c,
+0x3f,0x38,0x5,0x77,0x7b,0xd3,0xd5,0x98,0xe5,0x7e,0x52,0x7d,0xaa,0xe4,0xf4,0xd4,0xa9,0x44,0x52,0xc5,0x8a,0xe4,0x63,0x3,0x9a,0x1,0x66,0x3b,0x77,0xd,0xa3,0xee,
+0x8d,0xb4,0xb4,0x17,0x40,0x39,0xdd,0x46,0x78,0xe7,0x93,0x59,0xdc,0x81,0xc,0x68,0xe0,0x67,0x39,0x1c,0x8c,0x53,0x58,0x3e,0xde,0xc4,0xfa,0xa,0x6a,0x5a,0xd9,0x8f,
+0x60,0xea,0xa0,0xfe,0x99,0xa4,0x62,0x79,0xf2,0xcc,0x67,0xfa,0x53,0x96,0xac,0xa8,0x2e,0xe6,0x76,0xb6,0x37,0x47,0x1c,0x88,0x30,0x77,0xed,0xe7,0xd3,0x15,0x96,0xcc,
+0x59,0xa4,0x7e,0x13,0x2d,0xfa,0x7a,0x56,0xf1,0x9e,0x96,0x2a,0xc4,0x78,0xcb,0x6e,0xdc,0x11,0x94,0x8d,0xbf,0x26,0x77,0x52,0x3a,0x2f,0x98,0xcd,0xc3,0x7c,0xd9,0x19,
+0xad,0x79,0x8a,0xb6,0xb6,0x1b,0xb9,0x8e,0xed,0xd8,0xe1,0xbe,0x51,0x40,0x6d,0x8d,0xb8,0x7c,0xd8,0x39,0x3c,0x52,0xe7,0x69,0xdd,0xd,0x2f,0x78,0x93,0x52,0x80,0x42,
+0x23,0x70,0x4a,0x89,0x5b,0x9e,0x3b,0xd5,0x56,0x8f,0xbe,0x17,0x18,0xfb,0xca,0x31,0x93,0x44,0x6a,0xf7,0x2d,0xfc,0x5a,0x1a,0x7e,0x18,0x96,0x5,0xf1,0x26,0x9d,0x1d,
+0xea,0xc5,0xf6,0x68,0xe4,0x76,0x45,0x96,0x3d,0xca,0xcc,0x47,0x15,0xd7,0x5c,0x9b,0x9f,0x18,0x6a,0x9f,0xd9,0xad,0x39,0x8f,0x45,0xb3,0x7d,0xd7,0x92,0x20,0xff,0x0,
+0x5f,0x20,0xfe,0x1a,0xce,0x49,0xdf,0x98,0xe7,0xa8,0xec,0xf5,0x35,0xf5,0xbf,0x11,0xf,0xf,0x5a,0xda,0x69,0xfa,0x5d,0xbd,0xbc,0xda,0x9b,0xfe,0xea,0xc6,0xc6,0x3f,
+0x9b,0xec,0xfd,0x39,0xa7,0xf8,0x6f,0x40,0x4d,0x15,0xae,0x35,0x6d,0x5e,0xe6,0x9,0xb5,0x69,0x73,0x35,0xdd,0xeb,0xfd,0xcb,0x50,0x7a,0xad,0x73,0xbd,0x17,0x27,0x73,
+0x23,0x1e,0xef,0x56,0xd5,0x7c,0x63,0x2c,0xda,0x67,0x86,0x95,0xed,0x74,0x86,0x7f,0x2a,0xe6,0xfa,0x52,0x3e,0x64,0xef,0x5d,0x1c,0x71,0xe8,0xbe,0xb,0xf0,0xde,0x3,
+0x8,0x2c,0x3b,0xb3,0x7f,0xad,0xbd,0x90,0x77,0xa7,0x6b,0xfb,0x88,0x6d,0x59,0x59,0x1c,0xda,0x8d,0x4f,0xe2,0x4,0xbe,0x65,0xdc,0x67,0x4b,0xf0,0xc5,0xb3,0xee,0x11,
+0x81,0xb5,0xae,0x4f,0xa5,0x75,0x7a,0x85,0xfe,0x97,0xe1,0x8d,0x4,0xcd,0x71,0xa,0x58,0xd8,0x2f,0x10,0x5a,0xc4,0x3e,0x69,0xdb,0xd2,0x89,0x2e,0x67,0xca,0x89,0x92,
+0xb6,0x87,0x21,0x6f,0x1e,0xa5,0xe3,0xfb,0x81,0x36,0xa2,0x1b,0x4f,0xf0,0xd5,0xac,0x9f,0xea,0xb1,0xf3,0x4c,0xde,0x95,0xd7,0xbb,0xd8,0xe8,0xba,0x30,0xc0,0xb6,0xd3,
+0xac,0xd8,0xec,0x8d,0x15,0x70,0x66,0x22,0x9f,0xc5,0x2e,0x54,0x37,0xb,0x7b,0xa8,0xf0,0xed,0xcc,0x17,0x6b,0xc,0x20,0xcb,0x67,0x3d,0x4f,0xad,0x32,0x37,0x6c,0x8c,
+0x6c,0x65,0x70,0x47,0xcc,0x33,0xcd,0x7a,0x2e,0xc7,0x53,0x4f,0x72,0x67,0xb8,0x9e,0x4b,0x66,0xdf,0xb5,0x3,0x6d,0x5d,0xa8,0x80,0x62,0x97,0x73,0xb6,0xd6,0x67,0x1b,
+0x33,0xcc,0x43,0xa5,0x4e,0xda,0x94,0xa9,0x27,0xa8,0xe1,0x94,0xe8,0x8b,0xe5,0x9e,0xc4,0x77,0xab,0x91,0xc9,0xf7,0x67,0x7d,0xa8,0xdd,0xf9,0xf9,0x6a,0x2e,0xe5,0xaa,
+0x23,0x48,0x96,0x13,0x26,0x8,0x98,0x79,0x88,0x9f,0x30,0x3d,0xb3,0x4a,0x1b,0x90,0xcc,0x38,0xdd,0xf7,0x8a,0xe6,0xa5,0xdd,0x22,0x37,0x63,0xce,0x18,0x7e,0xe9,0x8,
+0x1c,0xe4,0xf4,0xc1,0xf5,0xa7,0xc,0x99,0x7a,0x9d,0xae,0x7f,0xbb,0xd4,0xe2,0xb3,0x55,0x17,0x54,0x5b,0x1e,0x1f,0xe6,0xd8,0xea,0xc3,0x9d,0xa7,0x2b,0x95,0xa7,0x64,
+0x19,0x8,0xf3,0x4b,0x8c,0x75,0x27,0xf8,0xa8,0x92,0x33,0x25,0x52,0xd9,0xda,0xad,0xce,0xd2,0x37,0x60,0x1e,0xd4,0xb8,0x65,0xed,0x8e,0x7e,0x73,0x52,0xfb,0xa0,0xb7,
+0x2c,0x47,0xe4,0x2b,0x6c,0x63,0xb3,0x7,0x7,0xb6,0x29,0x78,0x6e,0xa7,0xdc,0xc,0x56,0x72,0xdc,0x9f,0x66,0xe0,0x3f,0x7f,0x3,0x3d,0xf9,0xdb,0x8e,0x94,0x26,0x7d,
+0xf2,0x3f,0xbc,0xb8,0xa5,0x1d,0xc2,0x4e,0xc4,0xab,0xc9,0xc9,0xe0,0xf4,0xa6,0xa4,0xbe,0x6e,0x24,0xdd,0x9e,0x31,0x49,0xa6,0x31,0xe7,0x9e,0x3d,0x69,0x7a,0xe,0xe,
+0xea,0x97,0x20,0xd5,0x8b,0x96,0xdb,0xd0,0x63,0xe9,0x4c,0xea,0x2,0xfa,0x9a,0xb3,0x4d,0x10,0xe,0x70,0x79,0xfa,0x52,0xb9,0xfb,0xaa,0x17,0x9e,0xbd,0x7b,0x51,0x51,
+0xab,0xe8,0x44,0xb5,0xd4,0x5e,0xbd,0x69,0x7,0xa8,0xa5,0xcc,0xd0,0xb9,0x7a,0x8e,0x5e,0x9d,0x47,0xe1,0x4c,0x2c,0xdf,0xa9,0x14,0x96,0xa8,0xa6,0x37,0xf8,0x7a,0x52,
+0x62,0xb4,0x56,0xb1,0x9e,0xa3,0x6e,0x22,0x69,0xe0,0x30,0xe4,0x9c,0xf0,0x1,0x3d,0xd,0x73,0xdc,0x82,0x44,0x81,0x72,0x18,0x8c,0x75,0xad,0x29,0xb4,0xcd,0x62,0xd6,
+0xc4,0x5b,0xbe,0xe2,0x63,0x2c,0x4e,0x38,0xa1,0xf2,0x0,0xc9,0x1,0x7,0x5c,0xfe,0x95,0xa2,0x7a,0xd8,0xa6,0xec,0x33,0x9c,0xfc,0xdc,0xe2,0xa3,0x94,0xee,0x8c,0xae,
+0xd1,0xf5,0xc1,0x1c,0x53,0x65,0x25,0xcc,0xce,0x9e,0xda,0x18,0xf5,0xb,0x25,0x5d,0x8b,0x1f,0x98,0xbb,0x7e,0xeb,0x60,0x7b,0xd7,0x2b,0x24,0x4d,0x6f,0x7d,0x2c,0x6e,
+0xbb,0x19,0x5b,0x66,0x19,0x76,0xf1,0x9e,0xb5,0x85,0xa,0xb7,0x6d,0x16,0xe2,0xd0,0x85,0xb6,0x4d,0xe7,0x2b,0x32,0xb6,0xec,0x86,0xf4,0xae,0xbb,0xc3,0x3e,0x26,0x87,
+0x4d,0xd0,0x3c,0x94,0x43,0x3e,0xa8,0x6e,0x5d,0x96,0x2e,0xa6,0x66,0x6d,0xbb,0x6b,0x69,0xae,0x64,0x65,0x38,0x9d,0x7,0x86,0xb4,0x8b,0xcb,0x7b,0xb9,0x35,0x9d,0x5f,
+0xcb,0x1a,0xbd,0xcb,0x1c,0x67,0xfe,0x5d,0xd2,0xb2,0xe7,0xbd,0xff,0x0,0x84,0xc7,0x5a,0x7d,0x24,0xcf,0xf6,0x6d,0xa,0xc0,0xf9,0x92,0x2a,0x7d,0xeb,0x86,0x15,0x87,
+0x57,0x24,0x73,0x1d,0x5e,0xad,0xad,0xe9,0x7e,0x16,0xb0,0x4b,0x77,0x83,0x9,0x8f,0xf4,0x6b,0xb,0x71,0x82,0x7d,0x2b,0x22,0xc7,0x41,0xbc,0xf1,0x5,0xda,0xf8,0x8b,
+0xc6,0x4b,0x8d,0xc3,0xfd,0xb,0x4c,0xc6,0x15,0x23,0xa8,0xfe,0x12,0x12,0x4f,0xe2,0x2f,0xf8,0xb3,0xc4,0xd1,0x78,0x7e,0x28,0xad,0xa3,0x8f,0xed,0x1a,0xb4,0xa3,0xf7,
+0x16,0x89,0xff,0x0,0x2c,0x7,0xad,0x64,0xf8,0x73,0xc3,0x97,0x37,0x57,0x7f,0xdb,0xbe,0x30,0xdd,0x3d,0xe6,0xe3,0xf6,0x6b,0x29,0x3a,0x2f,0xfb,0x54,0xdf,0xbb,0x1f,
+0x32,0x95,0xb9,0x79,0x8d,0x8f,0x14,0x78,0xa6,0xd7,0xc3,0xc8,0xa2,0xeb,0x17,0x37,0xed,0xf7,0x6d,0x10,0x8f,0xdd,0xfb,0xd6,0xc,0x3e,0x1f,0xd4,0xbc,0x47,0x38,0xd7,
+0x3c,0x51,0x37,0x92,0xef,0xff,0x0,0x1e,0xb6,0x21,0x76,0xf9,0x71,0xd1,0xfc,0x38,0x93,0x15,0xf6,0x8e,0x21,0xa2,0xb7,0x9d,0x73,0x67,0x75,0x4,0x2c,0xbf,0xc2,0xe4,
+0x8c,0xb6,0x6a,0x2b,0x88,0x2e,0x2d,0xe4,0xdd,0x29,0x32,0xa8,0x1f,0xeb,0x7b,0x1a,0xec,0x83,0xbb,0xf7,0x8e,0xd6,0xef,0xa1,0x5b,0x76,0xec,0x45,0x29,0xf9,0xba,0xf5,
+0xeb,0x4f,0xf9,0x83,0x24,0x67,0x3f,0x39,0xf9,0x47,0xb5,0x54,0xbd,0xe7,0x61,0xdd,0x5a,0xc3,0xe1,0xc2,0x89,0x98,0xc2,0xe4,0x83,0x9e,0x9d,0xfb,0xd4,0x86,0x73,0xfc,
+0x0,0x1,0xc7,0x4,0x66,0x8e,0x86,0x49,0x6a,0x5d,0xb5,0xd8,0x6d,0xa3,0xf9,0x99,0x99,0xe6,0xd8,0x76,0xb7,0x27,0x9e,0xb5,0x60,0xc2,0x40,0xf5,0x23,0xfb,0xd9,0xc0,
+0xac,0x69,0xcb,0xb9,0x57,0x4b,0x42,0x48,0xb8,0xd8,0x9,0x1e,0xf5,0x1a,0x7f,0xc7,0xb7,0xdf,0x64,0xc9,0x38,0xc1,0xc1,0x18,0xe2,0xb3,0x71,0xd4,0x52,0x26,0x6d,0xdb,
+0x89,0xd,0x91,0x9c,0xe,0x32,0x4d,0x2b,0x71,0x28,0xf9,0xb7,0xf,0x53,0xfc,0x5c,0x71,0x44,0x65,0xd0,0xc9,0x21,0xc4,0x71,0xce,0x30,0x4a,0x81,0xed,0xc7,0x34,0xf8,
+0xd7,0x11,0xb9,0xe0,0x21,0x73,0x4d,0x48,0xb5,0x77,0xa1,0x26,0xc6,0xc1,0xc7,0x98,0xa7,0xd4,0x54,0x80,0xf9,0xae,0x18,0xe3,0xe5,0x24,0xfe,0x75,0xcf,0x53,0x7b,0x8e,
+0x72,0xb8,0x0,0x77,0xb1,0xc8,0xeb,0xc6,0x7d,0x29,0x53,0x76,0xe6,0x25,0xa4,0xc7,0x6c,0xe6,0xae,0x4b,0xb0,0x3b,0x31,0xff,0x0,0x36,0xde,0xeb,0xdc,0x76,0x26,0x94,
+0xbf,0x18,0x6f,0xc0,0x54,0xdc,0xcf,0xd0,0x1b,0x95,0x5e,0xa3,0xbd,0x38,0x60,0x7c,0xc6,0xa5,0xed,0x63,0x44,0x3c,0x60,0xd3,0x40,0x38,0xe5,0x86,0x47,0x5c,0x55,0x44,
+0x1c,0x7a,0x8,0xa7,0x3,0xe7,0xfc,0xff,0x0,0x1a,0x7f,0x4,0x7e,0x39,0xa9,0xea,0x2f,0x21,0x15,0xd0,0xfd,0xdc,0x9f,0xc2,0x81,0xec,0x71,0x4c,0x2c,0x27,0xe2,0x33,
+0x49,0xbb,0x2c,0x6,0x57,0xd2,0x9a,0x7a,0x93,0x6b,0x8d,0x7d,0xeb,0x13,0x1d,0x81,0x79,0x61,0x9c,0xe7,0xa7,0x4a,0x52,0x33,0xd4,0xd5,0x3e,0x5e,0x80,0x31,0x54,0x5,
+0xf9,0x25,0x93,0x3b,0xf7,0x6d,0x6a,0xc3,0xd4,0x6d,0xfc,0x9b,0xe7,0x3,0x81,0xc3,0x73,0xdf,0x3c,0xd1,0x45,0xbb,0x94,0xb7,0x29,0x74,0x6f,0x97,0x1b,0xf3,0xe9,0x4b,
+0x9f,0xbd,0xbb,0xf2,0xae,0x95,0x1b,0x16,0x30,0xff,0x0,0x11,0x69,0x39,0x2d,0xc7,0xc9,0x4c,0x7e,0x9c,0x4a,0xfb,0xbb,0xa9,0xce,0x31,0x49,0xc2,0xe1,0xcf,0x69,0x68,
+0x75,0x3a,0x38,0xdd,0x66,0x83,0xcd,0x75,0xc0,0xdd,0x8f,0xc6,0xa2,0xf1,0x6,0x99,0xf6,0xb8,0xd,0xe4,0x6a,0x64,0xba,0x81,0x72,0xdc,0x16,0x2e,0x83,0xb5,0x79,0xe9,
+0xf2,0x54,0x35,0x96,0xa8,0xe5,0x3,0x86,0xe8,0xdd,0x6a,0xce,0x93,0x77,0xfd,0x9b,0xac,0xc7,0x7b,0xf2,0x39,0xb4,0x90,0x48,0xa8,0xdd,0x1a,0xbd,0x2b,0x11,0xe4,0x77,
+0xe7,0x50,0xd5,0xbc,0x65,0x3,0xdb,0xe8,0x76,0x5f,0x60,0xd3,0xe4,0x6,0x2b,0xab,0xc9,0xa4,0x35,0xa1,0x79,0x6f,0xa4,0x78,0x3f,0xc3,0xb,0x8f,0x96,0xd8,0x67,0x69,
+0x3f,0xeb,0x2f,0x26,0xc5,0x72,0xad,0x3d,0xd4,0x72,0x49,0xa8,0xec,0x57,0xf0,0x26,0x8d,0xf3,0x3e,0xaf,0x7b,0x1,0x9b,0x56,0xba,0xdd,0x2c,0x7e,0x67,0x3e,0x52,0x54,
+0xda,0xaf,0x8a,0xaf,0xef,0xb5,0x36,0xd2,0x7c,0x17,0x1f,0xdb,0x6f,0x53,0x9b,0xab,0xf7,0xe5,0x13,0xb5,0x1b,0xbe,0x69,0x8b,0x79,0x59,0x96,0xfc,0x37,0xe1,0x91,0xa2,
+0xf9,0xb7,0x37,0x12,0x7d,0xbf,0x5b,0xb8,0xe6,0x7b,0xa7,0xf9,0xbc,0xbf,0x6a,0xcb,0xd5,0xfc,0x53,0x3d,0xd6,0xa0,0x74,0x9f,0x7,0xc5,0xf6,0xfb,0xce,0xb3,0xde,0x75,
+0x41,0xed,0x51,0x1d,0x5f,0x34,0x85,0xa3,0x91,0x6b,0xc3,0xbe,0x17,0x8f,0x4a,0x61,0x35,0xd1,0x1a,0x8e,0xb9,0x3b,0x6e,0x96,0x66,0x1b,0xc4,0x7f,0xec,0xd5,0x7d,0x7f,
+0xc6,0xb6,0x56,0xf7,0xcf,0x63,0x69,0x9d,0x42,0xf8,0xb6,0xc7,0x95,0x5b,0xe5,0x53,0x57,0x8,0xb9,0xb1,0xdb,0x9d,0xf2,0xa3,0xcf,0xb,0xed,0x18,0x43,0xb3,0x1e,0xb1,
+0x82,0x29,0x60,0x92,0x58,0xd8,0x76,0x39,0xe3,0x1f,0x2e,0x47,0x6a,0xf4,0x2f,0xcc,0x8e,0x9d,0xb7,0x2c,0x2d,0xd4,0xf3,0x6,0x6f,0x2e,0xd1,0xe3,0x1f,0x2f,0xef,0x17,
+0x3b,0xaa,0x29,0x20,0xb4,0x3f,0x22,0xc5,0x25,0xb7,0x50,0xbf,0xbe,0xdc,0x8,0x22,0xa3,0xe1,0xd8,0x9e,0xa2,0x8b,0x48,0x2,0x23,0xef,0x72,0xd9,0xda,0x13,0x76,0x7,
+0xb5,0x49,0x25,0x8c,0x38,0xf9,0x55,0x83,0xf7,0x11,0xb1,0x39,0xf6,0xa9,0xbf,0x60,0x4d,0xb2,0x57,0x3b,0x23,0x1f,0xbb,0xde,0xb1,0xe4,0x7e,0xe9,0x37,0x71,0xe9,0x52,
+0xfd,0x9f,0x6e,0x16,0x35,0x51,0x87,0xc7,0xd,0xf7,0xa8,0xe6,0x51,0x13,0x8b,0x4c,0x73,0x29,0x0,0x16,0x18,0x39,0x1b,0x85,0x1f,0x7c,0x85,0x23,0x8d,0xd8,0x3,0xdb,
+0x34,0x68,0xe2,0x2d,0x49,0x59,0xf6,0xa1,0x65,0x19,0xdb,0xcf,0xc8,0x3f,0x5a,0x56,0xfd,0xde,0xf0,0x23,0xe8,0x7e,0xfa,0xbf,0xde,0xac,0xaf,0x1b,0xb,0x95,0xb1,0xec,
+0x15,0xf1,0xd3,0xe5,0x3f,0xdf,0xa7,0x67,0xe4,0xdb,0xda,0x88,0x3b,0x84,0x79,0x91,0x23,0x3b,0x7c,0xa5,0x7d,0x72,0x7d,0xe8,0xc1,0xde,0x1b,0x69,0xff,0x0,0x7b,0x1c,
+0x52,0xb2,0x1d,0x87,0x8e,0xc4,0xf2,0xbd,0x78,0xa9,0x37,0x2f,0x4e,0x7a,0x70,0x68,0x5d,0x82,0x1e,0xf6,0xc1,0xfe,0x73,0x4e,0x52,0xc0,0x63,0x75,0x4b,0x6a,0xe2,0xb6,
+0xa0,0x79,0xfc,0x3d,0xa9,0x47,0x5e,0xc7,0xd7,0xe5,0xc5,0x20,0x7e,0x40,0x7,0x41,0xb7,0xa7,0x6a,0x51,0x90,0x7e,0xea,0xfe,0x55,0x9d,0xec,0x17,0xb8,0xa0,0xec,0x1b,
+0x53,0x8f,0xc2,0x8c,0x1d,0xb4,0x26,0x87,0x61,0xb8,0xfe,0xf6,0xef,0xf8,0xd,0x2e,0x3d,0x50,0x51,0x7d,0x44,0x1f,0x51,0x49,0xf2,0xee,0xce,0xd1,0xf9,0x56,0xb0,0x62,
+0x7e,0xe8,0xc6,0x23,0xab,0xed,0xc2,0x1e,0xa6,0x94,0xf1,0x93,0xea,0x6a,0x79,0x74,0x12,0x63,0x77,0x6d,0xce,0x73,0xc9,0xcf,0x2,0xa8,0x6a,0xeb,0x9b,0x44,0xb9,0x22,
+0x3c,0xc2,0x7e,0x73,0xd3,0x2b,0x57,0x48,0x57,0x31,0x47,0x29,0xbb,0xae,0x68,0x19,0xe9,0xd2,0xba,0x64,0xd6,0xe5,0xce,0xe3,0x7d,0x72,0x32,0x14,0xe7,0x34,0xdf,0x51,
+0xe5,0xa9,0xc9,0xec,0x3a,0xd2,0xe6,0xf7,0x47,0xca,0x75,0x5a,0x7a,0x4,0x8d,0x31,0xfa,0x56,0x92,0xb1,0x53,0xb9,0x38,0x22,0xbc,0xa9,0x4e,0xf2,0xd0,0xea,0x7b,0x1c,
+0xaf,0x88,0xf4,0xd1,0x6d,0x75,0xf6,0xcb,0x6b,0x75,0x58,0x1d,0x41,0x70,0xbe,0xbd,0xcd,0x63,0xc6,0xdb,0x67,0x1f,0xba,0xc9,0x39,0xc2,0xab,0xed,0xce,0x6b,0xd3,0xa7,
+0x3b,0xc4,0x8b,0x76,0x36,0xbc,0x3f,0xe2,0x5d,0x57,0xc3,0xb1,0x5e,0x7d,0x96,0x8,0xa4,0x82,0x44,0x2c,0x12,0x56,0x4,0x44,0xd9,0xeb,0x5d,0xf5,0x87,0x86,0xfc,0xe7,
+0x8f,0x5c,0xf1,0x34,0xbf,0x6f,0xd4,0x30,0x24,0xcb,0x1f,0xf4,0x6b,0x71,0xd8,0x56,0x33,0x69,0x7c,0x3d,0x4e,0x59,0x25,0x1d,0x51,0x8b,0x7f,0x75,0x79,0xe2,0xdd,0x5a,
+0x5d,0x3b,0x4a,0x94,0xc5,0xa6,0xc5,0x27,0xfa,0x4d,0xd9,0x3f,0xeb,0x2b,0xa8,0x4f,0xec,0x5f,0x8,0xf8,0x6b,0xa,0xc2,0xcf,0x4f,0xcf,0x2c,0xdc,0xcb,0x77,0x25,0x43,
+0x5c,0xde,0xe0,0xba,0x58,0xe7,0xf7,0xeb,0x7e,0x3d,0xcf,0xd8,0xe4,0x7d,0x1b,0xc3,0x96,0xe7,0x2,0x46,0xfb,0xd3,0xbd,0x74,0x56,0x9a,0x6e,0x99,0xe1,0xad,0x12,0x38,
+0xe2,0x74,0xb4,0xb1,0x5f,0xf5,0xb7,0x73,0x70,0xf3,0x37,0x73,0x43,0x77,0xf7,0x51,0x2f,0x4f,0x74,0xe4,0x6e,0x75,0xd,0x6b,0xc6,0x57,0x6d,0x69,0xe1,0xd8,0x5a,0xcb,
+0x42,0xdf,0xe5,0xb5,0xdb,0xf5,0x3e,0xa6,0xba,0xd,0x37,0xc3,0xba,0x66,0x93,0x61,0x8b,0x4b,0x28,0xdf,0xc9,0x50,0x65,0xbc,0x91,0x7e,0x62,0x7d,0x69,0xce,0x4b,0xe1,
+0x46,0x9f,0x6,0xdb,0x9e,0x52,0xd2,0x1,0xcb,0x46,0xf,0x61,0xc6,0x41,0xa5,0xf3,0x11,0x70,0x60,0x56,0x2e,0xa7,0x23,0xcd,0xe9,0x5d,0xb2,0x56,0x7a,0x1a,0x3b,0xcb,
+0x61,0x33,0xe5,0xa7,0xca,0x8,0x58,0xc7,0xcb,0xea,0x5,0x5b,0x5b,0x85,0xdd,0xfe,0x93,0xa,0xcd,0x9e,0xed,0x1a,0xf0,0x69,0x4a,0xdd,0x41,0x26,0xc9,0x73,0xb,0x47,
+0xbf,0xe7,0x52,0x24,0x3,0xe4,0xe9,0x52,0x13,0x22,0xfd,0xd1,0xb8,0x8f,0xf6,0xf1,0x51,0x5,0xcc,0xc8,0xbf,0x2e,0xe1,0xe7,0x3f,0xd9,0xd0,0x6c,0x68,0xd5,0xf,0x1b,
+0x23,0xdd,0xf8,0x52,0x96,0x56,0x4e,0x6,0xfd,0xa7,0x9f,0x9b,0x69,0x15,0x9d,0xb5,0x2e,0x7d,0xc6,0xbd,0xc4,0x42,0x30,0x63,0x70,0x1b,0x7,0x87,0x6c,0x83,0x4e,0xfb,
+0x5c,0x72,0x33,0x88,0x9e,0x3c,0xee,0xdc,0x7c,0x93,0xb6,0x91,0xa,0xf6,0x26,0x47,0x5f,0x9b,0x7c,0xb1,0x7d,0xee,0x17,0x23,0xe5,0xc5,0x28,0x97,0x7e,0xf2,0xb2,0x23,
+0x20,0x62,0x38,0x23,0xf3,0xa5,0xcb,0x16,0xc6,0xe4,0xc9,0x21,0x6e,0xa4,0xb7,0xf2,0xa7,0x93,0x9e,0x17,0x6f,0x4c,0xee,0xcf,0x2,0x9f,0x32,0x44,0xc9,0xb1,0xe1,0x90,
+0x7f,0xcb,0x39,0xbf,0xe0,0x23,0x9a,0x95,0x24,0x28,0xfb,0xb7,0xcd,0xb7,0x83,0xb4,0x9f,0xbb,0x49,0xab,0xea,0x69,0xad,0x86,0xab,0xae,0xd0,0x9f,0xbd,0x20,0x77,0x2a,
+0x39,0x15,0x28,0xf9,0x4e,0x57,0xb7,0xad,0x41,0x3a,0x88,0x3e,0x55,0x54,0x5e,0x8b,0xdd,0xbb,0xd3,0xb7,0x63,0xe6,0xc7,0xd6,0x88,0xdb,0x66,0x29,0xae,0xa4,0x9c,0xb0,
+0x24,0xe,0x9d,0x69,0xa0,0xed,0x6e,0x3f,0x5a,0x5a,0x5c,0x94,0x28,0xe5,0x86,0x7a,0x7b,0x52,0x97,0xc2,0x67,0xa6,0xea,0x34,0x7a,0xe,0x3a,0x89,0xc8,0xfe,0x12,0xde,
+0xc2,0x86,0xea,0x7e,0x63,0xcf,0xa5,0x24,0x92,0x2a,0xcc,0x5f,0x97,0x8e,0x5b,0x93,0xde,0x9b,0x84,0xc8,0x6c,0x66,0x95,0xd3,0xd8,0x5a,0xdc,0x71,0x3b,0x57,0x3b,0x72,
+0x3e,0xb8,0xa6,0x17,0xf9,0x72,0xa9,0xfa,0xee,0x35,0x51,0xee,0x47,0xc5,0xb8,0xd6,0x1c,0x11,0xc9,0xcf,0xde,0xcf,0x7a,0x32,0x7a,0xfe,0x79,0x15,0xaf,0x35,0xc1,0xf6,
+0x1a,0x37,0x16,0xe7,0xd7,0x8f,0x7a,0x63,0x9c,0xc4,0xe3,0xe6,0xf9,0x86,0x31,0x59,0xfb,0xb7,0xd0,0xae,0x53,0x9f,0x9b,0x7c,0x52,0xb4,0x72,0xaf,0xce,0xf,0xae,0x7f,
+0x1a,0x8b,0xa6,0x4b,0x31,0x35,0xd2,0x6a,0x35,0xfe,0x65,0xc0,0x63,0xb5,0xba,0x90,0x71,0x42,0xe7,0xe5,0xc8,0x70,0x73,0x52,0xd6,0x96,0x1a,0x67,0x5d,0x67,0x95,0xb6,
+0x5e,0x39,0xdc,0x45,0x5b,0x5f,0xca,0xbc,0xf9,0x44,0xda,0xd6,0x15,0xe2,0x82,0xee,0xde,0x5b,0x4b,0x9d,0xfe,0x5c,0xcb,0xb4,0x94,0xc6,0x41,0xf5,0xae,0xa,0x1b,0x67,
+0x8f,0x54,0x5b,0x5b,0xf9,0x16,0xce,0x35,0x7d,0xb2,0xbb,0xff,0x0,0x8,0xae,0xbc,0x3c,0x96,0xc4,0xc9,0x75,0x1b,0x7a,0xb6,0xf1,0xce,0xf0,0xdb,0xdf,0xfd,0xa2,0xdc,
+0x63,0xe6,0xfb,0xaa,0xd5,0xb5,0xa3,0xcf,0x26,0xb9,0x7b,0xa5,0xe8,0xba,0x9e,0xa9,0x2f,0xf6,0x68,0x2d,0xbc,0x21,0xf9,0x9f,0x9c,0xed,0xae,0x99,0xab,0x23,0x27,0xdc,
+0xed,0xb5,0x2d,0x4b,0x4b,0xf0,0xbd,0x95,0xbc,0x26,0x16,0xb,0xcf,0x93,0x67,0x11,0xc9,0x35,0x53,0x49,0xd1,0xae,0x35,0xab,0xe8,0xb5,0xff,0x0,0x15,0xe4,0xbf,0xfc,
+0xb9,0x69,0xa3,0xa4,0x69,0xd8,0xd7,0x1a,0xf7,0x51,0xcf,0x67,0xf1,0x1a,0xfe,0x22,0xf1,0x34,0x3a,0x27,0x91,0x64,0x90,0xfd,0xb7,0x53,0x93,0xe5,0x82,0xca,0x1e,0x4,
+0x6b,0xeb,0x59,0x71,0xf8,0x62,0xf3,0xc4,0x57,0x4f,0xab,0x78,0xdd,0xa5,0x49,0xf,0xee,0xed,0xb4,0xf8,0x48,0x1b,0x23,0x14,0x9f,0xb8,0xb4,0xdc,0x51,0xd3,0xde,0x37,
+0x35,0xdd,0x5f,0x4b,0xf0,0xe5,0xaa,0xa5,0xfe,0xd8,0x52,0x8,0xc7,0x91,0xa6,0xc3,0xc3,0x11,0xd8,0x57,0x28,0xd6,0x7e,0x2b,0xf1,0x3a,0x35,0xce,0xa2,0xc7,0x4b,0xd3,
+0xb7,0x9,0x22,0xb6,0xc1,0x51,0x22,0xb7,0x4a,0xaa,0x76,0xa7,0xaf,0x51,0xc6,0xd7,0xbb,0x21,0x9f,0xe1,0xf7,0x88,0xdf,0x51,0x76,0xb3,0xb5,0x89,0x6c,0x8e,0x1f,0xcc,
+0x9c,0x80,0x7,0xad,0x47,0x3f,0x83,0x2c,0xac,0x88,0x8f,0x5a,0xf1,0x66,0x99,0x64,0xe0,0xe7,0xcb,0x82,0x12,0xef,0x9a,0xd1,0xd5,0x93,0x7e,0xe2,0x2e,0xe9,0x10,0x4d,
+0x67,0xe1,0x5b,0x69,0x1b,0x17,0x7a,0x95,0xe6,0xde,0x3c,0xd8,0xdb,0x62,0xbd,0x54,0x9a,0x7d,0xe,0x9,0xf6,0x2e,0x99,0x39,0xc1,0xff,0x0,0x59,0x2d,0xd1,0xe9,0x49,
+0x73,0x36,0x4f,0x3c,0xdf,0xba,0x56,0xfb,0x7d,0xaf,0x6,0x2b,0x28,0x8c,0xa1,0x36,0xb6,0x41,0x7c,0xf3,0x4f,0x4d,0x50,0x20,0x5d,0x96,0x50,0xee,0xe7,0x29,0xf6,0x7e,
+0x4d,0x6f,0x2d,0x16,0x83,0x71,0x66,0x9a,0xeb,0xd2,0x82,0x4c,0x1a,0x70,0xc8,0x3c,0xed,0xe3,0x8a,0x98,0x6b,0x73,0xf0,0xe6,0xce,0x1e,0x9d,0xcf,0x35,0xca,0xa2,0xaf,
+0x6b,0x94,0xd6,0x86,0xad,0x8f,0x8e,0xb5,0x3b,0x5d,0x32,0x5b,0x5f,0xec,0x9b,0x37,0x59,0xd5,0xbc,0xc4,0x51,0xb4,0x64,0xf6,0xae,0xda,0xf,0x16,0xe9,0x7a,0x8f,0x82,
+0xee,0x2e,0x14,0xe9,0x76,0x73,0xc7,0x14,0x9b,0x6c,0x6e,0x66,0x53,0xb7,0x67,0x18,0xad,0xbd,0x85,0x26,0xf6,0x1a,0x96,0x87,0x11,0x75,0xe2,0x21,0x75,0x2e,0xe1,0xa5,
+0x69,0xbb,0x33,0xfc,0x20,0x74,0xac,0xe7,0xd5,0x5e,0x4c,0x96,0xb1,0xb3,0x8b,0xfd,0xc4,0xac,0x64,0x88,0x82,0xf3,0x2a,0xb5,0xfa,0xce,0x7f,0xd5,0xda,0x61,0x1b,0x39,
+0x11,0x73,0x47,0x9e,0xa4,0x67,0xcb,0x8e,0x4c,0xfb,0x53,0xb3,0xe5,0xb1,0x5c,0x8c,0x56,0x78,0x7,0x2e,0x55,0x64,0x3e,0xe6,0xa6,0x1e,0x59,0x40,0xd1,0xb9,0x6f,0x7c,
+0x8c,0x54,0xa7,0x29,0x12,0x31,0x9,0xc8,0xdb,0x83,0x93,0xcd,0x11,0x9,0x36,0x46,0x1d,0x48,0x76,0x38,0x6e,0x39,0xeb,0xd2,0x9b,0x76,0xd8,0xa1,0x49,0xdb,0x80,0x7b,
+0xf4,0xcd,0x48,0xea,0x72,0xb2,0x8,0xa3,0xea,0x3e,0xfa,0xd6,0x53,0xb8,0xe2,0xc3,0x80,0x7e,0xf6,0x3b,0xf5,0xa0,0xf7,0xea,0x54,0xff,0x0,0xb3,0x56,0x9b,0x43,0x56,
+0x40,0x9f,0x2f,0x18,0xe3,0xda,0x97,0x7,0xcc,0xe7,0x6,0xa9,0x3b,0xf,0x94,0x1,0xd,0x19,0x64,0x72,0x7b,0xe7,0x3d,0x69,0xc3,0xd7,0x62,0xf4,0xe9,0x59,0x3b,0xd8,
+0xad,0x3,0x76,0x33,0x9e,0x94,0x99,0xf4,0xa5,0x4d,0x69,0x72,0x6e,0x0,0x9c,0xf1,0x9a,0x6b,0xb1,0xc0,0x23,0x3c,0x37,0xcc,0x31,0xd6,0x95,0xd9,0x29,0x3,0x7d,0xef,
+0x4f,0xad,0x37,0x27,0xd5,0xb1,0xf5,0xa7,0xa8,0x3d,0x4,0x20,0xe3,0x23,0x9c,0x1c,0xe3,0x1d,0x69,0x87,0x86,0xc7,0x6f,0x5c,0x55,0x27,0xdc,0x70,0xb2,0x29,0x6a,0x36,
+0xc6,0x68,0x16,0x68,0xd5,0x1d,0xa2,0xfb,0xfc,0xfc,0xde,0xcb,0x58,0xdf,0x77,0xe6,0xdd,0xf3,0x7f,0x77,0xbd,0x6f,0xd,0x4b,0xdc,0x33,0xb8,0x64,0xe7,0x9f,0x5a,0x45,
+0xff,0x0,0x5a,0x0,0xc7,0x97,0xfc,0x41,0xba,0xf,0x5a,0x77,0x68,0xa8,0xf9,0x9d,0x3e,0x9d,0xbf,0x8d,0xde,0x5e,0x5d,0x1,0xc4,0x79,0xdb,0xf5,0xad,0x34,0xae,0xa,
+0x8f,0x53,0x79,0x6a,0x3b,0x8a,0xc1,0xf1,0x3d,0xbf,0x99,0xc,0x57,0xf1,0x47,0x1f,0xda,0x2d,0x8e,0x64,0x3c,0xfc,0xc8,0x3a,0x51,0x46,0x56,0x99,0x9b,0x47,0x67,0xae,
+0x58,0xf8,0xb7,0xc4,0x9a,0x4a,0xa5,0xd6,0x8f,0xa0,0xcf,0x14,0xca,0xb2,0x40,0x62,0x76,0x59,0x62,0x62,0xbc,0x35,0x79,0x75,0xc4,0x17,0x5a,0x5e,0xa0,0xb1,0xdd,0xdb,
+0x4b,0x63,0x77,0x11,0x4,0xef,0xe3,0x2,0xbb,0xe9,0xd9,0x2b,0x26,0x73,0x42,0x50,0x7a,0x23,0xaa,0xf0,0x35,0xbd,0x95,0xc6,0xa2,0xf7,0x37,0xa3,0xcd,0xd4,0xfe,0xfc,
+0x5,0xb9,0x8f,0x6d,0x5d,0xd6,0xbc,0x45,0x79,0x79,0x7e,0x74,0x8f,0xc,0x39,0x9e,0x76,0xff,0x0,0x8f,0xbb,0xd5,0x1b,0x80,0x1d,0xc5,0x46,0xbc,0xde,0xf1,0x9b,0xf8,
+0x8d,0x4f,0xd,0x68,0xd6,0x7e,0x1f,0x86,0xe2,0xeb,0xcd,0x59,0x6f,0x4a,0xfe,0xfe,0xfe,0x6e,0x3c,0xb5,0xf4,0xaa,0x97,0x1e,0x27,0xd4,0x75,0xa9,0x9b,0x49,0xf0,0x6c,
+0x1b,0xa6,0x3,0x75,0xcd,0xfc,0x9d,0x15,0x6a,0x2d,0xf6,0xe4,0x1f,0x1e,0xa5,0xef,0xe,0xf8,0x32,0xd6,0xd9,0xe2,0xb9,0xd4,0x97,0xfb,0x5f,0x5c,0x92,0x4f,0x32,0x47,
+0x90,0x96,0x8d,0xf,0x61,0x51,0x6b,0xbe,0x33,0xd2,0xad,0x6e,0x27,0xb7,0x8a,0x67,0xd4,0x75,0x22,0xfb,0x3f,0x77,0xf7,0x14,0xd3,0xa7,0x1f,0x6b,0x3d,0x43,0xe3,0x76,
+0x44,0x3e,0x20,0x4d,0x5a,0x7d,0x34,0xbc,0x77,0x4e,0xd0,0xaf,0xcc,0xd1,0xae,0x59,0xb1,0x5c,0x5a,0xc5,0xe,0xd7,0x92,0x38,0x27,0x3d,0xcb,0xc6,0x77,0x56,0xb1,0x9f,
+0x31,0xad,0x3f,0x76,0x3a,0x10,0xdc,0x40,0xd8,0xda,0x2d,0xe7,0xdc,0xfd,0x14,0x43,0xb7,0x70,0xa4,0x58,0x55,0x3c,0xc4,0xf3,0x26,0xfe,0x1e,0xa4,0x1a,0xd2,0x3e,0xe8,
+0xd3,0xb8,0xe4,0xdb,0xc2,0x36,0xde,0x3f,0x3e,0x79,0xab,0x2a,0x82,0x38,0x77,0x2,0x7d,0xe9,0xcd,0x2b,0xd8,0x57,0xc,0xc7,0xb7,0x22,0x35,0xde,0x39,0xf,0x8f,0x98,
+0xfb,0x53,0xd5,0x11,0x1f,0xe5,0x2c,0xc4,0x92,0xdf,0x31,0xfd,0x2b,0x1a,0x69,0xc7,0x41,0x26,0x4a,0xaf,0x86,0xf3,0x40,0x3f,0x3b,0x72,0x1f,0xeb,0xc9,0xa6,0xc9,0x1c,
+0x72,0x6d,0x70,0xb0,0xf9,0x81,0xf7,0xfc,0xfb,0x73,0xb3,0xa5,0x1f,0xe,0xe5,0x2e,0xe4,0x87,0x76,0xe0,0x8c,0x76,0x31,0x19,0x14,0x72,0x3b,0xe6,0x86,0x91,0x9d,0xf5,
+0x1c,0x93,0xc9,0x2c,0x88,0x1b,0xb3,0x63,0xee,0xe0,0xd3,0x80,0xcc,0xcb,0xe6,0x60,0x7c,0xf9,0x23,0xfd,0x9a,0xa9,0xd9,0x17,0x70,0xf3,0x51,0x54,0xf9,0x99,0x51,0x9c,
+0x10,0x69,0x7a,0x7c,0xc3,0x88,0x87,0x2,0xb2,0x5e,0xe1,0x36,0xb0,0xe5,0x8f,0x96,0x3,0x3b,0x3a,0x71,0x4a,0xae,0x76,0x71,0x27,0x97,0xef,0x45,0x90,0x16,0x62,0x32,
+0xbe,0x54,0x42,0xd3,0x60,0xf4,0x41,0xcd,0x3d,0xad,0xd6,0x2d,0xc5,0x6d,0xa7,0x85,0x8f,0x5f,0x39,0x4e,0xd,0x4f,0x2b,0x2d,0x68,0x46,0x38,0xea,0xb9,0x3,0xe6,0xdc,
+0x68,0x55,0xe3,0xb9,0xc8,0x15,0xb,0x62,0x6f,0x7d,0x80,0x70,0x54,0xfa,0x50,0x4b,0x2,0x5d,0x4b,0x6e,0x5e,0xdb,0xb0,0x2a,0x97,0xbc,0x31,0xd8,0xf9,0x7b,0xe3,0xb5,
+0x38,0x1d,0x84,0x12,0xc7,0xf3,0xa8,0x96,0xe4,0xbd,0x8,0xd0,0x6d,0x45,0x5d,0xee,0xc7,0xd5,0xce,0x68,0x6e,0xe,0x77,0x70,0x2a,0xbc,0xc2,0xe0,0x40,0x76,0x18,0x3c,
+0xf,0xd6,0x97,0xae,0x6,0x4f,0xbf,0xd2,0xa2,0x3e,0x61,0xa8,0xcc,0x82,0x31,0xde,0x93,0xb7,0xcd,0x57,0x71,0xa6,0x30,0xf3,0x2c,0x6e,0xa7,0x85,0xcf,0xca,0x1b,0xaf,
+0x14,0xdd,0xd9,0xdf,0xc8,0x3b,0x5c,0x8f,0xa5,0x2d,0x2c,0x1d,0x41,0x4e,0xde,0x9c,0x1e,0xb5,0x87,0x7f,0x17,0x95,0x7c,0xfd,0x70,0xff,0x0,0x36,0xee,0xd5,0xd1,0x4f,
+0x72,0xe3,0xb9,0x5d,0x81,0x0,0x1c,0x70,0x69,0x83,0xfb,0xd9,0x3c,0x56,0x92,0xb5,0xb4,0x1a,0xd7,0x54,0x75,0x16,0xb8,0x7,0x7a,0x7d,0xee,0x99,0xad,0x24,0xaf,0x3e,
+0x51,0xbe,0xac,0xe8,0x14,0xd5,0x6b,0x95,0x49,0xad,0xcc,0x6d,0xc8,0x6e,0xd,0x42,0x56,0xd4,0xcd,0x97,0xed,0x63,0xf0,0xf7,0xd9,0x21,0x7b,0xdf,0x1c,0x6a,0x91,0x5d,
+0xec,0x3,0x8d,0x48,0xfe,0xef,0x14,0xba,0xbf,0x85,0x35,0x8d,0x7a,0x8,0xee,0x74,0xcd,0x76,0xd3,0x58,0xb7,0xcf,0xca,0xc5,0x36,0xc8,0xe0,0x8e,0x5,0x76,0xf3,0x72,
+0x2f,0x78,0xe3,0x53,0xd6,0xee,0x36,0x3c,0xf5,0x85,0xc2,0x4c,0xf6,0x52,0x24,0x96,0x52,0xc7,0x26,0x24,0x4,0xed,0xd8,0x6b,0xbc,0xd1,0xef,0xf4,0x4d,0x2f,0x42,0x48,
+0xe3,0x92,0x3d,0x3f,0x68,0xdd,0x30,0x90,0xfe,0xf6,0x57,0xaa,0xa9,0xef,0xe8,0x8d,0x25,0xa9,0x99,0x33,0x5d,0xf8,0xca,0x4f,0xdd,0xf9,0x96,0x1e,0x1f,0x81,0x81,0xc4,
+0x9f,0xf2,0xd9,0xeb,0xa2,0x8a,0xfb,0x47,0xf0,0xc6,0x8d,0x22,0xa2,0x1b,0x7b,0x2c,0xe7,0x6a,0xff,0x0,0xac,0xb8,0x6a,0xcf,0x59,0x7b,0x86,0x4f,0x4f,0x74,0xc9,0x9e,
+0xeb,0x5e,0xf1,0xb2,0xe7,0x45,0xff,0x0,0x89,0x56,0x85,0x13,0x79,0x7e,0x63,0xcb,0xb4,0xc8,0xdc,0x66,0xb6,0xec,0x3c,0x3b,0xa4,0x69,0x36,0xaf,0xf6,0x2b,0x5f,0x37,
+0xca,0x1f,0x3d,0xdc,0xc3,0xe6,0xeb,0xd6,0x94,0xe4,0xbe,0x2,0xaf,0xc9,0xb1,0xd0,0xe9,0xe,0x97,0xd6,0xbe,0x4e,0x63,0x32,0xaf,0x1e,0x5f,0x7c,0x57,0x97,0xf8,0x9e,
+0xce,0x7d,0x13,0x5e,0x6b,0x72,0xaf,0x1c,0x13,0x2f,0x9b,0x18,0x4c,0x8d,0xde,0xb5,0xb5,0x15,0xca,0xec,0x4a,0xf8,0xac,0x62,0x19,0x37,0xcb,0xf3,0xdd,0x4a,0xe1,0x4f,
+0x45,0x93,0x77,0xde,0xa1,0x81,0x50,0x59,0x3e,0x65,0x51,0x93,0xb4,0x74,0xae,0x89,0xb8,0x48,0xe8,0x5e,0xea,0x1d,0x1c,0xde,0x5e,0xe9,0x47,0x25,0x76,0xe7,0x7,0xe6,
+0xab,0xc,0xd9,0x3b,0x77,0x6e,0x5c,0xee,0x18,0xfe,0x75,0x97,0x23,0xb8,0x9a,0xd4,0x96,0x24,0x71,0x8,0x69,0x17,0x5,0xfb,0x52,0xe0,0xf4,0xc6,0x7f,0x1a,0xce,0x52,
+0xb0,0x35,0x1b,0xa,0x1,0xf3,0x71,0x85,0xe7,0xe5,0xe7,0xd6,0x9e,0x1d,0x99,0xb6,0xb6,0x37,0x7f,0x74,0x91,0x4e,0xa7,0xbf,0xa9,0xa5,0xa2,0x48,0xf2,0x81,0xc4,0x92,
+0x80,0xe7,0xe6,0x21,0x5f,0x93,0x47,0xf1,0x1,0xfd,0x6a,0x22,0x64,0xe0,0xba,0x8e,0xde,0x77,0x65,0x89,0x3f,0x4a,0x9a,0x22,0x5c,0x31,0xd9,0xe,0x3,0xee,0xce,0x31,
+0xf8,0x55,0xf2,0xa5,0xab,0x26,0xec,0xbc,0xb2,0xa4,0x36,0x92,0xe2,0x24,0xf3,0x18,0x13,0xbb,0xd0,0xd5,0x7,0x60,0x4b,0xe7,0xe6,0x1d,0x81,0x18,0xac,0xec,0x32,0x47,
+0x3f,0x36,0x3c,0xa4,0x1e,0x87,0x26,0x99,0xbc,0x2c,0x6d,0xd9,0xfb,0xfe,0x74,0xf7,0x41,0x72,0xe5,0xa9,0x1,0x94,0xf1,0xc9,0xce,0x76,0xfe,0x95,0xb1,0xcf,0xd9,0xf,
+0x3d,0x39,0xa4,0x85,0xcd,0xcc,0xcc,0x5b,0x86,0xd8,0x5d,0xb0,0x17,0xd8,0x53,0x77,0x6d,0x38,0xe3,0x34,0x9c,0x53,0x1d,0xad,0xb0,0xa3,0xe6,0xa5,0x62,0x7,0x5f,0x5a,
+0xcb,0x67,0x64,0x26,0xc4,0x7,0x3c,0x50,0x38,0x38,0x39,0xdb,0xeb,0x57,0x6e,0x5d,0x19,0xa2,0x4,0x24,0xf5,0x18,0xf6,0x3d,0x68,0x3d,0xff,0x0,0x91,0xa7,0x7e,0xc4,
+0x8d,0xce,0x70,0x8,0x55,0xe7,0xf8,0x5,0x21,0x61,0xbc,0x80,0x7e,0x6f,0xe9,0x52,0xa1,0x67,0x71,0x6,0x31,0xfd,0xdc,0x7a,0xf7,0xa8,0xf0,0xcc,0x49,0xf7,0xc9,0xcd,
+0x5e,0x96,0xb8,0x21,0x1f,0x97,0xe6,0x90,0xfd,0xce,0xb4,0xb9,0x74,0x1b,0x63,0x58,0x7a,0x91,0x8f,0x73,0x8a,0xcf,0xd5,0xd3,0x36,0xf1,0xc9,0xbb,0xee,0x12,0x4e,0xd3,
+0xd4,0x55,0xd3,0x7a,0x93,0x19,0x6a,0x66,0x7f,0xad,0x88,0xbf,0xf1,0x16,0x6c,0x8a,0x11,0x77,0x32,0x44,0xdd,0x1f,0xe5,0x7f,0x6a,0xde,0xa9,0xb4,0x25,0x66,0x74,0xb6,
+0xcd,0xbf,0xca,0x6c,0x85,0xce,0xd1,0x82,0x78,0xad,0x35,0xfe,0x55,0xe5,0xcd,0xeb,0x63,0x6e,0x61,0xdf,0x8d,0x46,0xd2,0x32,0x91,0x86,0x3f,0x29,0xcd,0x3b,0xad,0x8c,
+0xec,0x5a,0xf0,0xc5,0xea,0xc1,0xa5,0xfd,0x92,0xdf,0xc2,0x17,0x7a,0xab,0xc7,0x2c,0x9e,0x75,0xd2,0xc1,0x19,0x12,0x1c,0xd1,0x73,0xff,0x0,0x8,0xc7,0xdb,0x5a,0x6b,
+0xbb,0x1d,0x57,0xc2,0x37,0xec,0xdf,0x24,0x8c,0x1a,0x24,0x27,0xb1,0xae,0x98,0xf2,0x7f,0xcb,0xbd,0xce,0x69,0x73,0xf7,0x2b,0x78,0x87,0xc3,0x3a,0xe6,0xb1,0x6a,0x75,
+0x6b,0x2d,0x46,0xd3,0x5c,0x40,0xaa,0x14,0xc1,0x6b,0xe5,0xbc,0x91,0x9a,0xe3,0xa2,0xb7,0x7b,0x9d,0x47,0x6e,0xad,0x92,0x61,0x93,0x69,0x5c,0xe7,0x1e,0xd5,0xbc,0x66,
+0xb9,0x74,0x25,0x4a,0x2b,0x63,0xa3,0xbb,0xf1,0x15,0x8e,0x99,0x6a,0x91,0xa0,0x2f,0x22,0xa6,0xd8,0xed,0xd5,0x70,0xab,0xc5,0x37,0x4f,0xd2,0x66,0xd6,0x27,0x3a,0xaf,
+0x88,0x98,0x3b,0x7d,0xd8,0x6d,0x47,0x40,0x3b,0x1a,0x89,0xae,0x45,0xa0,0xef,0xca,0xb9,0x99,0xd1,0xea,0x5e,0x23,0xd3,0x74,0x45,0x8d,0x35,0x3,0xb9,0x91,0x7e,0x4b,
+0x28,0x38,0x20,0x56,0x13,0xda,0xf8,0x9f,0xc4,0xff,0x0,0xe9,0x3a,0xa3,0xad,0x86,0x9c,0x4f,0x9b,0x15,0xb8,0x1b,0x78,0x3c,0xa,0x50,0xfd,0xcf,0xbd,0xd4,0x23,0x6d,
+0xe4,0x75,0x76,0x70,0x49,0xa5,0x78,0xa7,0x17,0xd,0x88,0xa5,0xc6,0x38,0xe9,0x5b,0x3e,0x31,0xd1,0xda,0xfb,0xc3,0x86,0x7b,0x61,0xba,0xe2,0xd0,0x19,0x21,0x20,0x7b,
+0x52,0x72,0xf7,0x8c,0x1f,0x43,0xc5,0xaf,0x6c,0x67,0xb7,0x4f,0xde,0x79,0x40,0x95,0x2a,0x76,0x8e,0xad,0x8a,0x8a,0x18,0xc,0x7f,0x29,0xd,0xb1,0xba,0x6f,0xf6,0xae,
+0xc8,0xe8,0x8e,0xe8,0xea,0x3d,0x93,0x85,0xda,0x0,0xf5,0x18,0xa7,0xc4,0xc4,0x21,0xd,0xd7,0x38,0x7,0x1d,0xa8,0xe6,0xd0,0xcd,0xb2,0xca,0x6e,0xfe,0xf9,0x3f,0xef,
+0xb7,0x4a,0x79,0x32,0x64,0x7c,0xa7,0xf1,0xe2,0xb0,0xf7,0x59,0x69,0xa7,0xb8,0xa0,0x7a,0x37,0x3f,0xd6,0xa4,0x26,0x4f,0x27,0xa3,0x67,0xa6,0x47,0x7a,0x92,0x44,0xf3,
+0x4e,0x33,0x8d,0x83,0x23,0x7f,0x39,0x1c,0x53,0x72,0x42,0x7,0xc9,0xf4,0x6c,0xf7,0xad,0x22,0x90,0xb7,0x24,0x25,0x84,0xa7,0xb,0xd3,0xee,0xf1,0x49,0xbb,0x7e,0xe6,
+0x66,0xdd,0x81,0xf7,0x76,0xe2,0x86,0xc2,0xc4,0x98,0x7f,0x30,0x60,0x22,0x8c,0x3,0x9d,0xdd,0x6a,0x72,0x97,0x2f,0x2e,0x52,0x17,0x58,0xfa,0xfc,0xc3,0xda,0xa6,0x52,
+0x83,0x77,0x41,0x61,0xde,0x59,0x55,0xc9,0x92,0x0,0x7f,0xe9,0xa3,0xe2,0x8f,0xdd,0x6e,0xdd,0x18,0xcf,0x27,0x3d,0x7a,0xd6,0x4d,0xbe,0x81,0x1b,0xb1,0xf6,0xee,0x77,
+0xef,0x91,0x9a,0x45,0x1c,0xfc,0xa2,0xb7,0x9c,0xed,0xb1,0x97,0xd9,0x79,0xc8,0xac,0xf9,0x6e,0xee,0x88,0xe5,0xb1,0x89,0x74,0x4f,0xda,0x3f,0x87,0x1b,0x7d,0x2a,0x30,
+0xcf,0xbd,0x71,0x26,0x0,0xc9,0x23,0xf0,0xad,0x6d,0xa1,0x57,0x1e,0x49,0x3c,0xfa,0xaf,0x5a,0x67,0x38,0x52,0xdd,0xbb,0xe2,0xa2,0x2b,0x52,0xb9,0x90,0xef,0xde,0x0,
+0x36,0x2a,0x36,0x5b,0xf8,0x9b,0x18,0xa0,0xff,0x0,0xb,0x9f,0xbc,0x3b,0x76,0xab,0x9a,0xb8,0xb4,0xe8,0x27,0xcf,0xf7,0xba,0xfb,0x50,0xe4,0x8f,0xc7,0xbd,0x63,0xb0,
+0x6f,0x11,0x16,0x4f,0xde,0x73,0xca,0xe6,0x91,0x58,0x22,0xa2,0xb9,0x3,0xda,0x9b,0xbe,0xc2,0x51,0x17,0x3b,0x8f,0x5f,0x97,0xd2,0xa2,0x6c,0x82,0x37,0xc,0x83,0xe9,
+0xfc,0x34,0x96,0x8c,0x49,0x8e,0x35,0x19,0x2e,0x4b,0xf3,0x80,0x1c,0x8e,0x95,0xb4,0x2e,0x5f,0x30,0xaa,0xb9,0x71,0xe9,0xdf,0x35,0x4,0xcb,0xbe,0xd9,0xe2,0x4e,0xb,
+0x2e,0x17,0x1d,0x47,0x34,0xb9,0xb5,0xb,0xdc,0xc1,0x77,0xc3,0xb0,0x66,0xa,0xf9,0xef,0x4a,0x19,0xba,0xaf,0x6e,0x78,0xef,0x5d,0x2d,0x77,0x2e,0xc7,0x47,0x65,0xca,
+0xd,0xdf,0x30,0xf9,0x7b,0x7b,0x56,0xa2,0x13,0xc6,0x0,0xc5,0x79,0x73,0xf8,0x8d,0xb9,0x43,0x9d,0xbf,0x7b,0x6b,0x7a,0xe3,0x38,0xaa,0xf3,0x9d,0xa3,0x5,0xfa,0x36,
+0xd2,0x47,0xcb,0x54,0x22,0xd7,0x86,0xef,0x3c,0x47,0x21,0xbd,0xb2,0xd1,0xa3,0xd2,0x16,0x1b,0x79,0x7c,0xd9,0x9a,0xef,0xa0,0x32,0x74,0xad,0xff,0x0,0x37,0xc6,0x61,
+0x76,0xcf,0x6d,0xa0,0xea,0x76,0xf9,0xf9,0xad,0xad,0xfe,0x42,0xf5,0xd2,0xd4,0x54,0x6c,0x70,0xcf,0x93,0x9c,0xc4,0x9a,0x3d,0x17,0xed,0xcd,0x3d,0xd4,0x7a,0xaf,0x84,
+0x35,0x9,0xdf,0x72,0xb7,0x9f,0xb5,0x24,0xcf,0x4a,0x76,0xa7,0xe0,0x2d,0x5f,0x51,0x49,0x2f,0xad,0x75,0xd5,0xbe,0x2e,0xbf,0x29,0x8e,0xcb,0x6f,0x99,0xc7,0x4a,0x39,
+0xfc,0xae,0x57,0x37,0x2f,0xc4,0x72,0xa,0x17,0x42,0xbf,0x51,0xa8,0xd,0x97,0x30,0xf1,0x22,0x39,0xcb,0x67,0x15,0x35,0xc7,0x88,0xa7,0x62,0x13,0x49,0xc,0xf3,0x39,
+0xcb,0x48,0xc7,0x20,0x56,0x9c,0xad,0xbb,0xb1,0xf2,0xf3,0x6a,0x6b,0xf8,0x7f,0x48,0xb6,0x8a,0xe1,0x6f,0x35,0x2,0xb7,0xfa,0x83,0xb7,0x98,0x7c,0xce,0x42,0x9a,0xd3,
+0xd6,0x3c,0x61,0xa7,0x5b,0x34,0x90,0xa3,0x3d,0xee,0xa0,0xc7,0x1f,0x2f,0xa,0xa6,0xb3,0x50,0x73,0x95,0xd9,0x2e,0xf2,0x7c,0xa8,0xf4,0xf,0x15,0xe8,0xeb,0xa8,0x78,
+0x7c,0x5d,0x5b,0x10,0x2e,0x20,0x1e,0x60,0xff,0x0,0x6b,0x8e,0x95,0x27,0x85,0x2f,0x93,0x50,0xd1,0xbc,0x8d,0xff,0x0,0x3c,0x3f,0xbb,0x71,0xed,0xd2,0xa7,0xe2,0x57,
+0x39,0xe5,0x23,0xce,0xbc,0x41,0x6b,0x15,0xae,0xae,0xf1,0x9f,0x30,0x2b,0xbe,0x54,0x9e,0x84,0xfa,0x57,0x3d,0x3d,0x95,0xb6,0xe7,0x7f,0x36,0x78,0xa1,0xfb,0xc3,0xf7,
+0x60,0xb0,0xab,0xbb,0x46,0xb1,0x99,0x7,0xd9,0xec,0x97,0xe6,0x93,0x55,0xf2,0xc6,0x78,0xdd,0xd,0x35,0xed,0xac,0x9e,0x25,0x3f,0xda,0x91,0x60,0xfd,0xdc,0xc2,0xc3,
+0x27,0xd2,0x9f,0x34,0xbb,0x1d,0x1a,0x3e,0x85,0xbb,0x3d,0x39,0x5d,0x9a,0x35,0xd5,0x2d,0x64,0x23,0x18,0x2c,0xac,0x40,0xa7,0xad,0x94,0x6,0x56,0x8e,0x6f,0x11,0xe8,
+0xd1,0x3a,0x3e,0xe,0xf3,0x25,0x25,0x29,0x3d,0x2c,0x52,0xe5,0xb1,0xa9,0xa6,0x68,0x7a,0x65,0xd3,0xcb,0xf6,0x9f,0x1a,0x68,0xbb,0x53,0xa6,0x5b,0x6e,0x7f,0xd9,0xaa,
+0x7e,0x46,0x92,0xd1,0xaa,0xae,0xbd,0x1,0x27,0x8d,0xb1,0xa3,0x73,0x55,0xfb,0xee,0xc4,0x4f,0x92,0xda,0x5c,0x3e,0xc3,0x14,0x45,0x4a,0x5c,0x4d,0x27,0xfb,0x30,0xc7,
+0xc2,0xad,0x30,0xdb,0x47,0xe6,0x8f,0xf4,0x6d,0x59,0xf7,0x77,0xc0,0xc5,0x3b,0x32,0x37,0x2d,0x43,0xa4,0xcb,0x3c,0x29,0x2d,0x9e,0x91,0x7d,0x36,0xe7,0xd9,0x99,0x2e,
+0x7,0x5a,0xac,0xe8,0x61,0x91,0xd0,0x5b,0xda,0x42,0xf1,0xb1,0xc,0x26,0x3b,0xb9,0xac,0x7d,0xa3,0x6f,0x96,0x2c,0xd1,0xfb,0xc3,0x65,0xb8,0xbd,0x16,0xee,0x82,0x7b,
+0x30,0x7e,0xee,0x21,0x53,0x4e,0x90,0x8f,0x33,0x3e,0x61,0x91,0x33,0x9e,0x5e,0x86,0xb9,0x1e,0x83,0x76,0x42,0x3e,0xdc,0xba,0xa7,0xcc,0x50,0x83,0x8c,0xf1,0x51,0xe4,
+0xf9,0xfb,0x79,0x3b,0x5c,0xf2,0x3b,0x9a,0x71,0xb9,0x3b,0x96,0x6d,0xb7,0x7d,0xa3,0x12,0xe3,0x6f,0xea,0x6b,0x62,0x4f,0x33,0xec,0x32,0x90,0xbc,0x6d,0xe7,0x15,0xd,
+0x3e,0x83,0x76,0xe8,0x63,0xce,0xc0,0xb9,0x23,0xa7,0x15,0x19,0xcf,0xe5,0xce,0x2a,0xbe,0x10,0x17,0x79,0xf9,0x46,0x57,0xf0,0xa0,0xf4,0xdc,0x2,0xf5,0xe9,0x9a,0x5f,
+0xb,0x26,0xe8,0x7f,0x61,0x9a,0x66,0x7a,0xd5,0x6a,0x53,0x63,0x4b,0x6d,0x5,0x8b,0x60,0x7d,0x2a,0x43,0x20,0xed,0x27,0xcb,0xdb,0xb5,0x29,0xae,0x61,0x5f,0x51,0x1b,
+0xa7,0xcc,0x78,0xa3,0x2c,0x71,0x86,0xf5,0xa8,0x8a,0x7d,0x4b,0xbc,0x48,0xdd,0x8d,0x27,0xcc,0x76,0xb3,0xba,0x81,0x9f,0x4a,0x73,0x5a,0x11,0xa5,0xc6,0xe7,0xf7,0x23,
+0x27,0x38,0xea,0x7f,0x1a,0x63,0x1e,0x3a,0xf5,0x3d,0x4d,0x9,0x49,0xb,0x41,0x4e,0x31,0xc3,0x1c,0xd3,0x37,0x1c,0x6d,0x25,0xa9,0xdf,0xb1,0x76,0x42,0x36,0xf5,0x51,
+0xb5,0x86,0x3b,0x54,0x37,0x25,0xcc,0xe,0x3,0x60,0xe3,0xd7,0xbd,0x50,0x94,0xf5,0xb1,0x6e,0xc8,0x96,0x9,0xee,0xbd,0x7,0xd2,0xb4,0x93,0xee,0xd7,0x2c,0xd6,0xa7,
+0x75,0xf4,0x6,0x62,0x5b,0xb5,0x52,0xb8,0x93,0x7,0x9c,0x61,0x46,0x5a,0xa9,0x68,0x67,0x61,0x3c,0x3d,0xfd,0xa5,0x71,0xe2,0x59,0xad,0x34,0x7d,0x63,0xfb,0x2d,0xee,
+0x6d,0xbc,0xe9,0x64,0xc6,0xfd,0xfb,0x4f,0x4a,0xeb,0xff,0x0,0xe1,0x14,0xd6,0xe6,0xc4,0x97,0x7e,0x2c,0xd7,0x9d,0xbf,0xbd,0x1c,0x25,0x16,0xba,0x27,0x25,0x7f,0x7a,
+0x27,0x25,0x49,0x72,0x8f,0x97,0x41,0xf1,0x22,0x40,0xf0,0xa6,0xb7,0x67,0xaa,0x44,0xc3,0x98,0x35,0x4b,0x10,0xdc,0x3,0x9c,0x56,0x2d,0xe6,0x8f,0xa5,0xc3,0x79,0x77,
+0xfd,0xb7,0x61,0xa9,0x68,0xc,0xf7,0x27,0x17,0x50,0xdc,0x11,0x6f,0x20,0x3c,0x83,0x51,0xa,0xaf,0xfe,0x5d,0x68,0x67,0xa0,0xff,0x0,0xf8,0x45,0xbc,0x1d,0xe4,0x2d,
+0xc4,0xb7,0x1,0xa3,0x75,0xcf,0xda,0xdf,0x52,0x7,0xb7,0x5a,0xe3,0xaf,0xae,0xac,0xf4,0xbb,0xd9,0x22,0xb6,0xbd,0xb5,0xb8,0x68,0x9b,0xe5,0x96,0x5,0x66,0x46,0xad,
+0x62,0xea,0x4d,0x1a,0x47,0xdf,0xd1,0x90,0xff,0x0,0x6a,0x5f,0x5f,0xb3,0x5a,0xda,0x4c,0x2d,0xe2,0x6e,0x19,0xbb,0x1a,0xdf,0xd1,0x6c,0xec,0x34,0xb4,0x90,0x2f,0x95,
+0x3b,0xb6,0x3f,0x7c,0xcb,0xc8,0xe9,0x4a,0x6b,0x4e,0x51,0xe9,0x17,0x64,0x7a,0x8e,0x87,0xad,0x1,0xf,0x95,0x3f,0x2b,0xdf,0xa6,0x2b,0x1a,0xd2,0x4f,0xec,0x2f,0x13,
+0x3e,0x59,0x85,0xa4,0xdb,0x41,0x55,0xfb,0xb8,0x3c,0xd2,0xa7,0xd4,0xe5,0x71,0xf7,0x8b,0xfe,0x2a,0xd1,0x62,0xd4,0xb4,0x49,0x1d,0x4e,0xd9,0x6d,0x9f,0xcf,0x8d,0x83,
+0x1f,0xca,0xbc,0xae,0x43,0x2f,0x90,0xec,0xd1,0xb4,0x4c,0xec,0x1,0xc,0x3b,0x55,0x46,0xd6,0xb3,0x2e,0xe,0x36,0xb3,0x1b,0x3,0xca,0xcc,0x21,0x52,0xbf,0x3b,0x7f,
+0x1a,0x8e,0x2a,0xc5,0x9e,0xa0,0x62,0x31,0x3e,0x2,0xab,0x13,0xd4,0x3,0xed,0x4f,0x91,0x4f,0x63,0x57,0xb1,0xbd,0xa6,0x6b,0x57,0x96,0xde,0x66,0x23,0x84,0xb7,0x5c,
+0x3d,0xb8,0xe2,0xb4,0xff,0x0,0xe1,0x25,0xbe,0x4b,0x7d,0xe6,0x2d,0x17,0x27,0x24,0x7f,0xa2,0xd2,0x51,0xa7,0xd8,0xcf,0x58,0x92,0x5a,0xf8,0xeb,0x5c,0x10,0xa2,0x1,
+0xa5,0xb7,0xfd,0xbb,0x3a,0x95,0xa8,0x27,0xd7,0xf5,0xab,0x87,0x76,0x7b,0xb8,0x40,0x6c,0x71,0x15,0xb2,0xad,0x6b,0x28,0x51,0xb6,0x90,0x14,0xa7,0x2d,0xae,0x64,0xdc,
+0x5f,0xdd,0x96,0xdc,0xf7,0x32,0x3e,0x4e,0x36,0xf0,0x29,0xb2,0x5c,0xca,0x22,0x5f,0x30,0xf9,0x9f,0xf0,0x2e,0x16,0xa2,0xf6,0x23,0x72,0x23,0x9f,0xec,0x96,0x4,0x32,
+0xe6,0x52,0x45,0x66,0xed,0x54,0x65,0x1b,0x7f,0x21,0x54,0xce,0x94,0xb9,0x48,0xc6,0xee,0x1,0x5,0x9b,0x9c,0x95,0x1e,0x95,0x60,0xfd,0xd8,0xf6,0xf4,0x6c,0x8a,0x5f,
+0x16,0xc2,0xa8,0xfa,0x8c,0x27,0x27,0x69,0xfc,0xa9,0xc2,0x46,0xc8,0x4d,0xdf,0x2f,0x61,0xe9,0x51,0x1b,0x31,0x12,0xc0,0x77,0x32,0xee,0x1c,0x75,0xad,0xb9,0xc,0x83,
+0x4e,0x91,0xc6,0x76,0x77,0x0,0x54,0xcb,0x41,0xee,0xf4,0x31,0x2e,0x1d,0x50,0x1c,0xc6,0xee,0x7,0x64,0xa6,0x96,0xc4,0x99,0xe0,0x6d,0xfe,0xf7,0x5a,0xae,0x85,0x28,
+0xb1,0x32,0xbb,0xc1,0xf6,0xec,0x29,0x79,0x0,0x60,0xe7,0x9c,0xf4,0xa8,0x77,0xb,0x5b,0x41,0x59,0xb3,0xd4,0xa,0x6e,0xec,0x7f,0xf5,0xea,0xbe,0x2,0x6c,0x28,0x27,
+0x39,0xc7,0x1f,0x5a,0x6b,0xee,0xda,0x79,0xdc,0x49,0xdd,0xf3,0x73,0x8a,0x5c,0xd7,0x63,0x1e,0x4e,0x5b,0xe5,0x3f,0x20,0xf4,0x1d,0x69,0xbf,0xc2,0x46,0x48,0xcf,0xa1,
+0xa4,0x9d,0x98,0x86,0x16,0xc1,0xe7,0x85,0xf5,0xc7,0x14,0xdd,0xdc,0x0,0x7b,0xfa,0x56,0x8f,0x96,0x5a,0x83,0x40,0xc5,0x55,0x73,0xc9,0xa4,0x6c,0x73,0x80,0xdb,0x89,
+0xa5,0x76,0xc6,0xa0,0x27,0x45,0xce,0x5,0x5,0xf2,0x80,0x51,0xa2,0x15,0x88,0x7d,0xb3,0x85,0xce,0x6a,0x3b,0x9d,0xbe,0x4b,0x90,0xdf,0x86,0x3a,0xf6,0xaa,0x2a,0xd6,
+0x7a,0x16,0xec,0xc1,0x58,0xb6,0xff,0x0,0x12,0x80,0xaa,0x57,0x9e,0xd5,0xa9,0x9a,0xe4,0xab,0x34,0xd9,0xd7,0xcb,0x71,0x8e,0xe5,0x63,0x73,0xb0,0xe4,0xf,0x94,0xb0,
+0xac,0xe9,0x64,0x1b,0x3a,0x36,0x7d,0xe9,0xc0,0xcf,0x63,0x18,0xdd,0x4b,0x6f,0xa9,0x47,0x25,0xb5,0xcb,0xda,0x4a,0x4f,0x96,0x67,0x56,0xc1,0x55,0x35,0xe8,0xff,0x0,
+0xf0,0xaf,0xad,0x37,0xb7,0xdb,0xff,0x0,0xb7,0x75,0x12,0xdc,0x97,0x69,0x36,0x29,0x35,0xd9,0x52,0x7c,0xbf,0x9,0xcd,0x36,0xa2,0xee,0x47,0x27,0x84,0x7c,0x21,0x10,
+0x22,0x6b,0x18,0xe1,0xdb,0xd7,0x7e,0xa9,0xb5,0x85,0x37,0xfb,0x37,0x47,0xb5,0x19,0xd2,0xfc,0x46,0x6d,0x33,0xc6,0xd9,0xaf,0xe3,0xb9,0x86,0xb0,0x55,0x24,0xfe,0x26,
+0x4f,0x34,0x9f,0xd9,0x2b,0xae,0x87,0xba,0x3f,0xb4,0xdd,0xf8,0x6f,0x4f,0xd7,0x42,0xed,0xf9,0xf4,0xa6,0xf2,0xf8,0x39,0xcd,0x4a,0x75,0x7f,0xb,0xe9,0x89,0xe5,0x5e,
+0xe8,0x27,0x4c,0x52,0x39,0x8a,0xe7,0x4b,0xf9,0xbd,0x28,0xe7,0xf6,0x9a,0x21,0x2e,0x6b,0xe9,0x23,0x8c,0xd5,0x24,0xd2,0x9e,0xf3,0x77,0x87,0x57,0x51,0xb9,0x87,0x67,
+0xdc,0x78,0x3a,0x72,0x6b,0x29,0xae,0xa6,0x95,0x96,0x3e,0x62,0x54,0x3c,0xae,0x30,0x6b,0xa2,0x2a,0xde,0xa6,0xdc,0xbc,0xcf,0x53,0xbf,0xb7,0xd4,0x4,0x70,0x79,0x80,
+0xe1,0x7a,0x92,0x73,0xcd,0x75,0xad,0x3,0x5e,0xe9,0x1f,0x69,0x45,0x7c,0x6d,0xdf,0xf2,0xd4,0x5b,0x96,0x3a,0x9c,0xf2,0x56,0x16,0xd,0x42,0x37,0xd2,0xe4,0xb6,0x9a,
+0x45,0xc,0xea,0x40,0x3e,0xa2,0xbc,0xe7,0x56,0xda,0xb7,0xa7,0xcb,0x5d,0xcb,0x2b,0xef,0x4f,0x4c,0xe2,0xa6,0x30,0x8,0x5b,0x98,0xcb,0xdc,0xc5,0x37,0x2b,0xfe,0xf6,
+0x33,0x91,0x8e,0x33,0x56,0x54,0xc7,0xc1,0xc3,0x30,0xeb,0xf3,0x73,0x57,0x18,0xb4,0xac,0x6d,0x26,0x8b,0x56,0xcd,0x71,0xb3,0xe4,0x91,0xcc,0x99,0xdf,0x90,0xe6,0xb6,
+0xf7,0xc6,0x62,0xc7,0x94,0x9d,0xf1,0xed,0x9a,0x4f,0xdd,0xd1,0x11,0x50,0x81,0x83,0xff,0x0,0xac,0xdc,0x7f,0x13,0xcd,0x11,0xbb,0x32,0x36,0xde,0xdf,0xed,0xe7,0x35,
+0x5d,0x4c,0xb4,0x65,0x77,0x97,0xe6,0x3b,0xb0,0x71,0xdb,0x34,0xa9,0x2a,0x10,0x7c,0xdf,0x95,0x59,0x76,0x62,0xaa,0x56,0xb6,0x83,0xa7,0xa3,0xb1,0x2e,0xa1,0x2a,0xae,
+0x97,0x65,0x68,0x3c,0xb3,0xe5,0xe4,0x97,0xc9,0xdc,0x6b,0x25,0xc9,0x27,0xaf,0xcc,0x3d,0xeb,0x39,0xb3,0xa3,0x41,0xbe,0x67,0xfa,0x40,0xdb,0xc2,0x9c,0xee,0x2,0xaf,
+0x4f,0x1f,0xfc,0x4b,0xec,0x4b,0x8f,0xf5,0x9b,0xc5,0x6f,0x18,0x5a,0x3a,0x11,0x3b,0x3b,0x15,0xb7,0x1,0x1c,0x41,0x53,0x68,0xcb,0x1f,0xbd,0x4c,0x7e,0xb1,0x95,0x1,
+0x87,0x39,0xc3,0xa,0xc3,0x93,0x5b,0x94,0xec,0x59,0xb7,0x39,0x91,0x41,0xad,0x79,0xe4,0xb8,0x1a,0x7b,0xf9,0xa,0xac,0xa0,0xfc,0xdf,0x36,0x38,0xac,0x65,0x15,0x7f,
+0x78,0x69,0x24,0xcc,0x53,0x96,0x95,0xb1,0xbb,0xa0,0xc6,0xea,0x14,0x8e,0xa7,0x9e,0x29,0xf5,0xd0,0x7c,0xdd,0x86,0x2f,0x28,0x3b,0x53,0x88,0x18,0xfe,0x35,0x39,0xe8,
+0xd5,0xa6,0xac,0x1f,0x76,0x26,0x7b,0xa8,0x60,0x7a,0x7d,0xea,0x70,0xde,0x83,0xd,0xb9,0x94,0xf5,0x1b,0xa9,0x49,0xdf,0xe2,0x34,0x56,0x11,0x7e,0x62,0x1,0x4,0x52,
+0xf4,0x6e,0x17,0xfa,0x66,0xa3,0x94,0x96,0xf5,0x1b,0x18,0x6d,0xb8,0xf9,0xf3,0x49,0x23,0x2a,0x77,0xc9,0xf7,0xa6,0xcc,0xc6,0xee,0x38,0xfe,0x1c,0x50,0xc7,0xe6,0xcf,
+0x14,0xbe,0x12,0x84,0x72,0xa7,0xa2,0xe0,0x7d,0x69,0xb9,0x2b,0x8c,0xfe,0x75,0x7c,0xae,0xd6,0x1b,0x63,0x9,0xe4,0x93,0x9e,0x69,0x8c,0x4f,0xfb,0x7,0xe9,0xd2,0x8b,
+0xd,0x58,0xf,0x50,0x46,0x30,0x7a,0x8a,0xaf,0x31,0xc6,0x77,0x14,0xdb,0x9f,0xc7,0x8a,0x73,0xd4,0xa5,0x63,0x46,0xcf,0xe6,0x1f,0xdc,0xda,0x71,0x5a,0x3c,0x60,0x57,
+0x1c,0xe1,0x66,0x74,0x5c,0x82,0x7f,0xf7,0x33,0xff,0x0,0x3,0xc5,0x66,0x5e,0x48,0x7,0xdc,0xd,0xd3,0x7,0x9a,0xb8,0x58,0xcc,0xc1,0xb8,0x7d,0xe8,0xf9,0x5c,0xf,
+0x71,0xd6,0xbd,0xf,0x41,0xf0,0x6d,0xbe,0xb1,0xa3,0xda,0x5f,0x5e,0xdf,0x6b,0x17,0xd3,0x5c,0x47,0xbd,0xbc,0xa9,0x32,0x7,0x35,0xdb,0x37,0x28,0x47,0xdd,0x39,0x6a,
+0x3b,0x17,0x66,0xf8,0x75,0xa3,0xa2,0x65,0x74,0x9d,0x62,0x43,0xfe,0xdc,0xd4,0xc8,0x7c,0x23,0xe1,0xbf,0x2c,0xf,0xec,0x49,0x59,0xff,0x0,0xda,0xbb,0x6a,0xe3,0xe6,
+0xaf,0x7d,0x65,0xf8,0x13,0xed,0xae,0x3f,0xfe,0x11,0x3f,0xc,0xa9,0xdc,0xb6,0x9f,0x67,0x6e,0xc6,0x2d,0x53,0x6d,0x3e,0x1d,0x2f,0x54,0xb4,0x6d,0x9a,0x16,0xbc,0x9b,
+0x3b,0xa5,0xf3,0x25,0xc9,0xa5,0xed,0x79,0xbe,0x37,0x71,0x3d,0x77,0x43,0xc5,0xc7,0x8d,0x61,0x5c,0x2c,0x1a,0x75,0xf4,0x67,0xb4,0xd,0x2c,0x55,0x8f,0xe2,0x8,0xf5,
+0xd,0x47,0xf7,0xb7,0xfe,0x11,0x7b,0x7b,0x85,0x1b,0x45,0xc4,0x77,0x60,0x8a,0xbb,0x47,0xe2,0xe6,0xb0,0x46,0x50,0xe6,0xf7,0x4e,0x58,0xe2,0x19,0xc,0x7b,0xc8,0x27,
+0xb7,0xce,0x6b,0xb7,0xf0,0xfe,0xab,0x74,0x96,0x82,0xda,0xde,0x67,0xdb,0x1a,0xa1,0xdb,0x26,0x79,0xcd,0x76,0xd5,0x8f,0xb4,0xd4,0x75,0x2e,0x91,0x72,0x12,0xa8,0xbe,
+0x5c,0xa7,0x6c,0x83,0xd3,0xd2,0xb9,0xad,0x42,0x1c,0x36,0xc0,0x30,0x7,0xcd,0x19,0xf5,0xf5,0xac,0x15,0xd1,0x9d,0x37,0x1d,0xd9,0x84,0x3,0x23,0xed,0xd,0x11,0x5d,
+0xc7,0x9c,0x93,0xc5,0x3e,0x37,0x56,0x64,0x2a,0x1f,0xcb,0x7e,0xaf,0xb7,0x85,0xe2,0xba,0xd,0xa2,0xee,0x58,0x4d,0xbb,0xe2,0x9,0xf2,0x81,0xff,0x0,0x3d,0xfb,0x9a,
+0xd4,0x37,0x5b,0x14,0x32,0x28,0x93,0x1f,0xc2,0xa6,0xb2,0x6b,0xb8,0xa4,0xa2,0xcd,0x2b,0x75,0xf3,0x54,0xfc,0xbf,0x85,0x40,0xf6,0xd2,0x42,0xfe,0x62,0xaa,0x79,0x7f,
+0x95,0x28,0x99,0x4a,0xc5,0x4b,0xcf,0x99,0xc3,0x39,0xe9,0xfa,0xd5,0x37,0x7c,0x30,0x9,0x80,0xe,0x7a,0x83,0x8a,0x1c,0x58,0x40,0xb5,0x73,0xb8,0xe9,0xf0,0x4e,0x4f,
+0xca,0x39,0xda,0xf9,0xcd,0x67,0xcb,0x82,0xf9,0x5c,0xec,0xc8,0x39,0xa6,0x95,0x91,0xad,0xd3,0x13,0x6e,0x62,0x3,0x63,0x3,0xc9,0xe0,0x72,0x6b,0x4b,0x50,0x59,0x5b,
+0x47,0xb1,0x99,0xd5,0xa3,0xb7,0x5e,0x57,0x71,0xe4,0xee,0x3,0x15,0x54,0xaa,0x34,0x44,0xa0,0x8a,0x4,0x26,0x15,0x46,0xcc,0x2f,0xaa,0xf4,0x34,0x36,0xd5,0x6d,0xbf,
+0xba,0xfe,0xf6,0xe0,0x31,0x51,0x12,0xae,0xb6,0x44,0xd1,0xb0,0x49,0x10,0x9f,0x5e,0xb9,0xad,0x79,0xc,0xf0,0x68,0xc1,0xd1,0xad,0xde,0x33,0x9c,0x8f,0x98,0xbf,0x26,
+0xa6,0x5e,0x66,0x90,0x69,0x98,0xbb,0x43,0xa8,0x66,0xcb,0x7a,0x52,0xf,0x97,0xee,0x8e,0x33,0xf7,0x7d,0x2a,0xa3,0xef,0x20,0x7d,0x85,0x5,0x77,0x6e,0x73,0xb7,0x8c,
+0x7a,0x8a,0x31,0x85,0xf6,0xdd,0x9c,0xd6,0x7f,0xb,0x1b,0xd8,0x50,0xd9,0x7,0xfd,0x58,0xc7,0xf1,0x6d,0xe6,0x85,0x1c,0x10,0xbd,0x49,0xcd,0x16,0xf7,0x89,0xdb,0x41,
+0xc7,0x3c,0xe7,0xff,0x0,0xd5,0x4d,0xcf,0x6e,0x4d,0x1d,0x6e,0x4d,0xfa,0xb,0x9e,0x57,0x93,0x8f,0x4a,0x6b,0xbf,0x3c,0x50,0xf5,0x63,0x5a,0x3,0xfc,0x83,0x24,0xe3,
+0xbd,0x47,0x83,0xb8,0x29,0xe9,0xeb,0x4f,0xc9,0x8e,0x2c,0xe,0xe0,0xc3,0xe5,0x42,0x3b,0xee,0xa6,0xee,0x4,0x6d,0x7f,0xad,0x1a,0xf4,0x13,0xde,0xe8,0x43,0x8e,0x72,
+0xff,0x0,0x86,0x3a,0xd3,0x4f,0xdd,0x20,0x74,0x61,0x83,0x55,0xa8,0xad,0xcc,0x44,0xe3,0x3b,0x40,0xec,0x73,0x50,0xcf,0xc9,0x8,0x31,0x9e,0xbf,0x4a,0x7e,0x46,0xc9,
+0xea,0x69,0xd9,0xff,0x0,0x3,0x7c,0xa3,0x9c,0x38,0xf5,0x38,0xeb,0x57,0xba,0x3,0x5c,0x8d,0x6a,0x6d,0x27,0xa1,0x4e,0x66,0xcb,0x93,0xda,0xb2,0xaf,0xa4,0xf9,0x1b,
+0xe6,0xda,0x7b,0x37,0xf4,0xad,0xe3,0x4d,0x5c,0xca,0xe6,0x53,0xfe,0x3f,0x8d,0x74,0x5e,0x13,0xd3,0xa4,0xd6,0x92,0x6b,0x77,0xd6,0xef,0xad,0xa1,0xb5,0xc6,0x20,0x81,
+0x49,0xae,0x89,0xcb,0x95,0x5d,0x23,0x39,0x6a,0x8e,0xbc,0x7c,0x3a,0xb5,0x65,0xfd,0xe4,0xde,0x22,0x94,0x1a,0x82,0xeb,0xe1,0xd6,0x9d,0x10,0xdd,0x16,0x9d,0xab,0xe3,
+0xd7,0x77,0x35,0xcf,0x2a,0xb5,0x64,0x60,0xaa,0xdb,0xb1,0x40,0x78,0x37,0x44,0x84,0x66,0xe2,0xc7,0x52,0xc7,0xfb,0x53,0xed,0xab,0x50,0xf8,0x33,0x40,0x7f,0xf9,0x84,
+0x6a,0x3f,0xf8,0x11,0x59,0xf3,0xd4,0xfe,0x63,0x4f,0x6e,0x58,0xff,0x0,0x84,0x23,0x4d,0x55,0xfd,0xcd,0xae,0xb7,0xf,0xa7,0x97,0x73,0x51,0xcb,0xe1,0x8d,0x4e,0xca,
+0x16,0x36,0xba,0xb6,0xae,0x96,0xb9,0xcf,0x97,0x75,0x1e,0xe1,0x57,0xcf,0x75,0xfb,0xdd,0x7f,0x2,0x3d,0xaa,0xbe,0x96,0x39,0x9,0xd7,0x7b,0x27,0x24,0x7a,0x81,0xde,
+0xb4,0xb4,0x1b,0x9f,0xb2,0xdf,0x40,0xd0,0x9f,0xdc,0xfc,0xaa,0xca,0xdc,0xe7,0x3,0x9a,0xec,0xbf,0x61,0xcb,0x5d,0xce,0xb3,0x54,0x85,0x61,0xbc,0x86,0xfa,0x7,0x3e,
+0x46,0xcf,0x9f,0xe6,0xf9,0x5c,0x56,0x7e,0xad,0x6a,0x8d,0x87,0x5b,0x83,0x8c,0x96,0x4d,0x98,0xc1,0x26,0xa2,0x5a,0xbb,0x92,0xd7,0x63,0x95,0xd4,0x23,0x68,0x95,0xa7,
+0x8,0xdf,0x26,0x3a,0x76,0xf7,0xaa,0x91,0x32,0x17,0x64,0x59,0x87,0x51,0xf7,0x9e,0xb4,0xe4,0x5c,0xb7,0x66,0xca,0x5e,0xe9,0x61,0x67,0x6c,0xed,0x60,0xe0,0x7b,0x81,
+0x56,0xa3,0x93,0x1f,0xf2,0xd5,0x8a,0xfb,0xc,0x53,0xb4,0x2c,0x45,0xae,0x6c,0xd8,0xea,0x10,0xc0,0x80,0xb4,0x89,0x89,0x3e,0x5e,0x7d,0x73,0x5a,0x11,0xdd,0xc2,0xc0,
+0xf1,0xbb,0xf0,0x6,0xb2,0x6a,0xc6,0xe,0x2c,0xcf,0xbe,0xf2,0x37,0x79,0x91,0x23,0x82,0x4f,0x4c,0xfc,0xa2,0xb1,0xda,0x34,0xf3,0x2,0xa6,0xed,0xa0,0xf3,0xf9,0x54,
+0x5f,0xa9,0xa5,0x3f,0x32,0x6d,0xec,0xa8,0xa8,0x9,0x3b,0x79,0xfb,0xde,0xdc,0x55,0x2f,0x37,0x6b,0x30,0xde,0xc1,0x89,0x3b,0x73,0xc7,0x15,0x37,0xe8,0x38,0xea,0xc7,
+0x87,0xcc,0xaa,0x5b,0x92,0x33,0xfc,0x44,0x52,0xa2,0x2b,0x4b,0x94,0x88,0x2e,0x7a,0x9f,0x6a,0xa5,0x62,0x84,0x88,0xb1,0x20,0x92,0x40,0x3e,0xbc,0x9a,0x55,0x60,0xd8,
+0xde,0x8b,0x9e,0xd9,0xa7,0xcb,0xae,0x80,0xec,0xc1,0x9c,0x81,0xc1,0xca,0xec,0xdd,0x9c,0xd6,0xe4,0xdb,0xad,0xb4,0xe8,0xa7,0x46,0x26,0x23,0x8f,0x95,0x79,0x3f,0x5a,
+0x2a,0xa5,0x6d,0xa,0xa6,0x64,0x39,0x1d,0x4b,0xe4,0x63,0xd2,0x9a,0xec,0x0,0xfb,0xdc,0xfa,0x54,0x25,0xd8,0xd1,0x6a,0x29,0x3b,0x54,0xff,0x0,0x7b,0xf9,0xd1,0xbb,
+0x8e,0x73,0xe8,0x68,0xe5,0xee,0x66,0x1b,0xb1,0xc7,0x14,0x7f,0xe,0x3d,0x78,0xa4,0x85,0xd7,0x50,0x19,0x0,0x90,0xdc,0x1,0xf7,0x76,0xd0,0x77,0x21,0xc9,0x4,0x71,
+0xd2,0x92,0x92,0x2a,0x48,0x68,0x7f,0xde,0x6e,0x49,0x33,0x83,0x82,0x28,0x3f,0x7b,0xaf,0x7a,0x7a,0x5c,0x15,0xf7,0x13,0xbf,0x2,0x91,0x98,0xee,0x5f,0xaf,0x34,0x5d,
+0x5f,0x50,0x5d,0x85,0x24,0x90,0xc0,0x2f,0x46,0xeb,0xd6,0x98,0xa,0xee,0x7f,0x51,0xd7,0x14,0x9d,0xba,0xb,0xad,0x86,0x1e,0x3f,0x84,0x9f,0xad,0x1b,0xbf,0x53,0xdb,
+0xb5,0x69,0x11,0xb4,0xfa,0xc,0xc8,0xf9,0xba,0x9f,0xc2,0xa0,0x6d,0xcd,0x7e,0xbc,0x37,0x4f,0x99,0x7a,0x55,0x49,0xe,0x9e,0xaf,0x53,0x4e,0xd3,0xee,0x89,0x1b,0xe5,
+0x51,0xce,0x8,0xef,0x56,0x65,0x7e,0xe,0xd1,0x34,0x98,0xff,0x0,0x66,0xb8,0x56,0xac,0xe8,0x9c,0x6e,0x55,0x9c,0xed,0xce,0x37,0x9d,0xbe,0xd5,0x89,0xa9,0xca,0xac,
+0xca,0x80,0xfd,0xef,0xbe,0x31,0xf9,0x57,0x65,0x18,0xfb,0xc4,0x5b,0x42,0x8f,0x7e,0x73,0xed,0x53,0xe9,0xf2,0x4e,0xb7,0x8b,0x15,0xa5,0xfc,0xb6,0x5e,0x7b,0xac,0x72,
+0x48,0xae,0x57,0xbd,0x6f,0x57,0x62,0x2e,0x7a,0x5,0x97,0x81,0xed,0xe6,0x90,0x9b,0xbd,0x4b,0x56,0xd4,0x1f,0x9e,0x62,0xf9,0x7f,0x1a,0xbb,0x37,0xc3,0xeb,0x66,0xff,
+0x0,0x54,0xde,0x22,0x8b,0xfe,0x5,0xbe,0xb0,0x58,0x8a,0x87,0x23,0xa8,0xbc,0x8a,0xed,0xf0,0xee,0xd7,0x18,0x95,0x75,0xdb,0x8f,0xf7,0xf8,0x15,0x46,0xf7,0xc0,0xf1,
+0xc1,0x11,0x68,0xfe,0xdf,0x6a,0x8b,0xcb,0xee,0x93,0xf2,0xa8,0xf6,0xb3,0xbd,0xc7,0xed,0x7d,0xe,0x78,0xe9,0xd6,0x8,0x76,0x7f,0x6f,0x49,0x16,0xd3,0x86,0x1e,0x72,
+0x9a,0x92,0x2b,0x1d,0x21,0x97,0x29,0xaf,0x5c,0xcb,0x2e,0x78,0x4d,0xd5,0xba,0xaf,0x35,0xa9,0x56,0x6f,0x68,0x91,0x91,0x92,0x6,0x48,0x1d,0x73,0x50,0x33,0x0,0xc6,
+0x35,0x7d,0xa3,0x1f,0x23,0x37,0x1d,0xe8,0xf6,0x97,0x63,0x71,0x97,0x31,0xe8,0x1e,0xc,0xd5,0xac,0x6f,0x2d,0x9f,0x4b,0xd4,0xef,0x3e,0xc9,0xc3,0x6c,0x23,0x3,0xbd,
+0x55,0x96,0x74,0x8a,0xe6,0x5b,0x48,0xe6,0x69,0xa,0x3f,0xc8,0x76,0xe0,0xb5,0x2b,0x75,0x33,0x95,0xf6,0x31,0x6f,0x12,0x19,0x27,0x30,0x2,0xa,0x94,0xfd,0xe0,0xfa,
+0xd6,0xc,0xc6,0x28,0x97,0x68,0xd9,0x11,0xc0,0xa5,0xa9,0xa4,0x3b,0x12,0xae,0x22,0x6c,0x26,0x33,0xed,0x56,0x15,0xf2,0x79,0xfb,0xdc,0x91,0x55,0x23,0x47,0xa6,0xa8,
+0xd4,0xd2,0xf5,0x49,0xac,0xd4,0x1b,0x31,0x19,0x76,0xc4,0x52,0x31,0x8d,0x25,0xfa,0xd4,0xdf,0x6a,0x28,0x33,0x21,0xe4,0xfa,0xf1,0x4e,0x3c,0xa6,0xf,0x9b,0xa9,0x5a,
+0xe2,0xed,0x18,0xc,0xb8,0xdd,0xd3,0x1e,0x65,0x57,0x59,0x23,0x24,0xed,0x39,0x23,0xaf,0xf8,0x56,0x2d,0x3e,0x86,0xca,0x3a,0xc,0xb8,0x7c,0xc8,0x15,0x7b,0xe,0x73,
+0xde,0xa3,0x6f,0xba,0xbf,0xec,0xf7,0xad,0x39,0x74,0xd4,0x2f,0xca,0x22,0xb1,0x79,0x86,0xe7,0x1b,0x4e,0x4b,0x31,0x15,0x66,0xcd,0x44,0xc1,0xca,0x92,0xca,0xa3,0x39,
+0x2b,0x8a,0xd2,0x36,0x31,0x9f,0xbb,0xa9,0x5c,0x9f,0x97,0xeb,0x42,0xb6,0xdf,0xd6,0xa2,0x52,0xe8,0x69,0x6e,0x61,0x8,0xcb,0x6d,0x1,0x40,0x3c,0x1c,0x56,0xbb,0x5c,
+0x3a,0xe9,0xa8,0xce,0x9,0x8b,0xa2,0x2f,0xf2,0xac,0xde,0xba,0x17,0x13,0x34,0x90,0x5b,0x7e,0x36,0xc,0x63,0x4,0xd1,0xb8,0x71,0x8e,0x31,0xcf,0x5e,0xb5,0x77,0x1a,
+0xb8,0x13,0x93,0x90,0xdc,0x50,0xbc,0x9c,0xc,0x73,0xd4,0x9a,0x89,0x6c,0x2b,0x9,0xff,0x0,0x2d,0x10,0xb9,0x2b,0xcf,0x42,0xb9,0xed,0x4e,0xdd,0xf2,0xe7,0x8f,0xca,
+0xa7,0x99,0xbb,0xf,0x46,0x37,0x7a,0x77,0x3c,0xfd,0x28,0xce,0x54,0xe3,0x8f,0x5a,0x18,0x31,0xb,0x71,0xd7,0xa5,0xb,0xcb,0x8d,0xf9,0xc6,0x73,0xf2,0xd5,0x7b,0xab,
+0x51,0xc5,0x59,0x68,0x3f,0xef,0x1e,0x6,0x33,0xc5,0x43,0x2c,0xaa,0x8e,0x3c,0xc2,0x30,0x95,0x2b,0xcc,0x8f,0x51,0x9f,0x6a,0x80,0x10,0x7c,0xc5,0x2d,0xdb,0x6f,0x43,
+0x51,0x3d,0xdc,0x6c,0x3e,0xe4,0x8b,0xec,0xd8,0xab,0x51,0x65,0x72,0x11,0xb,0xad,0xff,0x0,0x32,0xb2,0xe2,0x9c,0x2e,0x51,0x72,0x5d,0xd1,0x78,0xcf,0xcb,0x57,0x3b,
+0xda,0xc4,0xeb,0x19,0x7,0xda,0x21,0xfb,0xca,0xcd,0xd8,0xf0,0xb4,0xc3,0x26,0xeb,0x9c,0x7f,0x4f,0x6a,0xc2,0x37,0xea,0x6d,0x4d,0x7b,0xc6,0xc5,0xb1,0x2,0xd5,0x72,
+0x4e,0x4f,0x27,0xeb,0x4a,0x64,0xae,0x75,0xa3,0x36,0xe8,0x52,0x9a,0x6c,0x24,0x9f,0xbc,0xc1,0xf3,0xe,0x1,0x1d,0x45,0x61,0xdc,0x37,0x99,0x73,0x23,0x1d,0xab,0x86,
+0xae,0xba,0x77,0x32,0x23,0xdc,0xb9,0xa6,0x21,0xc1,0xf9,0x72,0x36,0xf3,0xbb,0xde,0xb7,0xe8,0x2b,0x1d,0x76,0x91,0x63,0xa9,0x78,0x8e,0xc1,0xcd,0xdf,0x88,0xe6,0x58,
+0xe0,0x70,0x9e,0x4a,0x21,0x2d,0xd2,0xb7,0xe0,0xf0,0x35,0x92,0xc7,0x93,0x36,0xb9,0x20,0xfe,0xf0,0x3b,0x41,0xac,0x3d,0xb4,0x96,0x91,0x39,0xa7,0xca,0x9e,0x89,0xb,
+0x27,0x82,0x2d,0x47,0x6,0xff,0x0,0x5b,0x51,0x9f,0xba,0xd3,0xad,0x31,0x7c,0x3,0xa6,0xef,0xcc,0xbf,0xda,0xd7,0x23,0xfb,0x86,0x41,0x50,0xf1,0x35,0x1a,0xb1,0x1c,
+0xd6,0xe8,0x8b,0x1f,0xf0,0x89,0xe8,0x56,0x83,0xe6,0xd2,0x63,0x5f,0x7b,0xab,0x93,0x54,0xaf,0x62,0xf0,0xc4,0x4b,0xf3,0x1d,0x25,0x25,0xfe,0x11,0x6e,0x7e,0x6a,0x98,
+0x39,0xcb,0x4b,0x8e,0x52,0x96,0xe7,0x2d,0xf7,0x97,0xaf,0xca,0x6,0x4f,0xd2,0xab,0x5c,0x21,0x60,0x8,0xd9,0xcf,0x3,0x77,0x7a,0xdd,0xa7,0x7d,0xd,0x53,0xbc,0xb5,
+0x19,0xe,0xd8,0x26,0x32,0x47,0xf2,0x81,0xd1,0x76,0xe6,0xad,0x49,0x7f,0xe6,0x3f,0x9e,0x2d,0xe2,0x91,0xe1,0x60,0x10,0xe3,0xe,0x6a,0xa5,0x9,0x3d,0x4a,0x9d,0xbe,
+0xc9,0x66,0xed,0xe3,0xb9,0x1e,0x62,0xa1,0x51,0xbb,0x1d,0x6a,0xac,0x82,0x32,0xa1,0xb0,0x8e,0xc0,0x72,0x49,0xcd,0x3b,0x4b,0x94,0x9a,0x7b,0x82,0x15,0x76,0x5f,0x95,
+0xbe,0x6e,0x79,0xa7,0x11,0xf2,0xe0,0xb2,0x90,0x4f,0x3,0x1c,0x8a,0x1c,0x79,0x63,0xa9,0x53,0xdc,0x51,0x1c,0x6d,0xc3,0x63,0xe5,0xa9,0xbc,0xa8,0x55,0xe,0xc2,0x80,
+0xaf,0x3b,0x7d,0x68,0x81,0x32,0x98,0xdc,0xee,0x70,0xf,0x1f,0x4e,0x29,0x60,0x71,0x1d,0xc4,0x59,0x23,0x9d,0xc7,0x9e,0xed,0x55,0xcb,0x71,0x8f,0x9d,0x8c,0x93,0x33,
+0xb1,0x19,0xe9,0xc0,0xa8,0x9f,0x71,0xe8,0x5b,0x1f,0xa5,0x63,0x29,0x14,0x94,0x7a,0x0,0x19,0xe9,0x56,0xf4,0xc2,0x23,0xbd,0xc9,0x24,0x8e,0xea,0x7,0x35,0xb5,0x19,
+0x6b,0xa9,0x8c,0xa0,0x53,0x1f,0xea,0x95,0x5b,0x76,0xec,0x73,0x9a,0x7f,0x7c,0x97,0xc7,0xfb,0x3b,0x6b,0x39,0xa3,0x58,0x30,0xc3,0x49,0x21,0x58,0xf9,0xe7,0x0,0xd6,
+0xe9,0xba,0x92,0x2d,0x2e,0xca,0x26,0x8d,0x76,0xc2,0x14,0xe,0xbc,0xe0,0x56,0x4d,0x5,0x91,0x87,0x2a,0xa6,0xff,0x0,0xdd,0x95,0x5e,0x73,0x9c,0x52,0x8f,0x94,0xed,
+0x63,0xdf,0x39,0xad,0x1e,0xc5,0x73,0x5c,0x50,0x3e,0x52,0x71,0xfb,0xcd,0xa7,0x0,0xfa,0xd3,0x3e,0xfc,0x7f,0x31,0xc6,0x47,0x22,0xa6,0x3a,0xa0,0x1e,0x7,0x3f,0x2f,
+0x7a,0x43,0xd7,0x6e,0xf4,0x5f,0x62,0xd4,0xd8,0x9d,0x80,0x67,0xb8,0x4e,0x3a,0xed,0xa6,0xb3,0x0,0x3e,0x77,0xd8,0xbd,0x8f,0x35,0x1c,0xe2,0xea,0x47,0x3c,0x8d,0x12,
+0x8d,0x8d,0x82,0xde,0xd5,0x5c,0xdc,0x48,0x1b,0x86,0x7d,0xd8,0xc9,0x2a,0xa2,0xaa,0x9c,0x83,0x42,0x39,0x41,0x7e,0x5d,0x8b,0xf3,0xce,0xf3,0x4d,0xa,0xaa,0xbc,0x0,
+0x2a,0xde,0xda,0x1a,0xa1,0x7a,0x1e,0x7a,0xd1,0xc9,0x3c,0x86,0x7,0xae,0x18,0x62,0x93,0xd3,0x52,0x2d,0xdc,0x6e,0xde,0xc3,0x14,0xd2,0xa5,0x40,0xc8,0xc8,0xa9,0x52,
+0xbb,0xb0,0xf4,0x13,0x9,0xd7,0x6f,0x3f,0x5a,0x92,0x5,0x3e,0x6b,0x7a,0x8f,0xd2,0x89,0x69,0x12,0xa1,0xb9,0xb6,0x8,0x76,0xda,0x1f,0x1b,0x7b,0x1,0x49,0x33,0x1,
+0x93,0xfa,0xe3,0x15,0xca,0x8d,0x2a,0x19,0x37,0x2f,0xc3,0x7e,0x35,0x9b,0xc0,0x66,0x63,0xd0,0x9a,0xef,0x8e,0xc6,0x76,0x1a,0x36,0xfc,0xde,0x9d,0xbe,0xb4,0x99,0xe3,
+0xd7,0x8a,0xa7,0x70,0x68,0xd9,0x26,0xf3,0x4e,0x78,0x2e,0x6d,0x6f,0x1e,0xd6,0x1b,0xc5,0x8c,0x49,0x32,0x26,0x16,0x3c,0xd7,0x4f,0x6f,0xe1,0x1f,0xb5,0x10,0xf7,0x7a,
+0xe6,0xa5,0x7b,0xbb,0xe6,0x3e,0x42,0x9c,0x1e,0x6b,0x9f,0xda,0xdb,0x64,0x61,0x51,0xc7,0x72,0xe7,0xfc,0x20,0xda,0x30,0xe6,0x5d,0x3f,0x52,0xff,0x0,0x7a,0x4b,0x90,
+0xb9,0xa8,0x24,0xf0,0xc7,0x86,0xad,0xff,0x0,0xd6,0x99,0x21,0x3f,0xed,0x6a,0x2a,0x2b,0x2f,0x6b,0x5a,0xff,0x0,0x11,0x3e,0xd6,0xeb,0x62,0xa9,0xd1,0x3c,0x17,0x9f,
+0x9a,0xed,0x49,0xff,0x0,0xb0,0x9a,0xd0,0x74,0xaf,0x7,0xa2,0x7f,0xa3,0x3d,0xbb,0x4a,0x3f,0xe9,0xf7,0x79,0xa3,0xf7,0xdd,0x64,0x57,0xb4,0x96,0xdc,0xa7,0x3d,0xf7,
+0xd4,0xae,0xf5,0x8c,0xee,0xea,0x5f,0x6e,0x31,0xde,0x9b,0x95,0xf3,0xb7,0x6,0xce,0xe4,0xc7,0x23,0xde,0xba,0x3d,0xd,0xb9,0x48,0x70,0x72,0x3c,0xcd,0xa1,0x76,0xfc,
+0xdb,0x3f,0xbd,0x48,0x8b,0x92,0x72,0xc4,0x2d,0x69,0x26,0xee,0x40,0xc1,0x29,0x45,0x2c,0xcf,0xf2,0x8e,0x6b,0x52,0xdb,0x4e,0xbe,0x9f,0x1f,0x67,0xb6,0x67,0xff,0x0,
+0x6f,0xf8,0x6a,0x66,0xfd,0x9c,0x6f,0x33,0x49,0xc4,0xb6,0x34,0x1d,0x57,0x61,0x90,0xad,0xb2,0xaf,0x25,0x99,0xa5,0xc6,0x2a,0x98,0x58,0xd0,0xfc,0xcc,0xed,0xc6,0x43,
+0xc6,0x41,0x5a,0xca,0x18,0x85,0x5b,0xe0,0x30,0x4e,0xe2,0xf9,0xdb,0x77,0x2c,0x4d,0xc6,0x79,0xe2,0x9a,0x79,0x90,0xec,0x39,0xfc,0x31,0x55,0x14,0xee,0x4c,0x90,0xd6,
+0xfb,0xbb,0x77,0xe1,0xb7,0x7a,0x75,0xa9,0x90,0x49,0x6f,0xb2,0x71,0x2a,0xae,0xec,0x81,0xb1,0xf2,0xd4,0xdb,0xee,0x6a,0xb6,0xd4,0x8a,0x69,0xbe,0x57,0x77,0x67,0x6c,
+0x9c,0x93,0xde,0x96,0x42,0x77,0x67,0xcc,0xf9,0x7a,0x61,0xbf,0x9d,0x4c,0xaf,0xbb,0xf,0x85,0x91,0x9f,0x99,0xd7,0x1f,0x29,0x5c,0xe7,0xde,0x9d,0x80,0x4e,0xd9,0x0,
+0x23,0x6e,0xec,0xfb,0xfa,0x55,0xf9,0x8e,0xe2,0xa1,0xcb,0x6d,0x8b,0xe6,0xf6,0x3e,0xb5,0x2a,0xac,0x8f,0x1c,0x6f,0xb5,0x7,0xcf,0xfc,0x55,0x29,0xb6,0x4c,0xac,0x99,
+0x57,0xfd,0x74,0xc7,0x2b,0x86,0x4,0xe3,0x3d,0xab,0x72,0x77,0x93,0xc9,0x44,0x7c,0x34,0x40,0x63,0x77,0x1d,0x71,0x43,0x14,0xdd,0x99,0x9b,0x34,0xa7,0x7f,0xcb,0x81,
+0x81,0x80,0x3d,0x69,0x72,0xbb,0x80,0x6c,0x2f,0xcd,0xeb,0xd6,0xa1,0xc5,0x85,0x86,0x93,0xcf,0xde,0xcd,0x20,0x4,0xbf,0x14,0x27,0xcb,0xa1,0x57,0xd4,0x3,0xff,0x0,
+0x70,0x9f,0xc6,0x91,0x8e,0xe7,0xf4,0xcf,0x5a,0x56,0xb9,0x5f,0x6b,0x51,0x55,0xd7,0x6f,0x50,0x4f,0xa0,0xa3,0x79,0xec,0x3a,0x7b,0xd6,0x8e,0x93,0x8e,0xc2,0x68,0xab,
+0x7a,0x7f,0xd5,0x9c,0xf4,0xe7,0x9e,0x95,0x10,0x5c,0x64,0x63,0x92,0x7a,0x54,0x42,0xf6,0x2d,0x47,0x98,0x4d,0xc4,0xf3,0x95,0x1f,0x5a,0x4c,0xed,0xc7,0x27,0x76,0x7a,
+0x63,0x39,0xad,0x55,0xfa,0x13,0xf0,0x81,0x7e,0x7a,0x63,0x9a,0x50,0xf9,0xe4,0x63,0x6,0xb3,0x6,0xae,0xc0,0xe0,0x67,0x7,0x9e,0xf5,0x1b,0x11,0x90,0x41,0x4c,0x9e,
+0xbe,0xb5,0x77,0xbb,0xd0,0x14,0x6c,0x27,0xf1,0x7d,0x4d,0x2c,0x5b,0x4,0xf9,0x66,0x50,0xc5,0xc6,0x41,0xf4,0xa4,0xd7,0x39,0x4f,0xdd,0x7a,0x1b,0x16,0xec,0x4f,0x75,
+0x1d,0x3e,0xf5,0x36,0xef,0xbf,0xd7,0x15,0xcb,0x6f,0x7a,0xc6,0x8d,0x98,0xd7,0xc,0x4b,0x13,0xed,0xeb,0x55,0x9,0xcf,0x5e,0x2b,0xb6,0xcc,0x80,0x7,0x27,0xd2,0x91,
+0x88,0x1c,0xf3,0x45,0xd8,0x8e,0xcf,0x42,0xb9,0xf2,0x2f,0x64,0xd1,0xf5,0x24,0x42,0xb2,0x5,0x8e,0x15,0x93,0xa3,0xc6,0x7f,0x86,0xa3,0xbf,0xd3,0xb5,0xf,0xed,0xb8,
+0xb4,0xef,0xed,0xab,0xbb,0x7b,0x19,0x53,0xfd,0x14,0xc9,0xb8,0xfd,0x12,0xb0,0x5e,0xe3,0xd0,0xe6,0xf7,0x6e,0x69,0x45,0xe0,0xbb,0x16,0xff,0x0,0x8f,0xa6,0xd5,0xaf,
+0x5f,0x3d,0x7e,0xea,0xd5,0x93,0xe0,0xdd,0x11,0x32,0x5b,0x4b,0xba,0x4f,0xfa,0xed,0x77,0x80,0x2a,0x2a,0x54,0xab,0xbd,0xc9,0x8d,0x6e,0xc4,0xf,0xa6,0xf8,0x5e,0xcf,
+0xe5,0x95,0x34,0xa8,0xdb,0xfe,0x9a,0x5c,0x17,0x35,0x5a,0xe0,0x78,0x44,0x47,0x98,0xa4,0xd3,0x3c,0xcf,0xfa,0x67,0xe6,0xe6,0xae,0x1e,0xda,0x5b,0x7,0x3c,0x93,0xea,
+0x57,0x8a,0xda,0xc9,0xc6,0x27,0xb3,0x1b,0x81,0xcf,0x3d,0xe9,0xc7,0x45,0xb4,0x9a,0xf0,0x38,0x86,0xe3,0xca,0xf4,0x47,0x38,0x1c,0x57,0x2b,0xad,0x38,0x4b,0x46,0x69,
+0x29,0xda,0x57,0x20,0x9b,0x43,0x41,0x34,0xb1,0xa5,0xd4,0x51,0x44,0xcf,0xbb,0xf7,0x83,0x2c,0xbe,0xd5,0x4a,0xef,0x4c,0x6b,0x62,0x58,0xdd,0x5a,0x4e,0x8c,0x71,0xb6,
+0x2d,0xc0,0x2d,0x74,0xc6,0xab,0x76,0xb9,0xa7,0x36,0x86,0x7b,0xc6,0x1f,0x9d,0xbf,0x2f,0x3f,0x4a,0xe8,0x34,0x8d,0x6e,0x8,0xb4,0xd8,0xd2,0x49,0x13,0xef,0x31,0xc1,
+0xf4,0xad,0x6b,0xc3,0xda,0x47,0x94,0x24,0xc6,0x5d,0x5c,0x2e,0xa8,0x85,0xdf,0x55,0xb5,0x81,0x60,0x7c,0x79,0x43,0x7f,0xcd,0x9a,0xd9,0xd3,0xb4,0xb,0x1b,0x84,0x8c,
+0x24,0xad,0x3b,0xcb,0xcf,0xfa,0x3c,0xbf,0x28,0xae,0x17,0xcd,0x4d,0x72,0xa2,0x65,0x3e,0x58,0xec,0x72,0x59,0x65,0x92,0x5d,0xca,0x41,0xde,0xd8,0x1f,0x8d,0x6a,0xdb,
+0x68,0xda,0xa5,0xee,0x91,0x79,0xa9,0x5a,0x59,0x48,0xd6,0x36,0x65,0xfc,0xe9,0xd6,0x55,0x1b,0x76,0xd,0xc6,0xbd,0x38,0x2f,0x76,0xc4,0xc1,0x19,0xa3,0x63,0x2e,0x65,
+0xc8,0xc7,0x24,0xe,0x2a,0x68,0x9e,0xcd,0x6d,0xa7,0x6,0x29,0xd,0xcc,0xa3,0x16,0xdb,0x1f,0xe4,0x43,0xdc,0xd2,0xf7,0x16,0x92,0x2a,0xf2,0xb9,0x3,0x4c,0xbb,0x61,
+0xc8,0xdd,0x91,0x8c,0xed,0x3c,0x53,0xd8,0x87,0xdc,0xac,0xa3,0x9f,0x6f,0xc6,0xa5,0xc5,0x94,0xc4,0xcf,0xce,0x73,0x9e,0x7a,0x1a,0x50,0xf8,0xe6,0x97,0x92,0x1d,0x97,
+0x41,0xcb,0xb6,0x28,0xd3,0x67,0xcd,0x86,0xc7,0xcd,0xd4,0xd2,0xbf,0x96,0x96,0xff,0x0,0xf0,0x3c,0xc,0x7d,0x2a,0xa2,0xac,0xc1,0xc4,0xa8,0x1b,0x7c,0xfd,0xf8,0x6e,
+0x2b,0x4b,0xcd,0xf9,0x56,0x2,0x3e,0x46,0xf9,0x89,0x53,0x8c,0x52,0x97,0xc4,0x66,0xd5,0x8a,0xa8,0x18,0xa9,0xc9,0x1b,0xb7,0x11,0xf2,0xd2,0xfc,0xbf,0x73,0x6f,0x5e,
+0xd4,0x9e,0xe5,0xb7,0x71,0x77,0x2e,0xe2,0x3b,0xf5,0xc7,0x4c,0x52,0x82,0xa0,0xe7,0xf8,0x87,0x4c,0xe6,0xa6,0xd2,0x10,0x2,0x30,0xb9,0x3b,0x47,0x4c,0x62,0x93,0x77,
+0x5c,0x60,0xe7,0xd4,0x55,0xf2,0x3b,0x8f,0xec,0x81,0x7e,0x7e,0x6e,0x69,0xe,0xdc,0x67,0xe6,0xdd,0xed,0x59,0x3e,0x6b,0x8e,0x3a,0x22,0x94,0xce,0x24,0x77,0x52,0x9,
+0x1f,0x74,0x77,0xa0,0xc9,0x93,0xc7,0x5a,0xa8,0xa9,0x9,0xcb,0xa8,0xfd,0xc7,0xcb,0xf4,0xfa,0x54,0x78,0xf9,0x69,0x5e,0xdb,0xf,0x71,0xbf,0xc5,0xc8,0xcf,0xe1,0x4a,
+0x14,0x2f,0x46,0xcf,0xfc,0x7,0x18,0xad,0x12,0xb2,0x29,0x24,0x2e,0x72,0x7e,0xf0,0xa8,0xf7,0x87,0x45,0xf4,0x3d,0x28,0x82,0x1a,0x42,0x8c,0x63,0x9a,0x6a,0x94,0xdd,
+0x90,0x3e,0xf7,0x4a,0x4a,0xf7,0x16,0xec,0xd7,0x8c,0x84,0x63,0xf2,0xf3,0xeb,0x4b,0x73,0x8d,0x9b,0x83,0x72,0x39,0xfa,0xd6,0x5b,0x32,0xe4,0x63,0xcd,0xb7,0xf7,0x83,
+0xf4,0x3d,0xaa,0xa7,0xcb,0x8a,0xdf,0x9d,0x93,0xa0,0x9e,0xbe,0xd4,0xb8,0x57,0xc2,0x3,0x96,0x27,0x3,0xeb,0x54,0xf6,0x15,0x8e,0xc3,0x4e,0x8f,0x4f,0xd6,0xed,0x76,
+0xdc,0x60,0x5c,0x8f,0x97,0xe4,0x24,0x49,0x11,0xe9,0xba,0xa3,0x92,0xe1,0xec,0xa2,0x8b,0x4c,0xf1,0x1c,0x58,0x86,0x36,0x2,0xd7,0x51,0x89,0x79,0x4f,0x7a,0xe7,0x57,
+0xd8,0xcb,0x72,0xbe,0x9b,0xa4,0x4b,0xaa,0x48,0xe8,0xde,0x24,0x93,0x70,0xf9,0x91,0x54,0x3b,0x6f,0x4f,0x5a,0xd0,0x87,0xc1,0xb6,0x3,0x9b,0x8b,0xab,0xcb,0xaf,0xa2,
+0xed,0x14,0x7b,0x59,0x7c,0x36,0x13,0x71,0x89,0x79,0x3c,0x1d,0xa5,0x63,0x70,0xd2,0xaf,0x59,0x71,0xd5,0xa6,0x34,0xc7,0xd0,0xf4,0x9b,0x44,0x6f,0xf4,0x8,0xe3,0xff,
+0x0,0x69,0xe4,0xcb,0xa,0xcb,0xda,0x55,0x8e,0xb7,0x27,0xda,0xf3,0x68,0x62,0xbe,0xa0,0x8a,0x9f,0x34,0x5,0xfe,0x95,0x9d,0x71,0x32,0x4f,0x27,0xc9,0x6e,0x61,0xda,
+0xc4,0x36,0x25,0x3c,0xf3,0x55,0x4a,0x95,0xfd,0xe3,0x6f,0x67,0x6d,0x51,0x1c,0xad,0xb5,0x33,0xe6,0x32,0xc6,0x3a,0x63,0x38,0xa8,0x63,0xeb,0x9e,0x9b,0xfb,0xf6,0xae,
+0xbb,0x5b,0x53,0x35,0xcd,0x62,0x41,0x10,0x2d,0xb8,0x32,0xf1,0xdc,0x54,0xb6,0x32,0xc6,0xd7,0x2a,0x6e,0x51,0x66,0x8c,0x3a,0x8f,0x28,0xaf,0x5a,0x57,0x72,0x8b,0x68,
+0xa5,0xae,0xa6,0xbd,0xaf,0xf6,0x75,0xcd,0xfc,0xdf,0xe8,0x10,0xdb,0x5a,0xaa,0xfc,0xca,0x73,0x9d,0xf5,0x51,0x74,0x76,0xba,0xd4,0x27,0x5d,0x35,0x36,0xdb,0x47,0x27,
+0x95,0x14,0xdb,0xf8,0xe3,0x9a,0xe6,0x52,0xe5,0xbf,0x30,0x9c,0xac,0x88,0xa5,0xb1,0xfe,0xc9,0xba,0x16,0x97,0x12,0xc5,0xfb,0xc8,0xf7,0x2,0x99,0xe9,0x56,0xed,0xb5,
+0x1b,0xa4,0xd0,0x6e,0xb4,0xcf,0xb6,0x5c,0xc3,0x5,0xc1,0x3f,0xba,0x7,0xf7,0x6d,0x9c,0x66,0xba,0x20,0xf9,0xec,0xc8,0x6c,0xa7,0xbc,0x6f,0x60,0x4f,0xfc,0x7,0x1d,
+0x69,0x3,0x3a,0x11,0xe4,0xac,0x38,0xf7,0xcd,0x39,0xab,0x9a,0xc5,0x73,0xc,0xf3,0x37,0x11,0xf2,0x20,0x61,0xef,0xc5,0x29,0x3f,0x28,0xcf,0x67,0xf,0x9f,0x43,0x55,
+0xa8,0xf9,0x47,0xa3,0x95,0x75,0x9,0xf3,0xed,0xe7,0x34,0xc1,0xb8,0xf6,0xf9,0x54,0xf0,0x7d,0x6a,0x62,0xda,0x33,0xe6,0x4b,0x52,0x55,0x60,0xca,0x32,0x71,0xb1,0xc3,
+0x54,0x52,0x33,0x63,0x76,0x6,0x3b,0x64,0x1f,0xce,0xa8,0xa7,0xa9,0x10,0x76,0xee,0x10,0xb1,0xe8,0x3a,0xe6,0xaf,0x34,0xe5,0xa7,0x80,0x9d,0x98,0x23,0x8c,0xf,0x96,
+0xa2,0x4b,0xa8,0x5b,0xb9,0x2,0x7c,0xdb,0xce,0xf0,0x5b,0xcc,0x6a,0x73,0x76,0xdb,0x59,0x34,0xdb,0xd4,0x3c,0xc7,0x6e,0x39,0xc6,0x78,0xa4,0x62,0x76,0xe7,0xd2,0xb4,
+0x4e,0xdb,0xc,0x6b,0x92,0xdc,0x76,0x6,0x9d,0xbf,0x8c,0x81,0xf2,0xd1,0xef,0x75,0x15,0xef,0xa0,0x99,0x21,0x8f,0x61,0xda,0xa3,0x3e,0x66,0x33,0x91,0xf5,0x1d,0x68,
+0x5b,0xdd,0x8f,0x4e,0x84,0x3c,0xe3,0xaa,0x81,0xb8,0x9f,0x7e,0x69,0xa4,0xe3,0x77,0xb9,0xf9,0x69,0x6b,0x26,0x55,0xb4,0x13,0x38,0x1d,0x7e,0x5c,0xe7,0x9e,0xd4,0x67,
+0x23,0x90,0x9c,0x7c,0xd9,0x3,0x9a,0xb4,0x1a,0x6,0x71,0x82,0x5b,0xdf,0xd6,0x8d,0xdb,0x63,0x3c,0xc7,0xc7,0x76,0xa9,0xbc,0x98,0xbe,0x11,0x80,0xe3,0xd1,0x8f,0xe5,
+0x4e,0xfa,0x7e,0x74,0xd8,0x73,0xc,0x27,0xe6,0xed,0xed,0x4e,0xb5,0x2c,0x6e,0x50,0xed,0x1c,0x1a,0x8b,0xbe,0xa1,0x15,0xef,0x17,0x84,0x84,0x65,0xbb,0x54,0xf2,0xe,
+0x3e,0xfa,0x28,0xf5,0x35,0x8f,0x31,0xb9,0x99,0x77,0xee,0x92,0xa7,0xaf,0x18,0xac,0xf6,0x3e,0xb8,0x1e,0xc2,0xba,0x23,0x29,0x19,0xb5,0xad,0x84,0xf7,0xab,0x36,0x2e,
+0xf1,0xde,0xc0,0xf1,0x22,0xb4,0x9e,0x6f,0xc8,0xa4,0x70,0xde,0xd5,0xa4,0xda,0xe5,0x25,0xa3,0x4a,0xf9,0xe6,0x86,0xe7,0x7e,0xa3,0x69,0x79,0x65,0x2e,0x36,0x6f,0xe8,
+0xa3,0x15,0x6e,0xcf,0x5b,0x1b,0xbe,0xcd,0x34,0xd6,0x57,0x71,0x36,0x77,0xbc,0xf6,0xe7,0xa7,0x71,0x5c,0xd6,0xec,0x66,0xfd,0xe2,0x29,0xb4,0x89,0xf4,0xf3,0xfd,0xa7,
+0xa3,0xdd,0x44,0xfe,0x57,0xcf,0xb1,0x43,0x6e,0x51,0xde,0xad,0x5b,0x47,0xad,0x6a,0x76,0x69,0x74,0xde,0x24,0x9,0x19,0xe8,0x14,0xb8,0x20,0xd1,0x7e,0xb6,0x1b,0x70,
+0xb6,0xa3,0x66,0xf0,0xb9,0x9b,0x73,0x5c,0xeb,0x82,0x46,0xeb,0xfe,0xad,0xd8,0x9a,0x7a,0xf8,0x5e,0xc2,0x3f,0x99,0x6e,0x6e,0x64,0x6f,0x52,0x0,0x14,0xe3,0x8a,0x93,
+0xdd,0x10,0xa5,0xd8,0xc4,0x8f,0x1b,0xcc,0x78,0x28,0x9,0xfe,0x13,0xc9,0xe7,0xad,0x4a,0xcc,0xbb,0xbf,0x78,0xfc,0xe3,0xb,0xcf,0xcd,0x5a,0x73,0xff,0x0,0x21,0x7c,
+0xd2,0x21,0x9b,0x69,0x7,0x7a,0xb9,0xf9,0xb7,0x66,0x35,0xe3,0x35,0x19,0xf9,0x55,0x76,0x38,0xf3,0x1c,0x67,0x95,0xfd,0x2a,0xee,0x56,0xb2,0x46,0x9c,0x32,0xe9,0x91,
+0xdb,0x1d,0xed,0x70,0x19,0x72,0xbb,0x65,0xc6,0x6b,0x2c,0x3c,0x3b,0x3e,0x56,0xde,0xa3,0x7,0x85,0xa5,0x9,0x48,0x50,0xe6,0x4f,0x52,0xd5,0xb2,0x81,0x1,0x6c,0x5,
+0xfd,0xe6,0x38,0x4,0xe4,0xfa,0xd6,0xa4,0x3a,0xed,0xdd,0x94,0x9,0x13,0x41,0xc,0xe9,0x18,0xc0,0x42,0xa5,0x2b,0x9a,0x70,0xe7,0x76,0xa,0x90,0x45,0x61,0xf6,0xdd,
+0x7b,0x53,0xb8,0x98,0x47,0x12,0x90,0x6,0xc4,0x3f,0x2a,0xa2,0xe7,0x0,0x55,0x6b,0x6d,0xb2,0x4b,0x2f,0x97,0xb3,0x29,0xc6,0x37,0x56,0xd4,0xe5,0x14,0xac,0x8c,0xe2,
+0xad,0xa2,0x24,0x91,0xb1,0x23,0x2f,0x5d,0xa7,0xf5,0xa8,0xbe,0x60,0x84,0xab,0xb0,0x3f,0xec,0xb7,0x26,0xae,0xc,0x76,0x1f,0x9f,0x30,0x9c,0x2e,0x7d,0x39,0xe9,0x4d,
+0x3c,0x3b,0x28,0x65,0x6c,0x73,0xf2,0x9e,0x94,0x92,0x6f,0x70,0x4c,0x52,0xdf,0x3e,0x39,0x3b,0x9b,0x14,0xec,0x15,0xe0,0x3f,0x1d,0x76,0x9a,0x39,0xb9,0x9,0x69,0x58,
+0x7a,0x15,0xa,0xd9,0x40,0x73,0xed,0x55,0xae,0x32,0xf2,0x2e,0xd4,0x51,0x8f,0xd6,0xaf,0x76,0x34,0xec,0x24,0x52,0xb2,0x95,0xfe,0x60,0xd4,0xfb,0x95,0x7e,0x6e,0xa3,
+0xb0,0xcf,0x4a,0x84,0xb5,0x66,0xbd,0x5,0x4d,0xed,0x96,0x22,0x3f,0x52,0x54,0x74,0xa5,0xcf,0x39,0xe3,0x1e,0xf4,0x7c,0x44,0xa4,0x20,0xc3,0x91,0xf3,0x34,0x79,0x6d,
+0xb9,0xdb,0x46,0xe3,0xde,0xa5,0xa1,0xf5,0xd,0xfc,0x72,0xf,0x5d,0x83,0xda,0x93,0xb0,0xfb,0xd8,0x3,0x85,0x1d,0x2b,0x49,0x5d,0x5,0xbb,0xa,0x49,0x3d,0xc6,0x2a,
+0xb4,0xc7,0x24,0x10,0x6,0xdf,0x5a,0x81,0xad,0x86,0xab,0xe1,0x7d,0xfd,0xd,0x30,0xca,0xdb,0x91,0x77,0xf4,0xcf,0xf0,0xd6,0x91,0x89,0x20,0x1c,0xb6,0x79,0xdd,0x48,
+0xa4,0xf3,0x92,0x29,0xbf,0x75,0xf,0x7d,0x3,0xa9,0xdb,0xeb,0x4c,0xf,0x95,0x2,0x4c,0xe,0x39,0xcd,0x67,0x19,0x36,0x8b,0xb1,0x2e,0xed,0xad,0xef,0x4d,0x1b,0xbf,
+0xde,0xaa,0x33,0x19,0x9f,0xba,0x79,0xf6,0xa9,0x93,0xe6,0xea,0x3f,0x5a,0x96,0xec,0x6b,0x14,0xae,0x5b,0x4c,0x77,0xa9,0xdb,0xe6,0x5e,0xa0,0xd7,0x3b,0x9e,0xa5,0x14,
+0x2f,0x5b,0x25,0xcf,0x41,0xda,0xb3,0x78,0xe7,0x8e,0xb5,0xd5,0xd,0x88,0xb8,0x67,0x19,0xf4,0x14,0x84,0x6d,0x6f,0xee,0x9e,0xbe,0xf4,0xee,0x89,0x77,0x3a,0xdd,0x37,
+0xc5,0xd1,0x8,0x52,0x3b,0xf5,0xb8,0x72,0x38,0x27,0x68,0x70,0x69,0x2f,0x2e,0x3c,0x2d,0xa9,0x30,0x79,0x27,0x78,0x64,0xff,0x0,0xae,0x45,0x5,0x73,0x4a,0x9c,0xa3,
+0x3b,0xc4,0xc1,0x42,0x71,0x29,0x87,0xfe,0xc7,0x98,0xcd,0xa6,0x6a,0x16,0xf7,0x76,0xbe,0x67,0x98,0x10,0x37,0xef,0x6,0x2a,0x29,0x35,0x8d,0x8c,0xd7,0x56,0xd,0xc,
+0x52,0x4f,0xcc,0xf0,0xb2,0xe5,0x77,0x7a,0xd6,0xb1,0x8d,0xd9,0x7c,0x97,0xd4,0x9f,0xed,0x9a,0xd3,0x7f,0xaa,0xba,0xb4,0x52,0xe,0xdc,0xa2,0xd1,0x2f,0xf6,0xbc,0xb1,
+0xe6,0xe3,0x53,0xff,0x0,0x80,0xed,0xc5,0x4c,0xa3,0x15,0xb2,0x14,0x79,0x11,0x96,0x72,0x26,0x56,0x69,0x11,0xb2,0xd8,0x9,0xfc,0x42,0x9e,0x25,0xfd,0xf4,0x67,0x8d,
+0xb9,0xff,0x0,0x59,0xe5,0xf4,0xcd,0x5b,0xdf,0x42,0xd2,0xe6,0x1b,0x2b,0x3,0xd1,0xf7,0xfc,0xd9,0x2c,0x57,0x15,0x35,0xac,0xf1,0xc0,0xec,0xf2,0x45,0xe6,0x74,0xc7,
+0xc8,0xd,0x17,0x6c,0x5c,0xa4,0x7,0xa8,0x56,0x7f,0x73,0xb5,0x79,0xad,0x8d,0x5e,0x54,0x9f,0x49,0x46,0x80,0xc8,0x30,0x77,0x6c,0xdb,0x8a,0xca,0xb6,0x8d,0x21,0x34,
+0xc8,0x6e,0x9b,0xcb,0xdb,0xfb,0xe2,0x15,0xdf,0x3c,0xc,0x16,0x35,0x74,0x32,0x6a,0x7a,0xd8,0x65,0x9d,0xd,0xa5,0xa6,0x24,0x60,0xc3,0x70,0xdd,0x4e,0x2e,0x56,0xd5,
+0x3,0xf8,0x6e,0x3f,0x49,0x6d,0x9e,0x21,0xd4,0xd1,0x53,0x61,0xfe,0xee,0xdc,0x63,0xe6,0xad,0x4d,0x27,0xc2,0x37,0x7e,0x22,0xd6,0xf5,0x24,0xb3,0x7b,0x34,0x58,0x11,
+0x25,0xc4,0xab,0x81,0x96,0xdd,0x8a,0xc9,0xcf,0x96,0xa5,0x89,0x8a,0xb9,0xc8,0xa5,0xc2,0xcc,0xc5,0xf6,0x28,0x4,0xf1,0xb7,0xe5,0x2,0x94,0x9f,0x9b,0x71,0x9,0x9f,
+0xe5,0x5d,0x57,0x56,0x2e,0x28,0x37,0x80,0xb9,0xe4,0x8f,0xa6,0x73,0x4b,0xb3,0x31,0xff,0x0,0x7,0xde,0xc1,0x51,0xde,0xa9,0xbb,0x6c,0x2e,0x51,0xd1,0x12,0xeb,0x32,
+0xd,0x9e,0x67,0x50,0xa2,0x3e,0x45,0x3a,0xdf,0x6c,0x86,0x45,0x39,0x1d,0x3b,0x74,0xa3,0x99,0x44,0x72,0x89,0x16,0xf0,0xca,0x85,0xff,0x0,0xbd,0xf7,0x42,0xd3,0x5c,
+0x8c,0xd5,0x5c,0x6e,0xd6,0x10,0x2e,0x1f,0xef,0xe3,0xb6,0xd,0x2a,0xcc,0xdf,0x21,0x2c,0x1,0x39,0xce,0xda,0x57,0xd2,0xe0,0xbb,0x82,0xe4,0xed,0x19,0xc8,0x53,0x9a,
+0x91,0xb8,0xa,0x58,0xf4,0x3c,0xf1,0x4a,0x6f,0xb1,0x57,0x6,0xce,0x71,0xc7,0x14,0x83,0xd7,0x76,0x47,0xa6,0x2a,0x1b,0xbe,0x82,0xb6,0xb7,0x3,0x20,0xdc,0x54,0x1f,
+0xbb,0x48,0x1f,0xef,0xee,0x3c,0x6e,0xf9,0x6a,0xb5,0xe5,0x2e,0xc1,0xe6,0x2e,0x79,0x6e,0x3d,0x71,0x55,0xb2,0x64,0x6d,0xf2,0x5,0x2f,0x8e,0xc2,0x9c,0x51,0x1c,0xa3,
+0x9,0xf9,0xba,0xf7,0xc5,0x3f,0x8c,0x8a,0x6f,0x7b,0x97,0x6e,0xc2,0xfd,0xd4,0xfb,0xbc,0x96,0xce,0x69,0xbd,0x8d,0x1c,0xe9,0x93,0xb6,0xa3,0x78,0xcd,0x18,0x63,0xf7,
+0x55,0x4f,0x7e,0xd4,0xae,0x57,0xa8,0xe5,0xcf,0xdc,0x7,0x76,0xe3,0xce,0x3b,0xd2,0x16,0xda,0x98,0xda,0x4f,0xcf,0xb8,0x10,0x7a,0x7b,0x51,0x6b,0x92,0xd0,0x9b,0xfa,
+0x67,0x1c,0xd5,0x85,0x3,0x68,0xc3,0x7e,0x62,0x94,0x9d,0x8b,0x8a,0xec,0x2f,0x98,0x3,0x95,0x3d,0xbd,0xaa,0xc0,0x3f,0x21,0x20,0xe0,0x7d,0x2a,0x1b,0xb0,0x35,0x72,
+0x95,0xd4,0x81,0x90,0xff,0x0,0x85,0x50,0xcf,0xb5,0x68,0xb4,0x33,0xd2,0xe1,0xd5,0x70,0x7e,0xed,0x3b,0xa2,0x8c,0xf7,0xa6,0xda,0xb1,0x63,0x91,0xf6,0x76,0x5a,0xbf,
+0x5,0xe5,0xb6,0xe0,0x59,0x61,0x0,0x75,0xf3,0x61,0xdd,0x4a,0x49,0xc9,0x5c,0xce,0x51,0xd0,0xd5,0x82,0xf7,0x48,0x11,0xaf,0x98,0xda,0x7e,0xec,0x73,0xfe,0x8b,0x9a,
+0xb3,0xf6,0xed,0xc,0xae,0x64,0x93,0x4b,0x23,0xd3,0xec,0xb5,0x97,0x24,0xcc,0x7d,0xe2,0xbc,0xb3,0x78,0x51,0xbe,0xf0,0x43,0xff,0x0,0x5c,0x63,0x91,0x6a,0xb4,0x92,
+0xf8,0x6f,0x9f,0xb3,0x9b,0x9d,0xfd,0xb3,0x9a,0x9b,0xd5,0x1a,0x53,0x89,0x99,0xf3,0x47,0xf3,0xf9,0x9f,0x30,0xfe,0xee,0x78,0xa3,0x39,0x3,0x6e,0x7f,0xe0,0x35,0xa4,
+0x35,0xd4,0xd5,0x72,0xda,0xe8,0x63,0x86,0x27,0x4,0xf5,0xcf,0xde,0xa7,0xc7,0x17,0x9a,0x37,0xf9,0x82,0x31,0x1f,0x19,0x3c,0x67,0x8a,0xb6,0xf9,0x63,0x72,0xd3,0x8b,
+0x43,0x7,0x39,0xf9,0xf1,0x91,0x90,0x6a,0x7b,0x57,0x29,0x85,0x12,0x39,0x5e,0xfd,0x7b,0xd2,0x9b,0x6d,0x6c,0x17,0x48,0xbf,0xa9,0x3e,0x23,0xb,0x17,0x20,0x6d,0x41,
+0xb3,0x27,0x93,0xd6,0xae,0xe8,0xb1,0x98,0xb4,0xdc,0xc,0x93,0x3b,0x79,0xac,0xa,0xe3,0xe9,0x59,0x46,0x52,0xe5,0xb1,0xcb,0x37,0xee,0x11,0xd8,0x4a,0xaf,0xe2,0xeb,
+0xe6,0x8e,0x5d,0xd9,0x43,0xd3,0x9c,0xf4,0x15,0xb4,0x35,0xbd,0x4b,0x45,0x86,0xe6,0x7d,0x36,0x68,0x55,0xa4,0x55,0x46,0x6d,0x8d,0x9e,0xf5,0xcd,0x28,0x7e,0xf4,0xd1,
+0x5a,0xc7,0x1d,0x1a,0xec,0x45,0x5d,0xc8,0x71,0xf2,0xfc,0xf4,0xee,0x17,0xef,0x4a,0xb,0x1e,0x40,0xe6,0xbb,0x75,0xf8,0x4d,0x62,0xe2,0x34,0xe0,0x6d,0xfd,0xf7,0x19,
+0xcf,0x4e,0xfe,0x94,0xa7,0x6b,0x1c,0x64,0x64,0x37,0x5e,0x7a,0xd4,0xf2,0xbd,0xc7,0x1d,0xcb,0x16,0xf2,0xa0,0xbc,0x6e,0xa0,0x38,0x7,0x6b,0xfb,0x54,0x3b,0x9d,0xe,
+0x72,0xc1,0xbb,0xaa,0x1e,0xbe,0x95,0x7c,0xb6,0xd4,0x97,0x67,0x26,0x1b,0x86,0x73,0xb8,0x3f,0xd0,0xe6,0xa3,0x7f,0x42,0x70,0x69,0x7b,0xcc,0x4c,0x42,0xfc,0xe0,0x83,
+0x8f,0x5a,0x7c,0x5b,0xe,0xc0,0xdc,0xe,0x9f,0x30,0xa2,0xec,0x51,0x61,0x11,0x3b,0x46,0xe6,0xc9,0xef,0x8a,0x37,0x16,0x61,0xf3,0x3a,0x91,0xfc,0x2c,0x95,0x5e,0x66,
+0x8a,0xc3,0xf3,0xf3,0x13,0xeb,0xf9,0x1a,0x4c,0xe5,0x9b,0x71,0xe1,0x8f,0xe5,0x51,0x76,0x0,0x39,0xda,0x37,0x66,0x92,0x4f,0x9b,0xef,0x3f,0x7e,0x29,0x21,0xf4,0x1b,
+0x23,0x79,0x5c,0x47,0x36,0xfc,0x9c,0xff,0x0,0xab,0xdb,0x8a,0x89,0x48,0x2f,0xfe,0xb1,0x97,0xd6,0xaa,0x4f,0xb0,0xa3,0x61,0x9b,0x94,0xf,0xbd,0xc3,0x1a,0x66,0x4a,
+0xfd,0xf3,0xd7,0xa6,0x7d,0x29,0x43,0x99,0xee,0x52,0xb0,0xa1,0xf2,0x76,0xee,0xe7,0xb0,0xa7,0x71,0x90,0x5b,0xb7,0x6a,0x49,0x31,0x3e,0xc2,0xe7,0xd8,0x51,0xf2,0x96,
+0x1b,0x8f,0xe9,0x4f,0x54,0x28,0xe8,0x23,0x2a,0xb5,0x7,0x8c,0xd3,0x4f,0xb8,0xee,0x86,0xe5,0x37,0xfd,0xf5,0x38,0xfa,0xd5,0xcf,0xdd,0xe3,0x96,0xe0,0x73,0x9a,0x97,
+0x76,0x32,0x29,0x78,0x9b,0x78,0xe5,0x8,0xed,0x53,0x29,0xe3,0xad,0x4b,0x45,0xc6,0xc5,0x2b,0x8d,0xdb,0xdb,0x1f,0x76,0xab,0x11,0x5a,0xc6,0xe6,0x7a,0x5c,0x5e,0x4f,
+0xbe,0x48,0xa9,0x64,0xfb,0xa0,0x3,0xc6,0x69,0xf5,0xd,0x8,0xb0,0x3b,0x9c,0x7e,0x14,0xda,0x20,0xd8,0x21,0x69,0x18,0xc,0xfd,0xfe,0xd5,0x1c,0xce,0xe3,0x56,0x35,
+0xb5,0xad,0x26,0xdf,0x4e,0x5b,0x73,0x6,0xb7,0x63,0xa8,0x19,0x7,0xcc,0xb6,0xfb,0x8f,0x96,0x6b,0x24,0x5,0x23,0x97,0xc7,0xb6,0x29,0xde,0x5c,0xb7,0xb0,0xa3,0x6e,
+0x85,0xe0,0xd8,0xcf,0xe9,0xce,0x73,0x4e,0x4,0xca,0xbf,0xeb,0x42,0x9f,0x52,0xb4,0x75,0x21,0xd3,0xd6,0xe3,0x7,0x4,0xaf,0x98,0x4f,0x6d,0xc7,0x9a,0x76,0xed,0xa9,
+0xe5,0x6,0xf3,0x17,0x18,0xc8,0xab,0x93,0x1d,0x88,0xf8,0xd8,0xaa,0x3e,0x5d,0xb9,0xc1,0x1d,0x79,0xa1,0xd9,0xd8,0x1d,0x9f,0x21,0xf4,0x4e,0x28,0xe5,0xbe,0xe2,0x69,
+0x1a,0xd7,0xc4,0x4f,0x13,0x48,0x85,0x57,0x7f,0x61,0xc6,0x3b,0x54,0x82,0x67,0x36,0x42,0x45,0x8,0xb2,0x22,0xe0,0x5,0x18,0xe9,0x59,0xd3,0xd3,0xde,0x33,0x63,0x21,
+0x83,0xec,0xf7,0x56,0x73,0x2,0x36,0xf2,0x64,0x1f,0x85,0x5d,0xd4,0x86,0xfb,0x9,0x94,0x70,0xc5,0x78,0xac,0x25,0x2f,0x79,0x30,0xe8,0x62,0x33,0xf0,0x7a,0x61,0xb8,
+0x34,0xd1,0x28,0xdf,0x82,0x87,0x8c,0xe7,0xde,0xba,0xa3,0x76,0xae,0x5f,0x20,0xe5,0xe4,0xff,0x0,0x74,0x3,0x93,0x81,0x4d,0xee,0xe7,0xb1,0x63,0x49,0x3d,0x44,0xb4,
+0x60,0xb9,0xdd,0x9f,0xbb,0xf8,0x54,0x93,0x48,0xfe,0x79,0x3c,0x67,0x1f,0x78,0x56,0x88,0x6d,0x2d,0xc6,0xe0,0x6c,0x29,0x8e,0xdc,0x7d,0x6a,0x27,0x19,0x3,0x1d,0xea,
+0x14,0xbb,0x94,0x84,0x91,0xb3,0xd3,0xb6,0x69,0xf1,0xed,0x78,0xf7,0x3b,0x32,0x91,0xd8,0x77,0xa7,0xa2,0x5a,0x93,0x14,0x28,0xeb,0x8d,0xdc,0xf1,0xdb,0xad,0x48,0x38,
+0xda,0x77,0x72,0xac,0xf,0x4a,0x87,0xb5,0x8a,0xc,0xed,0xe3,0x72,0x9f,0xa5,0x34,0x36,0x77,0x63,0x39,0x6,0xa6,0xdc,0x8d,0x12,0xd0,0x98,0x3b,0xa3,0xf4,0x4,0x93,
+0xc5,0x2f,0xe3,0x9f,0xc3,0x18,0xf6,0xa7,0x61,0xb4,0x44,0xe3,0x2e,0x69,0x99,0xdb,0xd2,0xaf,0xc9,0x82,0x56,0x90,0xd3,0xce,0x3d,0xa9,0xa5,0x55,0xd9,0xcb,0xe7,0x3b,
+0xb3,0xc7,0xbd,0x9,0xf2,0x32,0xde,0xd7,0x44,0x9f,0x37,0x42,0x7d,0xe9,0x31,0xdf,0xd2,0x8b,0xae,0x84,0x34,0x28,0xe5,0xc6,0x78,0x19,0xa0,0x75,0x27,0x23,0xd8,0x54,
+0xcd,0x6,0xc3,0x1b,0x7e,0xee,0x32,0x69,0xa4,0x10,0x4f,0xeb,0x55,0xce,0x8a,0x56,0x24,0xb7,0x76,0x4,0x85,0x93,0xcb,0xf7,0xa9,0xbc,0xe2,0xf,0x5a,0x99,0xe8,0xc6,
+0xc8,0x65,0x93,0xa8,0xe3,0x9a,0x91,0x26,0x0,0xfc,0xc9,0xb8,0x7d,0x71,0x9a,0x14,0x6e,0x1a,0xd8,0xad,0x3f,0xcd,0x21,0x3f,0xa5,0x47,0x81,0x9f,0xa5,0x57,0x40,0xe5,
+0x17,0x18,0x20,0xee,0xa7,0x75,0xa8,0x94,0x98,0xa4,0x86,0xc9,0xf2,0x1,0xd2,0x99,0xb8,0xe0,0x70,0x3f,0xa,0xd0,0x4d,0x58,0x4e,0x47,0x23,0xb5,0x27,0xb9,0xf5,0xa3,
+0xae,0x85,0x5b,0x41,0x7f,0x88,0xd3,0x7b,0xd2,0xee,0x1b,0x9f,0xff,0xd9,
+};
+
+#endif
@@ -0,0 +1,125 @@
+#include "capture.hpp"
+
+#include <atomic>
+#include <sys/time.h>
+
+#include "esp32-hal-log.h"
+#include "esp_timer.h"
+
+namespace capture {
+
+    namespace {
+        sensor_t* sensor = nullptr;
+        framesize_t currentFramesize = FRAMESIZE_INVALID;
+        // written by the capture task, read by the UI and the server
+        std::atomic<size_t> dropped {0};
+        std::atomic<size_t> stale {0};
+
+        inline int64_t toUs(const struct timeval& tv) { return static_cast<int64_t>(tv.tv_sec) * 1000000 + tv.tv_usec; }
+    }
+
+    bool framesizeDimensions(const framesize_t framesize, size_t& width, size_t& height) {
+        switch (framesize) {
+            case FRAMESIZE_QQVGA: width = 160; height = 120; return true;
+            case FRAMESIZE_QVGA: width = 320; height = 240; return true;
+            case FRAMESIZE_CIF: width = 400; height = 296; return true;
+            case FRAMESIZE_VGA: width = 640; height = 480; return true;
+            case FRAMESIZE_SVGA: width = 800; height = 600; return true;
+            case FRAMESIZE_XGA: width = 1024; height = 768; return true;
+            case FRAMESIZE_SXGA: width = 1280; height = 1024; return true;
+            case FRAMESIZE_UXGA: width = 1600; height = 1200; return true;
+            default: return false;
+        }
+    }
+
+    void init(sensor_t* s, const framesize_t framesize) {
+        sensor = s;
+        currentFramesize = FRAMESIZE_INVALID;
+        setFramesize(framesize);
+    }
+
+    void setFramesize(const framesize_t framesize) {
+        if(sensor == nullptr || framesize == currentFramesize) return;
+
+        sensor->set_framesize(sensor, framesize);
+        currentFramesize = framesize;
+    }
+
+    framesize_t framesize() { return currentFramesize; }
+
+    camera_fb_t* grab(const framesize_t framesize) {
+        size_t width, height;
+        if(!framesizeDimensions(framesize, width, height)) {
+            log_e("capture::grab: unsupported framesize %d", framesize);
+            return nullptr;
+        }
+
+        setFramesize(framesize);
+
+        // frames already queued by the driver still have the previous size right after a switch,
+        // and were captured while we were busy when we don't grab often enough
+        size_t staleDropped = 0;
+        for (size_t i = 0; i <= MAX_DROPPED_FRAMES + MAX_STALE_FRAMES; ++i) {
+            camera_fb_t* fb = esp_camera_fb_get();
+            if(fb == nullptr) return nullptr;
+
+            if(fb->width != width || fb->height != height) {
+                esp_camera_fb_return(fb);
+                ++dropped;
+                continue;
+            }
+
+            // bounded so a slow sensor (low light) still delivers its frames
+            if(staleDropped < MAX_STALE_FRAMES && esp_timer_get_time() - capturedUs(fb) > MAX_FRAME_AGE_US) {
+                esp_camera_fb_return(fb);
+                ++staleDropped;
+                ++stale;
+                continue;
+            }
+
+            return fb;
+        }
+
+        log_w("capture::grab: no %zux%zu frame after %d tries", width, height, MAX_DROPPED_FRAMES + MAX_STALE_FRAMES);
+        return nullptr;
+    }
+
+    bool grabLatest(const framesize_t framesize, Frame& out) {
+        camera_fb_t* fb = grab(framesize);
+        if(fb == nullptr) return false;
+
+        // JPEG sizes vary from frame to frame, grow with some headroom so the buffer stops being reallocated after a few frames
+        if(fb->len > out.data.capacity()) out.data.reserve(fb->len + fb->len / 2);
+        out.data.assign(fb->buf, fb->buf + fb->len);
+        out.width = fb->width;
+        out.height = fb->height;
+        out.format = fb->format;
+        out.capturedUs = capturedUs(fb);
+        esp_camera_fb_return(fb);
+        return true;
+    }
+
+    int64_t capturedUs(const camera_fb_t* fb) {
+        // the driver stamps frames with gettimeofday, move it to the esp_timer clock used everywhere else
+        struct timeval now;
+        gettimeofday(&now, nullptr);
+        return esp_timer_get_time() - (toUs(now) - toUs(fb->timestamp));
+    }
+
+    size_t droppedFrames() { return dropped; }
+
+    size_t staleFrames() { return stale; }
+
+    bool FpsCounter::tick(const int64_t nowUs, const int64_t windowUs) {
+        if(frames_ == 0 && windowStart_ == 0) windowStart_ = nowUs;
+
+        ++frames_;
+        const int64_t elapsed = nowUs - windowStart_;
+        if(elapsed < windowUs) return false;
+
+        fps_ = static_cast<float>(frames_) * 1000000.f / static_cast<float>(elapsed);
+        frames_ = 0;
+        windowStart_ = nowUs;
+        return true;
+    }
+}
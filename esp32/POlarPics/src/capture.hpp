@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "esp_camera.h" // Cam
+
+namespace capture {
+
+    // Sensor framesize used for prints, the full sensor: it is decoded one MCU row at a time. The preview one is picked by the governor
+    #define PRINT_FRAMESIZE FRAMESIZE_UXGA
+    #define PRINT_FRAMESIZE_NO_PSRAM FRAMESIZE_SVGA // the driver frame buffers are only sized for it without PSRAM
+
+    // number of frames of the wrong size (after a framesize switch) we accept to drop before giving up
+    #define MAX_DROPPED_FRAMES 4
+
+    // a frame which waited longer than that in the driver queue is dropped for a fresher one
+    #define MAX_FRAME_AGE_US 100000
+    // frame buffers of the driver, all of them can be stale when we come back after a long processing
+    #define MAX_STALE_FRAMES 2
+
+    // Compressed frame copied out of the driver buffer, the storage is reused from one grab to the next
+    struct Frame {
+        std::vector<uint8_t> data;
+        size_t width;
+        size_t height;
+        pixformat_t format;
+        int64_t capturedUs; // esp_timer time at which the sensor produced the frame
+
+        Frame() : width{0}, height{0}, format{PIXFORMAT_JPEG}, capturedUs{0} {}
+    };
+
+    bool framesizeDimensions(const framesize_t framesize, size_t& width, size_t& height);
+
+    void init(sensor_t* s, const framesize_t framesize);
+
+    // Only talk to the sensor when the framesize really changes
+    void setFramesize(const framesize_t framesize);
+    framesize_t framesize();
+
+    // Switch to framesize if needed and return the freshest frame with the matching dimensions (nullptr on failure).
+    // The frame must be given back with esp_camera_fb_return.
+    camera_fb_t* grab(const framesize_t framesize);
+
+    // grab then copy the frame into out and give the driver buffer back right away so the sensor keeps streaming
+    bool grabLatest(const framesize_t framesize, Frame& out);
+
+    // when the sensor produced the frame, on the esp_timer clock
+    int64_t capturedUs(const camera_fb_t* fb);
+
+    // frames of the wrong size after a framesize switch
+    size_t droppedFrames();
+    // frames that waited too long in the driver queue
+    size_t staleFrames();
+
+    class FpsCounter {
+    private:
+        int64_t windowStart_;
+        size_t frames_;
+        float fps_;
+
+    public:
+        FpsCounter() : windowStart_{0}, frames_{0}, fps_{0.f} {}
+
+        // returns true when a new fps value is available (once per window)
+        bool tick(const int64_t nowUs, const int64_t windowUs = 5000000);
+
+        inline float fps() const { return fps_; }
+    };
+}
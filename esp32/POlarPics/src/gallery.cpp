@@ -0,0 +1,241 @@
+#include "gallery.hpp"
+
+#include <atomic>
+#include <cstring>
+
+#include <sys/stat.h>
+
+#if defined(ARDUINO) && defined(POLARPICS_GALLERY)
+#include "SD_MMC.h"
+#endif
+
+#include "esp32-hal-log.h"
+
+#include "Netpbm.h"
+
+namespace gallery {
+
+    namespace {
+        char rootDir[GALLERY_PATH_SIZE] = "";
+        bool mounted = false;
+
+        // entries are only added by the print task, count() and entry() can be called from loop()
+        std::atomic<size_t> entries {0};
+        std::atomic<uint32_t> nextId {0};
+
+        static_assert(sizeof(Entry) == 8, "the index records are written as they are in memory");
+
+        bool entryPath(const uint32_t id, char* path) {
+            return std::snprintf(path, GALLERY_PATH_SIZE, "%s/%05u.pbm", rootDir, static_cast<unsigned>(id)) < GALLERY_PATH_SIZE;
+        }
+
+        // init() checked the root against the entry paths, which are as long: the empty path (open fails) is only a safeguard
+        void indexPath(char* path) {
+            if (std::snprintf(path, GALLERY_PATH_SIZE, "%s/index.bin", rootDir) >= GALLERY_PATH_SIZE) path[0] = '\0';
+        }
+
+        // written at the slot after the last whole record, a record torn by a power loss is overwritten
+        bool appendIndex(const Entry& record) {
+            char path[GALLERY_PATH_SIZE];
+            indexPath(path);
+            std::FILE* index = std::fopen(path, "r+b");
+            if (index == nullptr) index = std::fopen(path, "wb");
+            if (index == nullptr) {
+                log_e("gallery: can't open %s", path);
+                return false;
+            }
+
+            const bool written = std::fseek(index, static_cast<long>(entries.load() * sizeof(Entry)), SEEK_SET) == 0 &&
+                std::fwrite(&record, sizeof(Entry), 1, index) == 1;
+            std::fclose(index);
+            if (!written) {
+                log_e("gallery: index write failed");
+                return false;
+            }
+            ++entries;
+            return true;
+        }
+
+        // SDMMC in 1-bit mode drives GPIO 14 (CLK), 15 (CMD) and 2 (D0), the pins of the default TFT wiring
+        bool mountCard() {
+#if !defined(ARDUINO)
+            return true; // host builds use a plain directory
+#elif defined(POLARPICS_GALLERY)
+            if (!SD_MMC.begin(GALLERY_MOUNT_POINT, true)) {
+                log_w("gallery: no SD card, prints are not kept");
+                return false;
+            }
+            return true;
+#else
+            log_i("gallery: built without -DPOLARPICS_GALLERY, prints are not kept");
+            return false;
+#endif
+        }
+    }
+
+    bool init(const char* root) {
+        if (!mountCard()) return false;
+        if (std::strlen(root) + sizeof("/00000.pbm") > GALLERY_PATH_SIZE) {
+            log_e("gallery: root path too long");
+            return false;
+        }
+        std::strcpy(rootDir, root);
+        mkdir(rootDir, 0777); // fails when it already exists
+
+        char path[GALLERY_PATH_SIZE];
+        indexPath(path);
+        size_t records = 0;
+        Entry last = {0, 0, 0};
+        std::FILE* index = std::fopen(path, "rb");
+        if (index != nullptr) {
+            std::fseek(index, 0, SEEK_END);
+            records = static_cast<size_t>(std::ftell(index)) / sizeof(Entry);
+            if (records > 0) {
+                std::fseek(index, static_cast<long>((records - 1) * sizeof(Entry)), SEEK_SET);
+                if (std::fread(&last, sizeof(Entry), 1, index) != 1) records = 0;
+            }
+            std::fclose(index);
+        }
+
+        entries = records;
+        nextId = records > 0 ? last.id + 1 : 0;
+        mounted = true;
+        log_d("gallery: %zu entries in %s", records, rootDir);
+        return true;
+    }
+
+    bool ready() { return mounted; }
+
+    size_t count() { return entries.load(); }
+
+    bool entry(const size_t index, Entry& out) {
+        if (!mounted || index >= entries.load()) return false;
+
+        char path[GALLERY_PATH_SIZE];
+        indexPath(path);
+        std::FILE* file = std::fopen(path, "rb");
+        if (file == nullptr) return false;
+        const bool found = std::fseek(file, static_cast<long>(index * sizeof(Entry)), SEEK_SET) == 0 &&
+            std::fread(&out, sizeof(Entry), 1, file) == 1;
+        std::fclose(file);
+        return found;
+    }
+
+    bool load(const uint32_t id, PrinterMatrix& bitmap) {
+        char path[GALLERY_PATH_SIZE];
+        if (!mounted || !entryPath(id, path)) return false;
+
+        std::FILE* file = std::fopen(path, "rb");
+        if (file == nullptr) {
+            log_e("gallery: can't open %s", path);
+            return false;
+        }
+        const bool loaded = netpbm::read(file, bitmap);
+        std::fclose(file);
+        return loaded;
+    }
+
+    bool Writer::open(const size_t width) {
+        if (!mounted || file_ != nullptr) return false;
+
+        char path[GALLERY_PATH_SIZE];
+        id_ = nextId.load();
+        if (!entryPath(id_, path)) return false;
+        file_ = std::fopen(path, "wb");
+        if (file_ == nullptr) {
+            log_e("gallery: can't create %s", path);
+            return false;
+        }
+
+        width_ = width;
+        rows_ = 0;
+        std::fprintf(file_, "P4\n%u ", static_cast<unsigned>(width_));
+        heightPos_ = std::ftell(file_);
+        if (std::fprintf(file_, "%0*u\n", GALLERY_HEIGHT_DIGITS, 0u) < 0) {
+            abort();
+            return false;
+        }
+        return true;
+    }
+
+    bool Writer::writeRows(const uint8_t* rows, const size_t count) {
+        if (file_ == nullptr) return false;
+
+        const size_t bytes = netpbm::rowBytes(netpbm::EFormat::pbm, width_) * count;
+        if (std::fwrite(rows, 1, bytes, file_) != bytes) {
+            log_e("gallery: write failed, entry %u dropped", static_cast<unsigned>(id_));
+            abort();
+            return false;
+        }
+        rows_ += count;
+        return true;
+    }
+
+    bool Writer::close() {
+        if (file_ == nullptr) return false;
+
+        const bool patched = std::fseek(file_, heightPos_, SEEK_SET) == 0 &&
+            std::fprintf(file_, "%0*u", GALLERY_HEIGHT_DIGITS, static_cast<unsigned>(rows_)) == GALLERY_HEIGHT_DIGITS;
+        if (!patched || std::fclose(file_) != 0) {
+            file_ = nullptr;
+            log_e("gallery: entry %u can't be finished", static_cast<unsigned>(id_));
+            return false;
+        }
+        file_ = nullptr;
+
+        const Entry record = {id_, static_cast<uint16_t>(width_), static_cast<uint16_t>(rows_)};
+        if (!appendIndex(record)) return false;
+        nextId = id_ + 1;
+        log_d("gallery: entry %u saved (%zux%zu)", static_cast<unsigned>(id_), width_, rows_);
+        return true;
+    }
+
+    void Writer::abort() {
+        if (file_ == nullptr) return;
+
+        std::fclose(file_);
+        file_ = nullptr;
+        char path[GALLERY_PATH_SIZE];
+        if (entryPath(id_, path)) std::remove(path);
+    }
+
+    bool Reader::open(const uint32_t id) {
+        close();
+        char path[GALLERY_PATH_SIZE];
+        if (!mounted || !entryPath(id, path)) return false;
+
+        file_ = std::fopen(path, "rb");
+        if (file_ == nullptr) {
+            log_e("gallery: can't open %s", path);
+            return false;
+        }
+
+        netpbm::Header header;
+        if (!netpbm::readHeader(file_, header) || header.format != netpbm::EFormat::pbm) {
+            log_e("gallery: %s is not a PBM", path);
+            close();
+            return false;
+        }
+        width_ = header.width;
+        height_ = header.height;
+        rowsRead_ = 0;
+        return true;
+    }
+
+    bool Reader::readRows(uint8_t* rows, const size_t count) {
+        if (file_ == nullptr || count > rowsLeft()) return false;
+
+        const size_t bytes = netpbm::rowBytes(netpbm::EFormat::pbm, width_) * count;
+        if (std::fread(rows, 1, bytes, file_) != bytes) {
+            log_e("gallery: entry truncated");
+            return false;
+        }
+        rowsRead_ += count;
+        return true;
+    }
+
+    void Reader::close() {
+        if (file_ != nullptr) std::fclose(file_);
+        file_ = nullptr;
+    }
+}
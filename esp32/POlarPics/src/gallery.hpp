@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "PrinterMatrix.h"
+
+// Every print is kept on the SD card as it was sent to the printer: a P4 PBM (byte padded rows, a set bit is a burnt dot),
+// 384x288 takes 13.8 KB. An append-only index lists the entries so a reprint reads the rows back with no capture nor dithering.
+namespace gallery {
+
+#ifdef ARDUINO
+    #define GALLERY_MOUNT_POINT "/sdcard"
+    #define GALLERY_ROOT GALLERY_MOUNT_POINT "/gallery"
+#else
+    #define GALLERY_ROOT "gallery" // host builds use a plain directory as the SD card
+#endif
+    #define GALLERY_PATH_SIZE 64
+    #define GALLERY_HEIGHT_DIGITS 5 // the height is patched in the header once the last row is written
+
+    // record of the index file
+    struct Entry {
+        uint32_t id; // the file is <root>/<id>.pbm
+        uint16_t width;
+        uint16_t height;
+    };
+
+    // Mount the SD card (1-bit mode, GPIO 4 and 12 stay free for the flash LED and the buttons) and load the index of root.
+    // The card takes GPIO 14, 15 and 2, the TFT SCLK, CS and DC of the default wiring: the card is only mounted with
+    // -DPOLARPICS_GALLERY (env esp32cam-gallery), on a board whose TFT was moved off those pins. Without it this returns false.
+    bool init(const char* root = GALLERY_ROOT);
+    bool ready();
+
+    size_t count();
+    // entries in the order they were saved, false past the end
+    bool entry(const size_t index, Entry& out);
+
+    // The PBM of an entry into bitmap (PrinterMatrix convention), only reallocated when the size changes
+    bool load(const uint32_t id, PrinterMatrix& bitmap);
+
+    // New entry written a few rows at a time (print task side), it only appears in the index once closed
+    class Writer {
+    private:
+        std::FILE* file_;
+        uint32_t id_;
+        size_t width_;
+        size_t rows_;
+        long heightPos_; // where the height digits are in the header
+
+    public:
+        Writer() : file_{nullptr}, id_{0}, width_{0}, rows_{0}, heightPos_{0} {}
+        ~Writer() { abort(); }
+
+        bool open(const size_t width);
+        // rows in the thermal dot convention, byte padded (printing::Band layout)
+        bool writeRows(const uint8_t* rows, const size_t count);
+        // patch the height and append the entry to the index
+        bool close();
+        // drop the file, e.g. for a cancelled print
+        void abort();
+
+        inline bool isOpen() const { return file_ != nullptr; }
+    };
+
+    // Rows of an entry read back in the thermal dot convention, byte padded (printing::Band layout)
+    class Reader {
+    private:
+        std::FILE* file_;
+        size_t width_;
+        size_t height_;
+        size_t rowsRead_;
+
+    public:
+        Reader() : file_{nullptr}, width_{0}, height_{0}, rowsRead_{0} {}
+        ~Reader() { close(); }
+
+        bool open(const uint32_t id);
+        // false on a read error or past the last row
+        bool readRows(uint8_t* rows, const size_t count);
+        void close();
+
+        inline size_t width() const { return width_; }
+        inline size_t height() const { return height_; }
+        inline size_t rowsLeft() const { return height_ - rowsRead_; }
+    };
+}
@@ -0,0 +1,148 @@
+#include "jpeg.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "esp_jpg_decode.h"
+#include "esp32-hal-log.h"
+
+#include "filtering.h"
+#include "utils.hpp"
+
+namespace jpeg {
+
+    namespace {
+        bool copyRows(void* arg, const uint8_t* rows, const size_t firstRow, const size_t count, const size_t width) {
+            Matrix<uint8_t>& out = *static_cast<Matrix<uint8_t>*>(arg);
+            if (out.width() != width || firstRow + count > out.height()) return false;
+            std::copy(rows, rows + count * width, out.data() + firstRow * width);
+            return true;
+        }
+
+        // JPEG start of frame: the image size without decoding anything
+        bool frameSize(const uint8_t* data, const size_t len, size_t& width, size_t& height) {
+            size_t i = 2; // after SOI
+            while (i + 9 < len) {
+                if (data[i] != 0xFF) return false;
+                const uint8_t marker = data[i + 1];
+                const size_t segment = (data[i + 2] << 8) | data[i + 3];
+                // SOF0 to SOF15 except DHT, JPG and DAC
+                if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+                    height = (data[i + 5] << 8) | data[i + 6];
+                    width = (data[i + 7] << 8) | data[i + 8];
+                    return true;
+                }
+                i += 2 + segment;
+            }
+            return false;
+        }
+    }
+
+    const char* scaleToString(const EScale scale) {
+        switch (scale) {
+            case EScale::full: return "1/1";
+            case EScale::half: return "1/2";
+            case EScale::quarter: return "1/4";
+            case EScale::eighth: return "1/8";
+            default: return "invalid";
+        }
+    }
+
+    EScale pickScale(const size_t width, const size_t height, const size_t targetWidth, const size_t targetHeight) {
+        EScale scale = EScale::full;
+        for (const EScale next : {EScale::half, EScale::quarter, EScale::eighth}) {
+            if (width / scaleDivisor(next) < targetWidth || height / scaleDivisor(next) < targetHeight) break;
+            scale = next;
+        }
+        return scale;
+    }
+
+    size_t GrayDecoder::read(void* arg, size_t index, uint8_t* buf, size_t len) {
+        const GrayDecoder& decoder = *static_cast<GrayDecoder*>(arg);
+        if (index >= decoder.inputLen_) return 0;
+        len = std::min(len, decoder.inputLen_ - index);
+        if (buf != nullptr) std::memcpy(buf, decoder.input_ + index, len); // nullptr skips bytes
+        return len;
+    }
+
+    bool GrayDecoder::write(void* arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t* data) {
+        GrayDecoder& decoder = *static_cast<GrayDecoder*>(arg);
+        if (data == nullptr) {
+            // start (x = y = 0, w x h is the image size) and end of the decode
+            if (x == 0 && y == 0) {
+                decoder.width_ = w;
+                decoder.height_ = h;
+                if (decoder.strip_.width() < w)
+                    decoder.strip_ = Matrix<uint8_t>(w, JPEG_MAX_MCU_ROWS, decoder.strip_.owner());
+                if (decoder.strip_.data() == nullptr) {
+                    log_e("jpeg: can't allocate the %ux%u strip", w, JPEG_MAX_MCU_ROWS);
+                    return false;
+                }
+            }
+            return true;
+        }
+        if (h > JPEG_MAX_MCU_ROWS) return false;
+
+        // the block is RGB888, row after row
+        const size_t stride = decoder.strip_.width();
+        for (size_t r = 0; r < h; ++r) {
+            uint8_t* out = decoder.strip_.data() + r * stride + x;
+            for (size_t c = 0; c < w; ++c, data += 3)
+                out[c] = filtering::rgbToGrayscale(data[0], data[1], data[2]);
+        }
+
+        // last block of the MCU row
+        if (x + w < decoder.width_) return true;
+        if (stride == decoder.width_)
+            return decoder.callback_(decoder.arg_, decoder.strip_.data(), y, h, decoder.width_);
+        for (size_t r = 0; r < h; ++r) {
+            if (!decoder.callback_(decoder.arg_, decoder.strip_.data() + r * stride, y + r, 1, decoder.width_)) return false;
+        }
+        return true;
+    }
+
+    bool GrayDecoder::decode(const uint8_t* data, const size_t len, RowCallback callback, void* arg, const EScale scale) {
+        input_ = data;
+        inputLen_ = len;
+        callback_ = callback;
+        arg_ = arg;
+        const esp_err_t result = esp_jpg_decode(len, static_cast<jpg_scale_t>(scale), &GrayDecoder::read, &GrayDecoder::write, this);
+        input_ = nullptr;
+        if (result != ESP_OK) {
+            log_e("jpeg: decode failed (%d)", result);
+            return false;
+        }
+        return true;
+    }
+
+    bool GrayDecoder::decode(const uint8_t* data, const size_t len, Matrix<uint8_t>& out) {
+        size_t width, height;
+        if (!frameSize(data, len, width, height)) {
+            log_e("jpeg: no frame header");
+            return false;
+        }
+        if (out.width() != width || out.height() != height)
+            out = Matrix<uint8_t>(width, height, out.owner());
+        return decode(data, len, copyRows, &out);
+    }
+
+    bool GrayDecoder::decode(const uint8_t* data, const size_t len, Matrix<uint8_t>& out, const size_t targetWidth, const size_t targetHeight) {
+        size_t width, height;
+        if (!frameSize(data, len, width, height)) {
+            log_e("jpeg: no frame header");
+            return false;
+        }
+        const EScale scale = pickScale(width, height, targetWidth, targetHeight);
+        const size_t scaledWidth = width / scaleDivisor(scale);
+        const size_t scaledHeight = height / scaleDivisor(scale);
+        if (scaledWidth == targetWidth && scaledHeight == targetHeight) {
+            if (out.width() != targetWidth || out.height() != targetHeight)
+                out = Matrix<uint8_t>(targetWidth, targetHeight, out.owner());
+            return decode(data, len, copyRows, &out, scale);
+        }
+
+        utils::GrayRowRescaler rescaler(out);
+        return rescaler.begin(scaledWidth, scaledHeight, targetWidth, targetHeight) &&
+            decode(data, len, utils::GrayRowRescaler::rowCallback, &rescaler, scale) && rescaler.done();
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Matrix.h"
+
+// JPEG decode one MCU row at a time straight to grayscale: only a strip of width x 16 bytes is kept
+// instead of the width x height x 3 RGB buffer of fmt2rgb888 (5.7 MB at UXGA).
+namespace jpeg {
+
+    #define JPEG_MAX_MCU_ROWS 16 // an MCU is 8 or 16 rows high depending on the chroma subsampling
+
+    // DCT domain scaling of the ROM decoder, same order as jpg_scale_t: the IDCT and the color conversion only
+    // produce 1/2, 1/4 or 1/8 of the pixels per side, 1/8 only keeps the DC coefficient of each block
+    enum class EScale : uint8_t {
+        full,
+        half,
+        quarter,
+        eighth
+    };
+
+    const char* scaleToString(const EScale scale);
+    inline size_t scaleDivisor(const EScale scale) { return size_t(1) << static_cast<uint8_t>(scale); }
+
+    // Most reduced scale still at least as large as the target on both sides
+    EScale pickScale(const size_t width, const size_t height, const size_t targetWidth, const size_t targetHeight);
+
+    // Receives rows [firstRow, firstRow + count) of the grayscale image, width bytes each, returns false to abort the decode
+    typedef bool (*RowCallback)(void* arg, const uint8_t* rows, const size_t firstRow, const size_t count, const size_t width);
+
+    class GrayDecoder {
+    private:
+        Matrix<uint8_t> strip_; // one MCU row, only reallocated when the width grows
+        const uint8_t* input_;
+        size_t inputLen_;
+        size_t width_;
+        size_t height_;
+        RowCallback callback_;
+        void* arg_;
+
+        static size_t read(void* arg, size_t index, uint8_t* buf, size_t len);
+        static bool write(void* arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t* data);
+
+    public:
+        explicit GrayDecoder(const memory::EOwner owner = memory::EOwner::decode) :
+            strip_{owner}, input_{nullptr}, inputLen_{0}, width_{0}, height_{0}, callback_{nullptr}, arg_{nullptr} {}
+
+        // The ROM decoder (TJpgDec) hands out MCU blocks left to right, the rows go to callback once a whole MCU row is there
+        bool decode(const uint8_t* data, const size_t len, RowCallback callback, void* arg, const EScale scale = EScale::full);
+
+        // Whole image into out, only reallocated (for the same owner) when the size changes
+        bool decode(const uint8_t* data, const size_t len, Matrix<uint8_t>& out);
+
+        // Image resized to targetWidth x targetHeight into out: decoded at the scale given by pickScale,
+        // then sampled to the exact size on the fly when the scaled image is still larger
+        bool decode(const uint8_t* data, const size_t len, Matrix<uint8_t>& out, const size_t targetWidth, const size_t targetHeight);
+
+        // of the last decoded image, after scaling
+        inline size_t width() const { return width_; }
+        inline size_t height() const { return height_; }
+    };
+}
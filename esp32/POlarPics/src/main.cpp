@@ -7,13 +7,11 @@
 #include "soc/soc.h"           // Disable brownour problems
 #include "soc/rtc_cntl_reg.h"  // Disable brownour problems
 
-#include "img_converters.h"
-
 // #include "driver/rtc_io.h" // allows lock GPIO state during sleep
 
-#include <cstdlib>
 #include <stdexcept>
 #include <array>
+#include <atomic>
 
 #include "Matrix.h"
 #include "PrinterMatrix.h"
@@ -21,70 +19,171 @@
 #include "filtering.h"
 #include "utils.hpp"
 #include "menu.hpp"
+#include "capture.hpp"
+#include "jpeg.hpp"
+#include "governor.h"
+#include "preview.hpp"
+#include "printing.hpp"
+#include "gallery.hpp"
+#include "Signal.h"
+#include "Task.h"
+#include "buttons.h"
+#include "trace.h"
+#include "AllocGuard.h"
+#include "bench.hpp"
+#include "server.hpp"
 
-#include "test.h" // img exemple
 #include <HardwareSerial.h>
-#include "Adafruit_Thermal.h"
 
 #define CAMERA_MODEL_AI_THINKER
 #include "camera_pins.h"
 
-#define BUTTON_PIN 12
+#ifndef BUTTON_PIN
+    #define BUTTON_PIN 12 // ADC2, only readable while WiFi is off
+#endif
+#if defined(POLARPICS_SERVER) && (BUTTON_PIN < 32 || BUTTON_PIN > 39)
+    #error "WiFi owns ADC2 (GPIO 0, 2, 4, 12-15, 25-27): the server build needs the button ladder on an ADC1 pin, GPIO 32-39 (see env esp32cam-server)"
+#endif
+#define BUTTON_CORE 1
+
+// UART0 is the printer line: the logs go out on a TX-only UART1 pin (LOG_TX_PIN, set by the platformio envs) to a
+// USB-serial adapter. Without it they are switched off once the printer line is up.
+#define LOG_BAUD 115200
+#if defined(POLARPICS_BUTTON_RECORD) && !defined(LOG_TX_PIN)
+    #error "the button recordings go out on the log UART, build with -DLOG_TX_PIN"
+#endif
+
+#define CAPTURE_CORE 0 // loop() runs on core 1
+#define CAPTURE_TASK_STACK 8192
+#define CAPTURE_TASK_PRIORITY 1
+
+#define IDLE_TIMEOUT_MS 60000 // without input nor print, the preview stops and the screen sleeps
+#define STATE_REPORT_US 10000000 // period of the cpu utilization and memory report
+#define PSRAM_BUDGET (3 * 1024 * 1024) // Matrix bytes in PSRAM before the memory alarm, the camera frame buffers take the rest
 
 sensor_t* s = nullptr;
 
 TFT_eSPI tft = TFT_eSPI();  // Invoke library, pins defined in User_Setup.h
 
-// matrix buffers
-Matrix<uint8_t> grayscale;
 // PrinterMatrix ditherMat;
 
+// notified by the capture and button tasks, loop() blocks on it when there is nothing to do
+pipeline::Signal loopWake;
+
+std::atomic<bool> capturePaused {false};
+
+// print capture handshake: loop() asks, the capture task fills printGrayscale then raises printFrameReady
+std::atomic<bool> printRequested {false};
+std::atomic<bool> printFrameReady {false};
+Matrix<uint8_t> printGrayscale {memory::EOwner::print};
+framesize_t printFramesize = PRINT_FRAMESIZE; // PRINT_FRAMESIZE_NO_PSRAM without PSRAM
+int64_t printRequestUs = 0;
+int64_t printCapturedUs = 0;
+uint32_t printCaptures = 0; // trace id of the print captures
+
+printing::StreamWriter printStream;
+size_t printStreamRow = 0; // next printGrayscale row to stream
+
+// loop() states, each one only does the work it needs
+enum EState {
+    statePreview, // live dithered preview
+    stateMenu, // capture paused, redrawn on input only
+    statePrinting, // preview plus the print capture streamed to the print task
+    stateIdle, // capture paused and screen asleep until a button is pressed
+    stateCount
+};
+
+const char* stateToString(const EState state) {
+    switch (state) {
+        case statePreview: return "preview";
+        case stateMenu: return "menu";
+        case statePrinting: return "printing";
+        case stateIdle: return "idle";
+        default: return "unknown";
+    }
+}
+
+EState state = statePreview;
+int64_t lastInputUs = 0;
+
+// loop() time spent working and in total per state, over the last report period
+struct StateUsage {
+    int64_t busyUs;
+    int64_t totalUs;
+};
+std::array<StateUsage, stateCount> stateUsage {};
+int64_t stateReportUs = 0;
+
 // menuVariables
-size_t buttonsValue;
 size_t selectedOption = 0;
-bool menuOpen = false;
 bool needDrawMenu = false;
 bool optionSelected = false;
 
-size_t lockBtn = 0; // lock btn if != 0
-const size_t lockIteration = 2;
-
 
-std::array<size_t, 22> optionsValuesIdx {{
+menu::OptionsValuesIdx optionsValuesIdx {{
     2, 2, 2, 0, 1, 1, 0, 1, 0, 2, 2, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0
 }};
 
 //HardwareSerial printerSerial(1);
-Adafruit_Thermal printer(&Serial); // Pass addr to printer constructor
-
-// Pause in milliseconds between screens, change to 0 to time font rendering
-#define WAIT 100
+thermal::PrinterSettings printerSettings = thermal::defaultSettings;
+
+// Single full sensor capture rescaled to the printer width (capture task side).
+// Decoded at the DCT scale closest to the printer width, only an MCU row of the image is in memory at once.
+void capturePrintFrame(capture::Frame& jpeg, jpeg::GrayDecoder& decoder) {
+    TRACE_SCOPE(stagePrint, printCaptures++);
+    const bool grabbed = capture::grabLatest(printFramesize, jpeg);
+    // go back to the preview size right away so the sensor refills the queue while the print is processed
+    capture::setFramesize(preview::framesize());
+    if (!grabbed) {
+        log_e("capturePrintFrame: capture failed");
+        return;
+    }
 
-void testImg(Adafruit_Thermal& printer) {
-  printer.printBitmap(test_width, test_height, test_data);
-  printer.sleep();      // Tell printer to sleep
-  delay(3000L);         // Sleep for 3 seconds
-  printer.wake();       // MUST wake() before printing again, even if reset
-  printer.setDefault(); // Restore printer to defaults
+    if (!decoder.decode(jpeg.data.data(), jpeg.data.size(), printGrayscale, PRINTER_WIDTH, jpeg.height * PRINTER_WIDTH / jpeg.width)) {
+        log_e("capturePrintFrame: decode failed");
+        return;
+    }
+    printCapturedUs = esp_timer_get_time();
+    printFrameReady.store(true, std::memory_order_release);
 }
 
-void printImg(const PrinterMatrix& mat, Adafruit_Thermal& printer) {
-    // printer.feed(2);
-    printer.printBitmap(mat.width(), mat.height(), mat.data(), false);
-    // printer.feed(2);
-    printer.sleep();
-    delay(500);
-    printer.wake();
-    printer.setDefault();
+void captureTask(void*) {
+    allocguard::watchCurrentTask();
+
+    capture::Frame jpeg; // copy of the driver frame buffer, reused
+    jpeg::GrayDecoder decoder {memory::EOwner::decode}; // MCU row strip, only reallocated when the width grows
+
+    for(;;) {
+        if (printRequested.load() && !printFrameReady.load(std::memory_order_acquire)) {
+            capturePrintFrame(jpeg, decoder);
+            printRequested = false;
+            loopWake.notify();
+            continue;
+        }
+
+        // no free frame or a failed capture: back off
+        if (capturePaused.load() || !preview::captureNext(jpeg, decoder)) pipeline::sleepMs(1);
+    }
 }
 
-void fbToMat(camera_fb_t* fb, Matrix<PIXELFORMAT_RGB>& mat) {
-    if (fb->width != mat.width() || fb->height != mat.height())
-        throw std::runtime_error("[Error] Invalid size");
+// Stream the print capture to the print task band by band, a few rows per loop() so the preview keeps running
+void advanceCapturedPrint() {
+    if (!printStream.isOpen() && printStreamRow == 0) {
+        // the print is kept in the gallery when there is an SD card
+        if (!printStream.open(printGrayscale.width(), 0.5f, filtering::EFilteringMethod::floydSteinberg, gallery::ready())) return; // queue full, retry on the next loop
+        log_d("print %ux%u -- capture: %lld us; time to stream: %lld us",
+            printGrayscale.width(), printGrayscale.height(), printCapturedUs - printRequestUs, esp_timer_get_time() - printRequestUs);
+    }
+
+    const size_t endRow = std::min(printStreamRow + PRINT_BAND_ROWS, printGrayscale.height());
+    for (; printStreamRow < endRow; ++printStreamRow) {
+        if (!printStream.writeRow(printGrayscale.data() + printStreamRow * printGrayscale.width())) return; // every band is in flight
+    }
 
-    // Load img and store it into our buffer
-    if(!fmt2rgb888(fb->buf, fb->len, fb->format, (uint8_t*)mat.begin())) 
-        throw std::runtime_error("[Error] getImageMatrixFromJPEGBuffer: conversion to rgb888 failed.");
+    if (printStreamRow < printGrayscale.height() || !printStream.close()) return;
+
+    printStreamRow = 0;
+    printFrameReady.store(false, std::memory_order_release);
 }
 
 void setup() {
@@ -93,17 +192,25 @@ void setup() {
 
     //Serial.begin(115200);
 
-    Serial.begin(9600, SERIAL_8N1);
+    printerSettings.baud = PRINTER_BAUD;
+    Serial.begin(printerSettings.baud, SERIAL_8N1);
+#if defined(LOG_TX_PIN)
+    Serial1.begin(LOG_BAUD, SERIAL_8N1, -1, LOG_TX_PIN); // no RX pin
+    Serial1.setDebugOutput(true); // log_* and the driver logs follow the last UART given the debug output
+#elif !defined(POLARPICS_BENCH)
+    Serial.setDebugOutput(false); // UART0 is the printer line, the driver logs must not reach it
+#endif
 
     //printerSerial.begin(9600, SERIAL_8N1, 2, 14);
-    printer.begin();
 
-    delay(WAIT);
+#ifdef POLARPICS_BENCH
+    bench::run();
+    for (;;) delay(1000); // benchmark build, the application never starts
+#endif
 
-    // pinMode(33, OUTPUT); // blink pin
     pinMode(BUTTON_PIN, INPUT);
 
-    grayscale = Matrix<uint8_t>(320, 240);
+    preview::init(&loopWake);
     // ditherMat = PrinterMatrix(320, 240);
 
     bool psramFoundValue = psramFound();
@@ -130,37 +237,11 @@ void setup() {
     config.pin_reset = RESET_GPIO_NUM;
     config.xclk_freq_hz = 20000000;
     config.pixel_format = PIXFORMAT_JPEG;
-    config.frame_size = psramFoundValue ? FRAMESIZE_UXGA : FRAMESIZE_SVGA;
+    printFramesize = psramFoundValue ? PRINT_FRAMESIZE : PRINT_FRAMESIZE_NO_PSRAM;
+    config.frame_size = printFramesize;
     config.jpeg_quality = psramFoundValue ? 10 : 12;
     config.fb_count = psramFoundValue ? size_t(2): size_t(1);
     //init with high specs to pre-allocate larger buffers
-    // // camera pin configuration
-    // const camera_config_t config = {
-    //   PWDN_GPIO_NUM, // pin_pwdn
-    //   RESET_GPIO_NUM, // pin_reset
-    //   XCLK_GPIO_NUM, // pin_xclk
-    //   SIOD_GPIO_NUM, // pin_sscb_sda
-    //   SIOC_GPIO_NUM, // pin_sscb_scl
-    //   Y9_GPIO_NUM, // pin_d7
-    //   Y8_GPIO_NUM, // pin_d6
-    //   Y7_GPIO_NUM, // pin_d5
-    //   Y6_GPIO_NUM, // pin_d4
-    //   Y5_GPIO_NUM, // pin_d3
-    //   Y4_GPIO_NUM, // pin_d2
-    //   Y3_GPIO_NUM, // pin_d1
-    //   Y2_GPIO_NUM, // pin_d0
-    //   VSYNC_GPIO_NUM, // pin_vsync
-    //   HREF_GPIO_NUM, // pin_href
-    //   PCLK_GPIO_NUM, // pin_pclk
-    //   20000000, // xclk_freq_hz // 20000000
-    //   LEDC_TIMER_0, // ledc_timer
-    //   LEDC_CHANNEL_0, // ledc_channel
-    //   PIXFORMAT_RGB565, // pixel_format // PIXFORMAT_ + YUV422|GRAYSCALE|RGB565|RGB888|JPEG
-    //   // Init with high specs to pre-allocate larger buffers 
-    //   FRAMESIZE_QVGA, // frame_size // FRAMESIZE_ + QVGA|CIF|VGA|SVGA|XGA|SXGA|UXGA
-    //   12, // jpeg_quality - 0-63 lower number means higher quality.
-    //   2 // fb_count - number of frame buffers to be allocated. (if more than one, i2s runs in continuous mode. Use only with JPEG)
-    // };
 
     // camera init
     esp_err_t err = esp_camera_init(&config);
@@ -170,7 +251,7 @@ void setup() {
     }
 
     s = esp_camera_sensor_get();
-    s->set_framesize(s, FRAMESIZE_QVGA); //drop down frame size for higher initial frame rate
+    capture::init(s, preview::framesize()); //drop down frame size for higher preview frame rate
     //initial sensors are flipped vertically and colors are a bit saturated
     if (s->id.PID == OV3660_PID) {
         s->set_vflip(s, 1);//flip it back
@@ -186,141 +267,296 @@ void setup() {
     tft.setTextSize(1);
     
     utils::logMemory();
+    allocguard::watchCurrentTask();
+    memory::setAlarm(memory::EHeap::psram, PSRAM_BUDGET);
+
+    gallery::init(); // before the print task, which writes the entries
+
+    if (!printing::init(Serial, printerSettings))
+        log_e("setup: print task creation failed");
+
+    lastInputUs = esp_timer_get_time();
+    stateReportUs = lastInputUs;
+
+#ifdef POLARPICS_SERVER
+    {
+        size_t maxWidth = 0, maxHeight = 0;
+        for (const governor::QualityLevel& level : previewLevels) {
+            maxWidth = std::max(maxWidth, level.width);
+            maxHeight = std::max(maxHeight, level.height);
+        }
+        if (!server::start(maxWidth, maxHeight))
+            log_e("setup: preview server start failed");
+    }
+#endif
+
+    if (!buttons::start(BUTTON_PIN, BUTTON_CORE, &loopWake))
+        log_e("setup: button sampler creation failed");
+
+    if (!pipeline::startTask("capture", captureTask, nullptr, CAPTURE_TASK_STACK, CAPTURE_TASK_PRIORITY, CAPTURE_CORE))
+        log_e("setup: capture task creation failed");
 
-    // for (size_t i = 0; i < 4; i++) {
-    //     digitalWrite(33, HIGH); //Turn off
-    //     delay (50); //Wait 1 sec
-    //     digitalWrite(33, LOW); //Turn on
-    //     delay (50); //Wait 1 sec
-    // }
     //Serial.printf("setup done.");
 }
 
-size_t buttonMap(size_t value) {
-    const size_t TheoricalBtnValues[4] = {730, 1360, 2500, 4050};
-    size_t margin = 200;
+void enterState(const EState next) {
+    if (next == state) return;
+    preview::restartWarmUp();
+    log_d("state: %s -> %s", stateToString(state), stateToString(next));
 
-    for (size_t i = 0; i < 4; ++i) {
-        if(value > (TheoricalBtnValues[i] - margin) && value < (TheoricalBtnValues[i] + margin)) return i+1;
+    if (state == stateIdle) {
+        tft.writecommand(TFT_SLPOUT);
+        delay(120); // the controller needs 120 ms after a sleep out
+        tft.writecommand(TFT_DISPON);
     }
-    
-    return 0;
+
+    switch (next) {
+        case stateMenu:
+            needDrawMenu = true;
+            break;
+        case stateIdle:
+            tft.writecommand(TFT_DISPOFF);
+            tft.writecommand(TFT_SLPIN);
+            break;
+        default:
+            break;
+    }
+
+    capturePaused = next == stateMenu || next == stateIdle;
+    state = next;
 }
 
-void buttonsActions(const size_t btnValue) {
-    size_t btnId = buttonMap(btnValue);
-
-    if(lockBtn == 0) {
-        switch (btnId) {
-            case 1: // enter
-                if(menuOpen) {
-                    optionSelected = !optionSelected;
-                }else {
-                    menuOpen = true;
-                }
+void requestPrint(const int64_t requestUs) {
+    // back-pressure: no new capture while the print queue is full
+    if (printing::full()) {
+        log_d("print queue full (%u jobs)", printing::pending());
+        return;
+    }
+
+    printRequestUs = requestUs;
+    printRequested = true;
+    enterState(statePrinting);
+}
+
+// print the latest gallery entry again, straight from the SD card
+void reprintLast() {
+    gallery::Entry entry;
+    if (!gallery::entry(gallery::count() - 1, entry)) {
+        log_d("reprint: the gallery is empty");
+        return;
+    }
+    if (!printing::reprint(entry.id)) log_d("print queue full (%u jobs)", printing::pending());
+}
+
+void menuActions(const buttons::Event& event) {
+    const bool pressed = event.kind == buttons::EEventKind::press;
+    const bool scroll = pressed || event.kind == buttons::EEventKind::repeat;
+
+    switch (event.button) {
+        case buttons::buttonEnter:
+            if (!pressed) break;
+            optionSelected = !optionSelected;
+            needDrawMenu = true;
+            break;
+
+        case buttons::buttonBack:
+            if (!pressed) break;
+            if(optionSelected) {
+                optionSelected = false;
                 needDrawMenu = true;
-                break;
-            
-            case 2: // back
-                if(menuOpen) {
-                    if(optionSelected) {
-                        optionSelected = false;
-                    }else {
-                        menuOpen = false;
-                    }
-                    needDrawMenu = true;
-                }
-                break;
-
-            case 3: // left
-                if(menuOpen) {
-                    if(optionSelected) {
-                        optionsValuesIdx[selectedOption] = utils::saveModulo(optionsValuesIdx[selectedOption] + 1, menu::availableValuesByOptions[selectedOption].size());
-                        menu::setOption(s, selectedOption, menu::availableValuesByOptions[selectedOption][optionsValuesIdx[selectedOption]].second);
-                    } else {
-                        selectedOption = utils::saveModulo(selectedOption + 1, menu::availableValuesByOptions.size());
-                    }
-                    needDrawMenu = true;
-                }else {
-                    PrinterMatrix dithered = filtering::errorDiffusionPrinter(grayscale);
-                    printImg(dithered, printer);
-                }
-                break;
-            case 4: // right
-                if(menuOpen) {
-                    if(optionSelected) {
-                        optionsValuesIdx[selectedOption] = utils::saveModulo(optionsValuesIdx[selectedOption] - 1, menu::availableValuesByOptions[selectedOption].size());
-
-                        menu::setOption(s, selectedOption, menu::availableValuesByOptions[selectedOption][optionsValuesIdx[selectedOption]].second);
-                    } else {
-                        selectedOption = utils::saveModulo(selectedOption - 1, menu::availableValuesByOptions.size());
-                    }
-                    needDrawMenu = true;
-                }
-                
-                break;
-            default:
-                break;
-        }
-        lockBtn = lockIteration;
-    }else {
-        --lockBtn;
+            }else {
+                enterState(statePreview);
+            }
+            break;
+
+        case buttons::buttonLeft:
+            if (!scroll) break;
+            if(optionSelected) {
+                optionsValuesIdx[selectedOption] = utils::saveModulo(optionsValuesIdx[selectedOption] + 1, menu::options[selectedOption].count);
+                menu::setOption(s, selectedOption, optionsValuesIdx[selectedOption]);
+            } else {
+                selectedOption = utils::saveModulo(selectedOption + 1, menu::options.size());
+            }
+            needDrawMenu = true;
+            break;
+
+        case buttons::buttonRight:
+            if (!scroll) break;
+            if(optionSelected) {
+                optionsValuesIdx[selectedOption] = utils::saveModulo(optionsValuesIdx[selectedOption] - 1, menu::options[selectedOption].count);
+
+                menu::setOption(s, selectedOption, optionsValuesIdx[selectedOption]);
+            } else {
+                selectedOption = utils::saveModulo(selectedOption - 1, menu::options.size());
+            }
+            needDrawMenu = true;
+            break;
+
+        default:
+            break;
     }
 }
 
-void loop() {
-    
-    buttonsValue = analogRead(BUTTON_PIN);
-    buttonsActions(buttonsValue);
+#ifdef POLARPICS_TRACE
+// the trace goes out on UART0, the printer line: nothing is dumped while a print is on its way to the printer
+bool traceDumpAllowed() { return state != statePrinting && !printing::busy(); }
+
+// A long press on enter / back dumps the trace: the press of these two waits for the release, so the dump doesn't
+// open or leave the menu first. The release acts as the press, unless the long press came in between.
+bool traceLongPressed = false;
+
+// false when the event is swallowed, otherwise action is what the state machine gets
+bool traceButtons(const buttons::Event& event, buttons::Event& action) {
+    action = event;
+    if (event.button != buttons::buttonEnter && event.button != buttons::buttonBack) return true;
+
+    switch (event.kind) {
+        case buttons::EEventKind::press:
+            traceLongPressed = false;
+            return false;
+        case buttons::EEventKind::longPress:
+            if (!traceDumpAllowed()) return false; // the release still acts, back cancels the print
+            traceLongPressed = true;
+            if (event.button == buttons::buttonEnter) trace::dump();
+            else trace::exportChromeTrace();
+            return false;
+        case buttons::EEventKind::release:
+            if (traceLongPressed) return false;
+            action.kind = buttons::EEventKind::press;
+            return true;
+        default:
+            return true;
+    }
+}
+#endif
+
+// Events come from the sampler task: press for single actions, repeat to scroll through the menu while held
+void buttonsActions(const buttons::Event& received) {
+    lastInputUs = received.timeUs;
+#ifdef POLARPICS_TRACE
+    buttons::Event event;
+    if (!traceButtons(received, event)) return;
+#else
+    const buttons::Event& event = received;
+#endif
+    if (event.kind != buttons::EEventKind::press && state != stateMenu) return;
+
+    switch (state) {
+        case statePreview:
+            if (event.button == buttons::buttonEnter) enterState(stateMenu);
+            else if (event.button == buttons::buttonBack) printing::cancel();
+            else if (event.button == buttons::buttonLeft) requestPrint(event.timeUs);
+            else if (event.button == buttons::buttonRight) reprintLast();
+            break;
+
+        case stateMenu:
+            menuActions(event);
+            break;
+
+        case statePrinting:
+            // the capture is streamed whatever happens, cancelling drops the rows left
+            if (event.button == buttons::buttonBack) printing::cancel();
+            break;
+
+        case stateIdle:
+            // the press only wakes the device up
+            enterState(statePreview);
+            break;
+
+        default:
+            break;
+    }
+}
 
-    if(menuOpen) {
-        if(needDrawMenu) {
-            menu::drawMenu(tft, selectedOption, optionSelected, optionsValuesIdx);
-            needDrawMenu = false;
-        }
-    } else {
-        
-        // random noise
-        for (size_t i = 0; i < grayscale.len(); ++i) {
-            grayscale(i) = static_cast<uint8_t>(std::rand());
-        }
+// preview::DisplayFn of loop()
+void drawPreview(const PrinterMatrix& dithered, const size_t displayScale, void*) {
+    utils::drawGrayScale(tft, 0, 0, dithered, displayScale);
+    printing::drawBusyIndicator(tft);
+#ifdef POLARPICS_SERVER
+    server::publish(dithered); // copy of the packed bits, sent by the stream task
+#endif
+}
+
+// Dither and display the next preview frame if the capture task has one
+void updatePreview() {
+    preview::update(drawPreview, nullptr, state == statePreview);
+}
 
-        delay(WAIT);
+void updatePrinting() {
+    if (printFrameReady.load(std::memory_order_acquire)) advanceCapturedPrint();
 
-        camera_fb_t* fb = esp_camera_fb_get();
-        // esp_err_t res = ESP_OK;
-        // int64_t fr_start = esp_timer_get_time();
+    // done once the capture is streamed, or when it failed
+    if (!printRequested.load() && !printFrameReady.load(std::memory_order_acquire)) enterState(statePreview);
+}
 
-        //Serial.printf("[esp_camera_fb_get] pointer value: %p\n", fb);
-        if (fb == nullptr) {
-            //Serial.printf("Camera capture failed\n");
-        } else {
-            //Serial.printf("success: buffer size: (%d, %d)\n",fb->width, fb->height);
+// how long loop() may block before its next pass, any input or new frame wakes it earlier
+uint32_t waitMs() {
+    switch (state) {
+        case statePreview: return !preview::ready() ? 100 : 0;
+        case statePrinting: return !preview::ready() ? 5 : 0; // bands are freed by the printer without notification
+        default: return 1000; // idle timeout check
+    }
+}
 
-            Matrix<PIXELFORMAT_RGB> mat(fb->width, fb->height);
-            //Serial.printf("buffer size: (%d, %d)\n",fb->width, fb->height);
+void reportStateUsage(const int64_t now) {
+    if (now - stateReportUs < STATE_REPORT_US) return;
+    allocguard::Pause pause;
 
-            fbToMat(fb, mat);
-            //Serial.printf("fbToMat");
+    for (size_t i = 0; i < stateCount; ++i) {
+        const StateUsage& usage = stateUsage[i];
+        if (usage.totalUs == 0) continue;
+        log_d("cpu core %d in %s: %.1f%% of %lld ms", pipeline::currentCore(), stateToString(static_cast<EState>(i)),
+            100.f * usage.busyUs / usage.totalUs, usage.totalUs / 1000);
+    }
+    stateUsage = {};
+    stateReportUs = now;
 
-            // grayscale = utils::GrayRescaled(mat, 2.f);
-            grayscale = filtering::convertToGrayscale(mat);
-            // utils::logMemory();
-        }
-        //Serial.printf("[esp_camera_fb_return]");
-        esp_camera_fb_return(fb);
-        
-        // ditherMat = filtering::errorDiffusionPrinter(grayscale, 0.5f);
-        // utils::drawGrayScale(tft, 0, 0, grayscale);
-
-        PrinterMatrix dithered = filtering::errorDiffusionPrinter(grayscale);
-        utils::drawGrayScale(tft, 0, 0, dithered);
-        
-       delay(WAIT);
+    memory::report();
+}
+
+void loop() {
+    const EState passState = state;
+    const int64_t passStart = esp_timer_get_time();
+
+    buttons::Event event;
+    while (buttons::poll(event)) {
+        allocguard::Pause pause; // user actions are not the steady state
+        buttonsActions(event);
     }
+#ifdef POLARPICS_BUTTON_RECORD
+    if (buttons::recordingReady()) {
+        allocguard::Pause pause;
+        buttons::dumpRecording(Serial1); // raw ADC take of the ladder, a trace for host/test/data/buttons
+    }
+#endif
+
+    switch (state) {
+        case statePreview:
+            updatePreview();
+            break;
+        case statePrinting:
+            updatePreview();
+            updatePrinting();
+            break;
+        case stateMenu:
+            if(needDrawMenu) {
+                TRACE_SCOPE(stageMenu, 0);
+                menu::drawMenu(tft, selectedOption, optionSelected, optionsValuesIdx);
+                needDrawMenu = false;
+            }
+            break;
+        default:
+            break;
+    }
+
+    const int64_t busyEnd = esp_timer_get_time();
+    if ((state == statePreview || state == stateMenu) && !printing::busy() && busyEnd - lastInputUs > IDLE_TIMEOUT_MS * 1000LL)
+        enterState(stateIdle);
+
+    loopWake.wait(waitMs());
 
-    // display input
-    tft.setTextColor(TFT_BLUE, TFT_WHITE);
-    tft.drawNumber(buttonsValue, 100, tft.fontHeight(4), 4);
-    tft.drawNumber(buttonMap(buttonsValue), 100, tft.fontHeight(4)*3, 4);
+    const int64_t now = esp_timer_get_time();
+    stateUsage[passState].busyUs += busyEnd - passStart;
+    stateUsage[passState].totalUs += now - passStart;
+    reportStateUsage(now);
 }
@@ -1,9 +1,7 @@
 #pragma once
 
-#include <string>
 #include <array>
-#include <string>
-#include <vector>
+#include <cstddef>
 
 #include "esp_camera.h" // Cam
 #include <TFT_eSPI.h> // Graphics and font library for ILI9341 driver chip
@@ -32,38 +30,116 @@
 #define CAM_OPTION_DCW  20
 #define CAM_OPTION_COLORBAR  21
 
+#define CAM_OPTIONS_COUNT  22
+
 namespace menu {
-    
-    static const std::array<std::vector<std::pair<std::string, int>>, 22> availableValuesByOptions {{ 
-        {{"-2", -2}, {"-1", -1}, {"0", 0}, {"1", 1}, {"2", 2}}, // brightness (-2 to 2)
-        {{"-2", -2}, {"-1", -1}, {"0", 0}, {"1", 1}, {"2", 2}}, // contrast (-2 to 2)
-        {{"-2", -2}, {"-1", -1}, {"0", 0}, {"1", 1}, {"2", 2}}, // saturation (-2 to 2)
-        {{"No Effect", 0}, {"Negative", 1}, {"Grayscale", 2}, {"Red Tint", 3}, {"Green Tint", 4}, {"Blue Tint", 5}, {"Sepia", 6}}, // special_effect (0 - No Effect, 1 - Negative, 2 - Grayscale, 3 - Red Tint, 4 - Green Tint, 5 - Blue Tint, 6 - Sepia)
-        {{"disable", 0}, {"enable", 1}}, // whitebal (0 = disable , 1 = enable)
-        {{"disable", 0}, {"enable", 1}}, // awb_gain // 0 = disable , 1 = enable)
-        {{"Auto", 0}, {"Sunny", 1}, {"Cloudy", 2}, {"Office", 3}, {"Home", 4}}, // wb_mod if awb_gain enabled (0 - Auto, 1 - Sunny, 2 - Cloudy, 3 - Office, 4 - Home)
-        {{"disable", 0}, {"enable", 1}}, // exposure_ctrl (0 = disable , 1 = enable)
-        {{"disable", 0}, {"enable", 1}}, // aec2 (0 = disable , 1 = enable)
-        {{"-2", -2}, {"-1", -1}, {"0", 0}, {"1", 1}, {"2", 2}}, // ae_level (-2 to 2)
-        {{"0", 0}, {"100", 100}, {"200", 200}, {"300", 300}, {"400", 400}, {"500", 500}, {"600", 600}, {"700", 700}, {"800", 800}, {"900", 900}, {"1000", 1000}, {"1100", 1100}, {"1200", 1200}}, // aec_value (0 to 1200)
-        {{"disable", 0}, {"enable", 1}}, // gain_ctrl (0 = disable , 1 = enable)
-        {{"0", 0}, {"3", 3}, {"6", 6}, {"9", 9}, {"12", 12}, {"15", 15}, {"18", 18}, {"21", 21}, {"24", 24}, {"27", 27}, {"30", 30}}, // agc_gain (0 to 30)
-        {{"x2", 0}, {"x4", 1}, {"x8", 2}, {"x16", 3}, {"x32", 4}, {"x64", 5}, {"x128", 6}}, // gainceiling (0 - x2, 1 - x4, 2 - x8, 3 - x16, 4 - x32, 5 - x64, 6 - x128)
-        {{"disable", 0}, {"enable", 1}}, // bpc (0 = disable , 1 = enable)
-        {{"disable", 0}, {"enable", 1}}, // wpc (0 = disable , 1 = enable)
-        {{"disable", 0}, {"enable", 1}}, // raw_gma (0 = disable , 1 = enable)
-        {{"disable", 0}, {"enable", 1}}, // lenc (0 = disable , 1 = enable)
-        {{"disable", 0}, {"enable", 1}}, // hmirror (0 = disable , 1 = enable)
-        {{"disable", 0}, {"enable", 1}}, // vflip (0 = disable , 1 = enable)
-        {{"disable", 0}, {"enable", 1}}, // dcw (0 = disable , 1 = enable)
-        {{"disable", 0}, {"enable", 1}} // colorbar (0 = disable , 1 = enable)
+
+    // Everything below is constexpr so the tables end up in flash (.rodata) and nothing is built at boot.
+    typedef int (*SensorSetter)(sensor_t* s, int value);
+
+    struct OptionDescriptor {
+        const char* name;
+        const char* const* labels;
+        const int* values;
+        size_t count;
+        SensorSetter setter;
+
+        constexpr const char* label(const size_t idx) const { return labels[idx]; }
+        constexpr int value(const size_t idx) const { return values[idx]; }
+    };
+
+    template <typename T, size_t N>
+    constexpr size_t countOf(const T (&)[N]) { return N; }
+
+    namespace values {
+        constexpr const char* levelLabels[] = {"-2", "-1", "0", "1", "2"};
+        constexpr int levels[] = {-2, -1, 0, 1, 2};
+
+        constexpr const char* toggleLabels[] = {"disable", "enable"};
+        constexpr int toggles[] = {0, 1};
+
+        constexpr const char* specialEffectLabels[] = {"No Effect", "Negative", "Grayscale", "Red Tint", "Green Tint", "Blue Tint", "Sepia"};
+        constexpr int specialEffects[] = {0, 1, 2, 3, 4, 5, 6};
+
+        constexpr const char* wbModeLabels[] = {"Auto", "Sunny", "Cloudy", "Office", "Home"};
+        constexpr int wbModes[] = {0, 1, 2, 3, 4};
+
+        constexpr const char* aecValueLabels[] = {"0", "100", "200", "300", "400", "500", "600", "700", "800", "900", "1000", "1100", "1200"};
+        constexpr int aecValues[] = {0, 100, 200, 300, 400, 500, 600, 700, 800, 900, 1000, 1100, 1200};
+
+        constexpr const char* agcGainLabels[] = {"0", "3", "6", "9", "12", "15", "18", "21", "24", "27", "30"};
+        constexpr int agcGains[] = {0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30};
+
+        constexpr const char* gainCeilingLabels[] = {"x2", "x4", "x8", "x16", "x32", "x64", "x128"};
+        constexpr int gainCeilings[] = {0, 1, 2, 3, 4, 5, 6};
+    }
+
+    namespace setters {
+        // sensor_t exposes plain function pointers, wrap them so every option shares the same signature
+        #define MENU_SENSOR_SETTER(field) inline int field(sensor_t* s, int value) { return s->field(s, value); }
+        MENU_SENSOR_SETTER(set_brightness)
+        MENU_SENSOR_SETTER(set_contrast)
+        MENU_SENSOR_SETTER(set_saturation)
+        MENU_SENSOR_SETTER(set_special_effect)
+        MENU_SENSOR_SETTER(set_whitebal)
+        MENU_SENSOR_SETTER(set_awb_gain)
+        MENU_SENSOR_SETTER(set_wb_mode)
+        MENU_SENSOR_SETTER(set_exposure_ctrl)
+        MENU_SENSOR_SETTER(set_aec2)
+        MENU_SENSOR_SETTER(set_ae_level)
+        MENU_SENSOR_SETTER(set_aec_value)
+        MENU_SENSOR_SETTER(set_gain_ctrl)
+        MENU_SENSOR_SETTER(set_agc_gain)
+        MENU_SENSOR_SETTER(set_bpc)
+        MENU_SENSOR_SETTER(set_wpc)
+        MENU_SENSOR_SETTER(set_raw_gma)
+        MENU_SENSOR_SETTER(set_lenc)
+        MENU_SENSOR_SETTER(set_hmirror)
+        MENU_SENSOR_SETTER(set_vflip)
+        MENU_SENSOR_SETTER(set_dcw)
+        MENU_SENSOR_SETTER(set_colorbar)
+        #undef MENU_SENSOR_SETTER
+
+        inline int set_gainceiling(sensor_t* s, int value) { return s->set_gainceiling(s, gainceiling_t(value)); }
+    }
+
+    #define MENU_OPTION(name, labelsArray, valuesArray, setter) OptionDescriptor{name, values::labelsArray, values::valuesArray, countOf(values::valuesArray), setters::setter}
+
+    // indexed by CAM_OPTION_*
+    constexpr std::array<OptionDescriptor, CAM_OPTIONS_COUNT> options {{
+        MENU_OPTION("brightness", levelLabels, levels, set_brightness), // (-2 to 2)
+        MENU_OPTION("contrast", levelLabels, levels, set_contrast), // (-2 to 2)
+        MENU_OPTION("saturation", levelLabels, levels, set_saturation), // (-2 to 2)
+        MENU_OPTION("special effect", specialEffectLabels, specialEffects, set_special_effect),
+        MENU_OPTION("white balance", toggleLabels, toggles, set_whitebal),
+        MENU_OPTION("awb gain", toggleLabels, toggles, set_awb_gain),
+        MENU_OPTION("wb_mode", wbModeLabels, wbModes, set_wb_mode), // if awb_gain enabled
+        MENU_OPTION("exposure_ctrl", toggleLabels, toggles, set_exposure_ctrl),
+        MENU_OPTION("aec2", toggleLabels, toggles, set_aec2),
+        MENU_OPTION("ae_level", levelLabels, levels, set_ae_level), // (-2 to 2)
+        MENU_OPTION("aec_value", aecValueLabels, aecValues, set_aec_value), // (0 to 1200)
+        MENU_OPTION("gain_ctrl", toggleLabels, toggles, set_gain_ctrl),
+        MENU_OPTION("agc_gain", agcGainLabels, agcGains, set_agc_gain), // (0 to 30)
+        MENU_OPTION("gainceiling", gainCeilingLabels, gainCeilings, set_gainceiling),
+        MENU_OPTION("bpc", toggleLabels, toggles, set_bpc),
+        MENU_OPTION("wpc", toggleLabels, toggles, set_wpc),
+        MENU_OPTION("raw_gma", toggleLabels, toggles, set_raw_gma),
+        MENU_OPTION("lenc", toggleLabels, toggles, set_lenc),
+        MENU_OPTION("hmirror", toggleLabels, toggles, set_hmirror),
+        MENU_OPTION("vflip", toggleLabels, toggles, set_vflip),
+        MENU_OPTION("dcw", toggleLabels, toggles, set_dcw),
+        MENU_OPTION("colorbar", toggleLabels, toggles, set_colorbar)
     }};
 
-    const std::string optionToString(int option);
+    #undef MENU_OPTION
+
+    typedef std::array<size_t, CAM_OPTIONS_COUNT> OptionsValuesIdx;
+
+    const char* optionToString(const size_t option);
 
-    void setOption(sensor_t* s, int option, int value);
+    void setOption(sensor_t* s, const size_t option, const size_t valueIdx);
 
-    std::string optionValueToString(int option, int value);
+    const char* optionValueToString(const size_t option, const size_t valueIdx);
 
-    void drawMenu(TFT_eSPI& tft, const size_t selectedOption, bool optionSelected, const std::array<size_t, 22>& optionsValuesIdx);
-}
\ No newline at end of file
+    void drawMenu(TFT_eSPI& tft, const size_t selectedOption, bool optionSelected, const OptionsValuesIdx& optionsValuesIdx);
+}
@@ -0,0 +1,159 @@
+#include "preview.hpp"
+
+#include <array>
+#include <atomic>
+
+#include "esp32-hal-log.h"
+#include "esp_timer.h"
+
+#include "AllocGuard.h"
+#include "Matrix.h"
+#include "SpscRing.h"
+#include "filtering.h"
+#include "trace.h"
+
+namespace preview {
+
+    namespace {
+        struct Frame {
+            Matrix<uint8_t> grayscale;
+            size_t level; // index in previewLevels
+            size_t id;
+            int64_t capturedUs;
+            governor::StageTimes times;
+        };
+
+        std::array<Frame, PREVIEW_FRAME_COUNT> frames;
+        pipeline::SpscRing<Frame*, PREVIEW_FRAME_COUNT> freeFrames; // loop() -> capture task
+        pipeline::SpscRing<Frame*, PREVIEW_FRAME_COUNT> readyFrames; // capture task -> loop()
+        pipeline::Signal* readyWake = nullptr;
+
+        // capture side
+        Frame* pending = nullptr; // popped from freeFrames, kept across failed captures
+        size_t nextId = 0;
+
+        // level the capture task has to use, written by loop() from the governor
+        std::atomic<size_t> requestedLevel {PREVIEW_INITIAL_LEVEL};
+
+        // loop() side
+        governor::Governor levelGovernor(previewLevels, PREVIEW_LEVEL_COUNT, PREVIEW_TARGET_FPS, PREVIEW_INITIAL_LEVEL);
+        PrinterMatrix dithered {memory::EOwner::dither}; // reused, only reallocated when the preview size changes
+        size_t steadyFrames = 0; // frames since the last change, the allocation guard is armed after the warm-up
+        int64_t latencyUs = 0;
+
+        capture::FpsCounter fps;
+        int64_t latencySumUs = 0;
+        size_t latencyFrames = 0;
+
+        // Grab, decode and convert one frame at the requested level
+        bool captureFrame(Frame& frame, capture::Frame& jpeg, jpeg::GrayDecoder& decoder) {
+            const size_t levelIdx = requestedLevel.load();
+            const governor::QualityLevel& level = previewLevels[levelIdx];
+
+            int64_t stageStart = esp_timer_get_time();
+            if (!capture::grabLatest(static_cast<framesize_t>(level.framesize), jpeg)) return false;
+
+            // latency is measured from the sensor timestamp, the time spent in the driver queue counts
+            frame.capturedUs = jpeg.capturedUs;
+            int64_t now = esp_timer_get_time();
+            frame.times.us[governor::stageCapture] = now - stageStart;
+            TRACE_RECORD(stageCapture, stageStart, now, frame.id);
+            stageStart = now;
+
+            // the decode writes grayscale rows at the level size, the conversion has no stage of its own anymore.
+            // A sensor mode larger than the level is decoded at a reduced DCT scale.
+            if (!decoder.decode(jpeg.data.data(), jpeg.data.size(), frame.grayscale, level.width, level.height)) return false;
+            now = esp_timer_get_time();
+            frame.times.us[governor::stageDecode] = now - stageStart;
+            frame.times.us[governor::stageGrayscale] = 0;
+            TRACE_RECORD(stageDecode, stageStart, now, frame.id);
+
+            frame.level = levelIdx;
+            return true;
+        }
+    }
+
+    void init(pipeline::Signal* wake) {
+        readyWake = wake;
+        for (Frame& frame : frames) {
+            frame.grayscale = Matrix<uint8_t>(levelGovernor.level().width, levelGovernor.level().height, memory::EOwner::frame);
+            freeFrames.push(&frame);
+        }
+    }
+
+    bool captureNext(capture::Frame& jpeg, jpeg::GrayDecoder& decoder) {
+        if (pending == nullptr && !freeFrames.pop(pending)) return false;
+
+        pending->id = nextId;
+        if (!captureFrame(*pending, jpeg, decoder)) return false;
+
+        ++nextId;
+        readyFrames.push(pending); // can't fail, at most PREVIEW_FRAME_COUNT frames are in flight
+        TRACE_COUNTER(counterReadyFrames, readyFrames.size());
+        pending = nullptr;
+        if (readyWake != nullptr) readyWake->notify();
+        return true;
+    }
+
+    bool update(DisplayFn display, void* arg, const bool mayArm) {
+        Frame* frame = nullptr;
+        if (!readyFrames.pop(frame)) return false;
+        TRACE_COUNTER(counterReadyFrames, readyFrames.size());
+
+        const governor::QualityLevel& level = previewLevels[frame->level];
+
+        int64_t stageStart = esp_timer_get_time();
+        filtering::errorDiffusionPrinter(frame->grayscale, dithered, 0.5f, level.method);
+        int64_t now = esp_timer_get_time();
+        frame->times.us[governor::stageDither] = now - stageStart;
+        TRACE_RECORD(stageDither, stageStart, now, frame->id);
+        stageStart = now;
+
+        display(dithered, level.displayScale, arg);
+        now = esp_timer_get_time();
+        frame->times.us[governor::stageDisplay] = now - stageStart;
+        TRACE_RECORD(stageDisplay, stageStart, now, frame->id);
+
+        latencyUs = now - frame->capturedUs;
+        latencySumUs += latencyUs;
+        ++latencyFrames;
+
+        // the governor only judges frames produced with its current level
+        bool levelChanged = false;
+        {
+            allocguard::Pause pause; // level changes are logged
+            levelChanged = frame->level == levelGovernor.levelIndex() && levelGovernor.update(frame->times);
+        }
+        if (levelChanged) {
+            restartWarmUp(); // before the capture task sees the new level and resizes its buffers
+            requestedLevel = levelGovernor.levelIndex();
+        }
+
+        freeFrames.push(frame);
+
+        if (mayArm && ++steadyFrames == ALLOC_GUARD_WARMUP_FRAMES) allocguard::arm();
+
+        if (fps.tick(now)) {
+            allocguard::Pause pause; // log_d formats long lines and floats on the heap
+            log_d("preview %zux%zu: %.1f fps; capture to display latency: %lld us (dropped frames: %zu wrong size, %zu stale)",
+                level.width, level.height, fps.fps(), static_cast<long long>(latencySumUs / static_cast<int64_t>(latencyFrames)),
+                capture::droppedFrames(), capture::staleFrames());
+            latencySumUs = 0;
+            latencyFrames = 0;
+        }
+        return true;
+    }
+
+    void restartWarmUp() {
+        allocguard::disarm();
+        steadyFrames = 0;
+    }
+
+    framesize_t framesize() { return static_cast<framesize_t>(previewLevels[requestedLevel.load()].framesize); }
+
+    bool ready() { return !readyFrames.empty(); }
+
+    const governor::Governor& governorState() { return levelGovernor; }
+
+    int64_t lastLatencyUs() { return latencyUs; }
+}
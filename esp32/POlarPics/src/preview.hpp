@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_camera.h" // Cam
+
+#include "PrinterMatrix.h"
+#include "Signal.h"
+#include "capture.hpp"
+#include "governor.h"
+#include "jpeg.hpp"
+#include "previewLevels.hpp"
+
+// Live preview, capture task (core 0) -> loop() (core 1): preview frames are recycled through two lock-free rings.
+// The capture side grabs and decodes at the level requested by the governor, the loop() side dithers, displays and feeds
+// the governor. Shared by main.cpp and the host builds (host/test/allocGuardTest.cpp, host/bench/previewBench.cpp).
+namespace preview {
+
+    #define PREVIEW_FRAME_COUNT 3 // frames in flight between the two sides
+
+    // Draws the dithered frame, displayScale is the one of its level. Called by update(), timed as the display stage.
+    typedef void (*DisplayFn)(const PrinterMatrix& dithered, const size_t displayScale, void* arg);
+
+    // Frames allocated at the initial level size, wake is notified each time a frame is ready (nullptr: nobody waits)
+    void init(pipeline::Signal* wake);
+
+    // Capture side: grab, decode and queue one frame at the requested level.
+    // False when there is no free frame or the capture failed, the caller backs off before trying again.
+    bool captureNext(capture::Frame& jpeg, jpeg::GrayDecoder& decoder);
+
+    // loop() side: dither, display and judge the next ready frame, false when there is none.
+    // The allocation guard is armed after ALLOC_GUARD_WARMUP_FRAMES frames at a stable level when mayArm is set.
+    bool update(DisplayFn display, void* arg, const bool mayArm);
+
+    // Buffers may be reallocated after a state or level change, the allocation guard waits for a new warm-up
+    void restartWarmUp();
+
+    // framesize of the level the capture side uses
+    framesize_t framesize();
+    bool ready(); // a frame waits for update()
+
+    const governor::Governor& governorState(); // level picked from the frames update() judged
+    // sensor to display time of the last frame update() handled
+    int64_t lastLatencyUs();
+}
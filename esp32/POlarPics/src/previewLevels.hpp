@@ -0,0 +1,23 @@
+#pragma once
+
+#include "esp_camera.h" // Cam
+
+#include "filtering.h"
+#include "governor.h"
+
+// Preview quality ladder of the governor, shared by main.cpp and the host tests (host/test)
+
+#define PREVIEW_TARGET_FPS 8.f
+#define PREVIEW_INITIAL_LEVEL 1
+
+// from the cheapest to the best, the display scale fills the 320x240 screen
+const governor::QualityLevel previewLevels[] = {
+    {FRAMESIZE_QQVGA, 160, 120, 1, 2, filtering::EFilteringMethod::sierra24a},
+    {FRAMESIZE_QQVGA, 160, 120, 1, 2, filtering::EFilteringMethod::floydSteinberg},
+    {FRAMESIZE_QVGA, 320, 240, 1, 1, filtering::EFilteringMethod::sierra24a},
+    {FRAMESIZE_QVGA, 320, 240, 1, 1, filtering::EFilteringMethod::floydSteinberg},
+    {FRAMESIZE_QVGA, 320, 240, 1, 1, filtering::EFilteringMethod::stucki},
+    {FRAMESIZE_VGA, 320, 240, 2, 1, filtering::EFilteringMethod::stucki} // decoded at 1/2, less sensor noise and aliasing
+};
+
+#define PREVIEW_LEVEL_COUNT (sizeof(previewLevels) / sizeof(previewLevels[0]))
@@ -0,0 +1,427 @@
+#include "printing.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include "SpscRing.h"
+#include "Task.h"
+#include "trace.h"
+#include "gallery.hpp"
+#ifdef POLARPICS_PRINT_CAPTURE
+#include <cstdio>
+#include <sys/stat.h>
+#include "CaptureTee.h"
+#endif
+
+namespace printing {
+
+    namespace {
+        enum class EJobKind {
+            stream, // bands pushed by a StreamWriter
+            gallery // an entry of the gallery read back from the SD card
+        };
+
+        const char* jobKindToString(const EJobKind kind) {
+            switch (kind) {
+                case EJobKind::stream: return "stream";
+                case EJobKind::gallery: return "gallery";
+                default: return "unknown";
+            }
+        }
+
+        struct PrintJob {
+            EJobKind kind;
+            size_t id;
+            int64_t queuedUs;
+            bool archive; // the printed rows are saved to the gallery
+            uint32_t galleryId; // entry of a gallery job
+        };
+
+        thermal::RasterPrinter* printer = nullptr;
+        bool printerAsleep = false;
+
+        std::array<PrintJob, PRINT_QUEUE_SIZE> jobs;
+        pipeline::SpscRing<PrintJob*, PRINT_QUEUE_SIZE> freeJobs; // print task -> submitter
+        pipeline::SpscRing<PrintJob*, PRINT_QUEUE_SIZE> queuedJobs; // submitter -> print task
+
+        std::array<Band, PRINT_STREAM_BANDS> bands;
+        pipeline::SpscRing<Band*, PRINT_STREAM_BANDS> freeBands; // print task -> stream writer
+        pipeline::SpscRing<Band*, PRINT_STREAM_BANDS> filledBands; // stream writer -> print task
+
+        std::atomic<size_t> inFlight {0};
+        std::atomic<size_t> nextJobId {0};
+        std::atomic<size_t> cancelBefore {0}; // jobs with a lower id are cancelled
+
+        // band read back from a gallery entry
+        Band galleryBand;
+        // rows of a band repacked without their trailing blank bytes
+        Band trimmedBand;
+
+        gallery::Writer archiveWriter;
+        gallery::Reader galleryReader;
+
+        const size_t feedCommandBytes = 3; // ESC J rows
+
+        struct JobStats {
+            size_t rawBytes; // what a plain raster command per band would have sent
+            size_t sentBytes;
+        };
+
+        inline bool cancelled(const size_t jobId) { return jobId < cancelBefore.load(); }
+
+#ifdef POLARPICS_PRINT_CAPTURE
+    #if defined(ARDUINO) && !defined(POLARPICS_GALLERY)
+        #error "the printer captures are written to the gallery SD card, build with -DPOLARPICS_GALLERY (see env esp32cam-gallery)"
+    #endif
+    #ifdef ARDUINO
+        #define PRINT_CAPTURE_ROOT GALLERY_MOUNT_POINT "/captures"
+    #else
+        #define PRINT_CAPTURE_ROOT "captures"
+    #endif
+
+        thermal::CaptureTee* captureTee = nullptr;
+        uint32_t nextCaptureId = 0;
+        bool captureIdKnown = false;
+
+        // every job is recorded to its own <root>/<n>.cap, numbered after the captures already on the card
+        void openCapture(const PrintJob& job) {
+            if (!gallery::ready()) return; // the card is mounted with the gallery
+            char path[GALLERY_PATH_SIZE];
+            if (!captureIdKnown) {
+                mkdir(PRINT_CAPTURE_ROOT, 0777); // fails when it already exists
+                for (;; ++nextCaptureId) {
+                    std::snprintf(path, sizeof(path), "%s/%05u.cap", PRINT_CAPTURE_ROOT, static_cast<unsigned>(nextCaptureId));
+                    std::FILE* existing = std::fopen(path, "rb");
+                    if (existing == nullptr) break;
+                    std::fclose(existing);
+                }
+                captureIdKnown = true;
+            }
+            std::snprintf(path, sizeof(path), "%s/%05u.cap", PRINT_CAPTURE_ROOT, static_cast<unsigned>(nextCaptureId));
+            if (captureTee->open(path, printer->settings())) {
+                log_d("print job %zu: capturing the printer bytes to %s", job.id, path);
+                ++nextCaptureId;
+            }
+        }
+
+        void closeCapture(const PrintJob& job) {
+            if (!captureTee->isOpen()) return;
+            const size_t bytes = captureTee->bytesCaptured();
+            if (!captureTee->close()) log_e("print job %zu: capture incomplete", job.id);
+            else log_d("print job %zu: %zu printer bytes captured", job.id, bytes);
+        }
+#endif
+
+        // Invert packed rows to the thermal dot convention, the padding bits of each row stay blank
+        void toDots(uint8_t* data, const size_t width, const size_t rows) {
+            const size_t rowBytes = (width + 7) / 8;
+            const uint8_t lastByteMask = width % 8 == 0 ? 0xFF : static_cast<uint8_t>(0xFF << (8 - width % 8));
+            for (size_t r = 0; r < rows; ++r) {
+                uint8_t* row = data + r * rowBytes;
+                for (size_t i = 0; i < rowBytes; ++i) row[i] = ~row[i];
+                row[rowBytes - 1] &= lastByteMask;
+            }
+        }
+
+        inline uint32_t loadWord(const uint8_t* p) {
+            uint32_t word;
+            std::memcpy(&word, p, sizeof(word));
+            return word;
+        }
+
+        // blank rows burn no dot, tested a word at a time
+        bool isBlankRow(const uint8_t* row, const size_t rowBytes) {
+            size_t i = 0;
+            for (; i + sizeof(uint32_t) <= rowBytes; i += sizeof(uint32_t)) {
+                if (loadWord(row + i) != 0) return false;
+            }
+            for (; i < rowBytes; ++i) {
+                if (row[i] != 0) return false;
+            }
+            return true;
+        }
+
+        // bytes up to the last one holding a dot
+        size_t usedBytes(const uint8_t* row, const size_t rowBytes) {
+            size_t n = rowBytes;
+            while (n % sizeof(uint32_t) != 0 && row[n - 1] == 0) --n;
+            if (n % sizeof(uint32_t) == 0) {
+                while (n >= sizeof(uint32_t) && loadWord(row + n - sizeof(uint32_t)) == 0) n -= sizeof(uint32_t);
+                while (n > 0 && row[n - 1] == 0) --n;
+            }
+            return n;
+        }
+
+        void feedBlankRows(const size_t rows, JobStats& stats) {
+            printer->feedRows(rows);
+            stats.sentBytes += feedCommandBytes * ((rows + 254) / 255);
+        }
+
+        // Send the rows [first, last) of a band, narrowed to the widest row once the trailing blank bytes are dropped
+        void sendRows(const Band& band, const size_t first, const size_t last, JobStats& stats) {
+            const size_t rowBytes = (band.width + 7) / 8;
+            const uint8_t* rows = band.data.data() + first * rowBytes;
+            const size_t count = last - first;
+
+            size_t width = 0;
+            for (size_t r = 0; r < count && width < rowBytes; ++r)
+                width = std::max(width, usedBytes(rows + r * rowBytes, rowBytes));
+
+            if (width < rowBytes) {
+                for (size_t r = 0; r < count; ++r)
+                    std::copy(rows + r * rowBytes, rows + r * rowBytes + width, trimmedBand.data.begin() + r * width);
+                rows = trimmedBand.data.data();
+            }
+
+            printer->printRows(rows, width, count);
+            stats.sentBytes += printer->headerBytes() + width * count;
+        }
+
+        // Runs of blank rows become paper feeds, the other runs are sent as narrowed bitmaps
+        void sendBand(const Band& band, JobStats& stats) {
+            const size_t rowBytes = (band.width + 7) / 8;
+            stats.rawBytes += printer->headerBytes() + rowBytes * band.rows;
+
+            size_t r = 0;
+            while (r < band.rows) {
+                const bool blank = isBlankRow(band.data.data() + r * rowBytes, rowBytes);
+                size_t end = r + 1;
+                while (end < band.rows && isBlankRow(band.data.data() + end * rowBytes, rowBytes) == blank) ++end;
+
+                if (blank) feedBlankRows(end - r, stats);
+                else sendRows(band, r, end, stats);
+                r = end;
+            }
+        }
+
+        // returns the number of rows printed
+        size_t printStreamJob(const PrintJob& job, int64_t& firstDotUs, JobStats& stats) {
+            size_t rows = 0;
+            // bands of a cancelled stream are still consumed so the writer can finish
+            for(;;) {
+                Band* band = nullptr;
+                if (!filledBands.pop(band)) {
+                    pipeline::sleepMs(1);
+                    continue;
+                }
+
+                if (!cancelled(job.id) && band->rows > 0) {
+                    if (rows == 0) {
+                        firstDotUs = pipeline::nowUs();
+                        if (job.archive) archiveWriter.open(band->width);
+                    }
+                    TRACE_SCOPE(stagePrint, job.id);
+                    sendBand(*band, stats);
+                    // the band is already in the PBM layout, the SD write overlaps the paper motion
+                    if (archiveWriter.isOpen()) archiveWriter.writeRows(band->data.data(), band->rows);
+                    rows += band->rows;
+                }
+
+                const bool last = band->last;
+                freeBands.push(band);
+                if (last) {
+                    if (cancelled(job.id)) archiveWriter.abort();
+                    else if (archiveWriter.isOpen()) archiveWriter.close();
+                    return rows;
+                }
+            }
+        }
+
+        // the rows are read back in the band layout, nothing to dither nor convert
+        size_t printGalleryJob(const PrintJob& job, int64_t& firstDotUs, JobStats& stats) {
+            if (!galleryReader.open(job.galleryId)) return 0;
+            if (galleryReader.width() > PRINTER_WIDTH) {
+                log_e("print job %zu: gallery entry %u wider than the printer (%zu)", job.id, static_cast<unsigned>(job.galleryId), galleryReader.width());
+                galleryReader.close();
+                return 0;
+            }
+
+            size_t row = 0;
+            while (galleryReader.rowsLeft() > 0 && !cancelled(job.id)) {
+                galleryBand.width = galleryReader.width();
+                galleryBand.rows = std::min<size_t>(PRINT_BAND_ROWS, galleryReader.rowsLeft());
+                if (!galleryReader.readRows(galleryBand.data.data(), galleryBand.rows)) break;
+                if (row == 0) firstDotUs = pipeline::nowUs();
+                TRACE_SCOPE(stagePrint, job.id);
+                sendBand(galleryBand, stats);
+                row += galleryBand.rows;
+            }
+            galleryReader.close();
+            return row;
+        }
+
+        void printJob(const PrintJob& job) {
+#ifdef POLARPICS_PRINT_CAPTURE
+            openCapture(job);
+#endif
+            if (printerAsleep) {
+                printer->wake();
+                printerAsleep = false;
+            }
+
+            const int64_t start = pipeline::nowUs();
+            int64_t firstDotUs = start;
+            JobStats stats = {0, 0};
+
+            size_t rows = 0;
+            switch (job.kind) {
+                case EJobKind::stream: rows = printStreamJob(job, firstDotUs, stats); break;
+                case EJobKind::gallery: rows = printGalleryJob(job, firstDotUs, stats); break;
+            }
+
+            // the job is only over once the paper stopped moving
+            printer->waitIdle();
+
+            const int64_t end = pipeline::nowUs();
+            log_d("print job %zu (%s) %zu rows %s -- waited: %lld us; time to first dot: %lld us; printed: %lld us (%.1f dot lines/s)",
+                job.id, jobKindToString(job.kind), rows, cancelled(job.id) ? "cancelled" : "done", static_cast<long long>(start - job.queuedUs),
+                static_cast<long long>(firstDotUs - job.queuedUs), static_cast<long long>(end - start), end > start ? rows * 1e6f / (end - start) : 0.f);
+            log_d("print job %zu -- sent %zu bytes, %d saved by blank rows and trimming",
+                job.id, stats.sentBytes, static_cast<int>(stats.rawBytes) - static_cast<int>(stats.sentBytes));
+            // after the timing, the buffered records may still have to go to the card
+#ifdef POLARPICS_PRINT_CAPTURE
+            closeCapture(job);
+#endif
+        }
+
+        void printTask(void*) {
+            printer->begin();
+            int64_t idleSinceUs = pipeline::nowUs();
+
+            PrintJob* job = nullptr;
+            for(;;) {
+                if (!queuedJobs.pop(job)) {
+                    if (!printerAsleep && pipeline::nowUs() - idleSinceUs > PRINT_IDLE_SLEEP_MS * 1000LL) {
+                        printer->sleep();
+                        printerAsleep = true;
+                    }
+                    pipeline::sleepMs(10);
+                    continue;
+                }
+
+                if (job->kind != EJobKind::stream && cancelled(job->id)) log_d("print job %zu cancelled before printing", job->id);
+                else printJob(*job);
+
+                freeJobs.push(job);
+                --inFlight;
+                TRACE_COUNTER(counterPrintQueue, inFlight.load());
+                idleSinceUs = pipeline::nowUs();
+            }
+        }
+
+        PrintJob* queueJob(const EJobKind kind) {
+            PrintJob* job = nullptr;
+            if (!freeJobs.pop(job)) return nullptr;
+
+            job->kind = kind;
+            job->id = nextJobId++;
+            job->queuedUs = pipeline::nowUs();
+            job->archive = false;
+            return job;
+        }
+
+        inline void pushJob(PrintJob* job) {
+            ++inFlight;
+            TRACE_COUNTER(counterPrintQueue, inFlight.load());
+            queuedJobs.push(job);
+        }
+    }
+
+    bool init(Print& out, const thermal::PrinterSettings& settings) {
+#ifdef POLARPICS_PRINT_CAPTURE
+        static thermal::CaptureTee tee(out, memory::EOwner::print);
+        captureTee = &tee;
+        static thermal::RasterPrinter rasterPrinter(tee, settings);
+#else
+        static thermal::RasterPrinter rasterPrinter(out, settings);
+#endif
+        printer = &rasterPrinter;
+        for (PrintJob& job : jobs) freeJobs.push(&job);
+        for (Band& band : bands) freeBands.push(&band);
+        return pipeline::startTask("print", printTask, nullptr, PRINT_TASK_STACK, PRINT_TASK_PRIORITY, PRINT_CORE);
+    }
+
+    bool reprint(const uint32_t galleryId) {
+        PrintJob* job = queueJob(EJobKind::gallery);
+        if (job == nullptr) return false;
+
+        job->galleryId = galleryId;
+        pushJob(job);
+        return true;
+    }
+
+    bool StreamWriter::open(const size_t width, const float threshold, const filtering::EFilteringMethod method, const bool archive) {
+        if (open_) return false;
+        if (width > PRINTER_WIDTH) {
+            log_e("printing::StreamWriter::open: stream wider than the printer (%zu)", width);
+            return false;
+        }
+
+        PrintJob* job = queueJob(EJobKind::stream);
+        if (job == nullptr) return false;
+
+        ditherer_ = filtering::RowDitherer(width, threshold, method, memory::EOwner::print);
+        job->archive = archive;
+        jobId_ = job->id;
+        open_ = true;
+        pushJob(job);
+        return true;
+    }
+
+    bool StreamWriter::ensureBand() {
+        if (band_ != nullptr && band_->rows == PRINT_BAND_ROWS) pushBand(false);
+        if (band_ == nullptr) {
+            if (!freeBands.pop(band_)) return false;
+            band_->width = ditherer_.width();
+            band_->rows = 0;
+            band_->last = false;
+        }
+        return true;
+    }
+
+    void StreamWriter::pushBand(const bool last) {
+        toDots(band_->data.data(), band_->width, band_->rows);
+        band_->last = last;
+        filledBands.push(band_); // can't fail, the ring holds every band
+        band_ = nullptr;
+    }
+
+    bool StreamWriter::writeRow(const uint8_t* row) {
+        if (!open_) return false;
+        if (!ensureBand()) return false;
+        if (cancelled(jobId_)) return true; // rows are dropped until close
+
+        if (ditherer_.pushRow(row, nextRow()) && ++band_->rows == PRINT_BAND_ROWS) pushBand(false);
+        return true;
+    }
+
+    bool StreamWriter::close() {
+        if (!open_) return true;
+
+        for(;;) {
+            if (!ensureBand()) return false;
+            if (cancelled(jobId_) || !ditherer_.flushRow(nextRow())) break;
+            if (++band_->rows == PRINT_BAND_ROWS) pushBand(false);
+        }
+
+        // ensureBand left a band with some room, possibly empty
+        pushBand(true);
+        open_ = false;
+        return true;
+    }
+
+    bool full() { return freeJobs.empty(); }
+
+    bool busy() { return inFlight.load() != 0; }
+
+    size_t pending() { return inFlight.load(); }
+
+    void cancel() {
+        cancelBefore = nextJobId.load();
+    }
+
+    void drawBusyIndicator(TFT_eSPI& tft) {
+        if (busy()) tft.fillCircle(310, 10, 6, TFT_RED);
+    }
+}
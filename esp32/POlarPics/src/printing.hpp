@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <TFT_eSPI.h>
+
+#include "filtering.h"
+#include "RasterPrinter.h"
+
+#define PRINTER_WIDTH 384 // dots per line of the thermal printer
+#define PRINTER_BAUD 9600 // has to match the printer, see its self test page
+
+namespace printing {
+
+    #define PRINT_QUEUE_SIZE 2 // jobs waiting or printing, queueing fails beyond that
+    #define PRINT_BAND_ROWS 24 // rows sent per bitmap command, cancellation is checked between bands
+    #define PRINT_STREAM_BANDS 3 // bands in flight between a StreamWriter and the print task
+    #define PRINT_CORE 0
+    #define PRINT_TASK_STACK 4096
+    #define PRINT_TASK_PRIORITY 1
+    #define PRINT_IDLE_SLEEP_MS 30000 // the printer is put to sleep after this long without job
+
+    // Rows ready for the printer, in thermal dot convention (a set bit burns a dot)
+    struct Band {
+        alignas(4) std::array<uint8_t, PRINT_BAND_ROWS * PRINTER_WIDTH / 8> data; // aligned for the word level row scans
+        size_t width;
+        size_t rows;
+        bool last;
+    };
+
+    // Start the background print task, the printer must only be used through this queue afterwards
+    bool init(Print& out, const thermal::PrinterSettings& settings);
+
+    // Queue a print of a gallery entry, its rows are read from the SD card as they are sent.
+    // Returns false when the queue is full.
+    bool reprint(const uint32_t galleryId);
+
+    // Producer side of a streamed job: grayscale rows are dithered into bands which are printed while the next ones are computed.
+    // Only a few bands and the ditherer rows are kept in memory whatever the height of the print.
+    class StreamWriter {
+    private:
+        filtering::RowDitherer ditherer_;
+        Band* band_; // band being filled
+        size_t jobId_;
+        bool open_;
+
+        bool ensureBand();
+        void pushBand(const bool last);
+        inline uint8_t* nextRow() { return band_->data.data() + band_->rows * ditherer_.rowBytes(); }
+
+    public:
+        StreamWriter() : band_{nullptr}, jobId_{0}, open_{false} {}
+
+        // Queue a new streamed job, false when the queue is full or a stream is already open.
+        // With archive the printed rows are saved as a new gallery entry (dropped if the job is cancelled).
+        bool open(const size_t width, const float threshold = 0.5f, const filtering::EFilteringMethod method = filtering::EFilteringMethod::floydSteinberg, const bool archive = false);
+
+        // Feed the next grayscale row, false when no band is free yet (retry the same row later)
+        bool writeRow(const uint8_t* row);
+
+        // Flush the last rows and end the job, false when no band is free yet (call it again later)
+        bool close();
+
+        inline bool isOpen() const { return open_; }
+    };
+
+    bool full();
+
+    // a job is printing or waiting
+    bool busy();
+    size_t pending();
+
+    // Abort the job being printed (at the next band) and drop every job queued so far
+    void cancel();
+
+    void drawBusyIndicator(TFT_eSPI& tft);
+}
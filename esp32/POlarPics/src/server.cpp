@@ -0,0 +1,498 @@
+#ifdef POLARPICS_SERVER
+
+#include "server.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef ARDUINO
+#include <WiFi.h>
+#include "esp_http_server.h"
+#include "esp_camera.h"
+#else
+#include <thread>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include "esp_timer.h"
+#include "esp32-hal-log.h"
+
+#include "Netpbm.h"
+#include "Png.h"
+#include "SpscRing.h"
+#include "Signal.h"
+#include "capture.hpp"
+#include "gallery.hpp"
+#include "camera_index.h"
+
+namespace server {
+
+    namespace {
+        #define SERVER_BOUNDARY "polarpicsframe"
+        #define BMP_HEADER_BYTES 62 // file header, BITMAPINFOHEADER and the 2 entry palette
+        #define PBM_HEADER_SIZE 24 // "P4\n<width> <height>\n" and its terminator
+
+        const char* streamContentType = "multipart/x-mixed-replace;boundary=" SERVER_BOUNDARY;
+        const char* partHeader = "\r\n--" SERVER_BOUNDARY "\r\nContent-Type: %s\r\nContent-Length: %u\r\n\r\n";
+
+        // sends len bytes of data to the client, false once it is gone
+        typedef bool (*SendFn)(void* arg, const char* data, const size_t len);
+
+        struct StreamFrame {
+            PrinterMatrix pixels; // sized for the largest preview, only the first width x height bits are used
+            size_t width;
+            size_t height;
+        };
+
+        // loop() publishes, the stream handler (one connection at a time) sends
+        std::array<StreamFrame, SERVER_FRAME_COUNT> frames;
+        pipeline::SpscRing<StreamFrame*, SERVER_FRAME_COUNT> freeFrames; // stream handler -> loop()
+        pipeline::SpscRing<StreamFrame*, SERVER_FRAME_COUNT> readyFrames; // loop() -> stream handler
+        pipeline::Signal frameWake;
+        size_t frameCapacity = 0; // pixels of a StreamFrame
+        Matrix<uint8_t> pngFrame {memory::EOwner::server}; // encoded PNG frame, its length goes in the part header
+        png::Encoder streamEncoder {memory::EOwner::server};
+        png::Encoder galleryEncoder {memory::EOwner::server};
+
+        std::atomic<bool> started {false};
+        std::atomic<bool> watching {false}; // a stream client is connected
+        std::atomic<size_t> framesSent {0};
+        std::atomic<size_t> framesDropped {0};
+        std::atomic<float> streamFps {0.f};
+        std::atomic<size_t> streamBytesPerFrame {0};
+
+        inline void put16(uint8_t* p, const uint16_t v) { p[0] = v & 0xFF; p[1] = v >> 8; }
+        inline void put32(uint8_t* p, const uint32_t v) { put16(p, v & 0xFFFF); put16(p + 2, v >> 16); }
+
+        struct PngBuffer {
+            uint8_t* data;
+            size_t len;
+            size_t capacity;
+        };
+
+        bool appendPng(void* arg, const uint8_t* data, const size_t len) {
+            PngBuffer& buffer = *static_cast<PngBuffer*>(arg);
+            if (buffer.len + len > buffer.capacity) return false;
+            std::memcpy(buffer.data + buffer.len, data, len);
+            buffer.len += len;
+            return true;
+        }
+
+        // the stream frame into pngFrame, returns the PNG length, 0 on failure
+        size_t encodeFrame(const StreamFrame& frame) {
+            PngBuffer buffer {pngFrame.data(), 0, pngFrame.len()};
+            if (!streamEncoder.begin(frame.width, frame.height, appendPng, &buffer, SERVER_PNG_LEVEL, png::EFilter::none)) return 0;
+            uint8_t row[PNG_MAX_WIDTH / 8];
+            for (size_t r = 0; r < frame.height; ++r) {
+                netpbm::packedToRow(frame.pixels.data(), r * frame.width, frame.width, row);
+                if (!streamEncoder.writeRows(row, 1)) return 0;
+            }
+            return streamEncoder.end() ? buffer.len : 0;
+        }
+
+        size_t rowBytes(const EFrameFormat format, const size_t width) {
+            return format == EFrameFormat::bmp ? (width + 31) / 32 * 4 : netpbm::rowBytes(netpbm::EFormat::pbm, width);
+        }
+
+        // header of a frame into out, returns its length
+        size_t writeHeader(const EFrameFormat format, const size_t width, const size_t height, uint8_t* out) {
+            if (format == EFrameFormat::pbm)
+                return std::snprintf(reinterpret_cast<char*>(out), PBM_HEADER_SIZE, "P4\n%u %u\n", static_cast<unsigned>(width), static_cast<unsigned>(height));
+
+            // top-down (negative height), palette index 1 is black so the PBM rows are valid BMP rows
+            const uint32_t imageBytes = rowBytes(format, width) * height;
+            std::memset(out, 0, BMP_HEADER_BYTES);
+            out[0] = 'B';
+            out[1] = 'M';
+            put32(out + 2, BMP_HEADER_BYTES + imageBytes);
+            put32(out + 10, BMP_HEADER_BYTES);
+            put32(out + 14, 40);
+            put32(out + 18, width);
+            put32(out + 22, static_cast<uint32_t>(-static_cast<int32_t>(height)));
+            put16(out + 26, 1); // planes
+            put16(out + 28, 1); // bits per pixel
+            put32(out + 34, imageBytes);
+            put32(out + 38, 2835); // 72 dpi
+            put32(out + 42, 2835);
+            put32(out + 46, 2); // palette entries
+            put32(out + 50, 2);
+            std::memset(out + 54, 0xFF, 3); // white, then black
+            return BMP_HEADER_BYTES;
+        }
+
+        // header and rows through a stack chunk, rows are converted from the PrinterMatrix bits on the fly
+        bool sendFrame(const StreamFrame& frame, const EFrameFormat format, SendFn send, void* arg) {
+            uint8_t chunk[SERVER_CHUNK_BYTES];
+            size_t used = writeHeader(format, frame.width, frame.height, chunk);
+            const size_t stride = rowBytes(format, frame.width);
+            const size_t bytes = netpbm::rowBytes(netpbm::EFormat::pbm, frame.width);
+            if (stride > SERVER_CHUNK_BYTES - BMP_HEADER_BYTES) return false;
+
+            for (size_t r = 0; r < frame.height; ++r) {
+                if (used + stride > SERVER_CHUNK_BYTES) {
+                    if (!send(arg, reinterpret_cast<const char*>(chunk), used)) return false;
+                    used = 0;
+                }
+                netpbm::packedToRow(frame.pixels.data(), r * frame.width, frame.width, chunk + used);
+                std::memset(chunk + used + bytes, 0, stride - bytes);
+                used += stride;
+            }
+            return send(arg, reinterpret_cast<const char*>(chunk), used);
+        }
+
+        EFrameFormat queryFormat(const char* query) {
+            if (query != nullptr && std::strstr(query, "format=pbm") != nullptr) return EFrameFormat::pbm;
+            if (query != nullptr && std::strstr(query, "format=png") != nullptr) return EFrameFormat::png;
+            return EFrameFormat::bmp;
+        }
+
+        // the id of /gallery?id=<id>, the last entry without one, false when there is nothing to send
+        bool queryEntry(const char* query, uint32_t& id) {
+            const char* value = query != nullptr ? std::strstr(query, "id=") : nullptr;
+            if (value != nullptr) {
+                id = std::strtoul(value + 3, nullptr, 10);
+                return true;
+            }
+            gallery::Entry entry;
+            if (!gallery::entry(gallery::count() - 1, entry)) return false;
+            id = entry.id;
+            return true;
+        }
+
+        struct SendTarget {
+            SendFn send;
+            void* arg;
+        };
+
+        bool sendPng(void* arg, const uint8_t* data, const size_t len) {
+            const SendTarget& target = *static_cast<const SendTarget*>(arg);
+            return target.send(target.arg, reinterpret_cast<const char*>(data), len);
+        }
+
+        // the rows of an opened entry through the gallery encoder, as they are read from the card
+        bool sendGalleryPng(gallery::Reader& reader, SendFn send, void* arg) {
+            uint8_t rows[SERVER_CHUNK_BYTES];
+            const size_t bytes = netpbm::rowBytes(netpbm::EFormat::pbm, reader.width());
+            const size_t rowsPerChunk = SERVER_CHUNK_BYTES / bytes;
+            SendTarget target {send, arg};
+            if (!galleryEncoder.begin(reader.width(), reader.height(), sendPng, &target, SERVER_PNG_LEVEL, png::EFilter::none)) return false;
+            while (reader.rowsLeft() > 0) {
+                const size_t count = std::min(rowsPerChunk, reader.rowsLeft());
+                if (!reader.readRows(rows, count) || !galleryEncoder.writeRows(rows, count)) return false;
+            }
+            return galleryEncoder.end();
+        }
+
+        // Multipart parts until the client goes away. While the preview is paused nothing is sent and the connection stays
+        // open, a client gone meanwhile is only noticed when the next frame fails to send.
+        void streamFrames(const EFrameFormat format, SendFn send, void* arg) {
+            // frames published before this client are stale
+            StreamFrame* frame = nullptr;
+            while (readyFrames.pop(frame)) freeFrames.push(frame);
+            watching = true;
+
+            capture::FpsCounter fps;
+            size_t windowBytes = 0;
+            size_t windowFrames = 0;
+            for (;;) {
+                if (!readyFrames.pop(frame)) {
+                    if (!frameWake.wait(SERVER_WAIT_MS) && readyFrames.empty()) streamFps = 0.f;
+                    continue;
+                }
+
+                const size_t bytes = format == EFrameFormat::png ? encodeFrame(*frame) : frameBytes(format, frame->width, frame->height);
+                char part[128];
+                const int partLen = std::snprintf(part, sizeof(part), partHeader, frameFormatMime(format), static_cast<unsigned>(bytes));
+                const bool sent = bytes > 0 && send(arg, part, partLen) && (format == EFrameFormat::png ?
+                    send(arg, reinterpret_cast<const char*>(pngFrame.data()), bytes) : sendFrame(*frame, format, send, arg));
+                freeFrames.push(frame);
+                if (!sent) break;
+
+                ++framesSent;
+                windowBytes += partLen + bytes;
+                ++windowFrames;
+                if (fps.tick(esp_timer_get_time(), SERVER_REPORT_US)) {
+                    streamFps = fps.fps();
+                    streamBytesPerFrame = windowBytes / windowFrames;
+                    log_i("server: %.1f fps, %zu bytes per %s frame (%zu dropped)", fps.fps(), windowBytes / windowFrames,
+                        frameFormatToString(format), framesDropped.load());
+                    windowBytes = 0;
+                    windowFrames = 0;
+                }
+            }
+
+            watching = false;
+            streamFps = 0.f;
+        }
+
+        int statusJson(char* out, const size_t size) {
+            const Stats s = stats();
+            return std::snprintf(out, size, "{\"fps\":%.2f,\"bytes_per_frame\":%u,\"frames\":%u,\"dropped\":%u,\"streaming\":%s}",
+                s.fps, static_cast<unsigned>(s.bytesPerFrame), static_cast<unsigned>(s.frames), static_cast<unsigned>(s.dropped),
+                watching.load() ? "true" : "false");
+        }
+
+#ifdef ARDUINO
+        httpd_handle_t uiServer = nullptr;
+        httpd_handle_t streamServer = nullptr;
+
+        // the page is sent as it is in flash, the browser inflates it
+        esp_err_t indexHandler(httpd_req_t* req) {
+            httpd_resp_set_type(req, "text/html");
+            httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+            const sensor_t* s = esp_camera_sensor_get();
+            if (s != nullptr && s->id.PID == OV3660_PID)
+                return httpd_resp_send(req, reinterpret_cast<const char*>(index_ov3660_html_gz), index_ov3660_html_gz_len);
+            return httpd_resp_send(req, reinterpret_cast<const char*>(index_ov2640_html_gz), index_ov2640_html_gz_len);
+        }
+
+        esp_err_t statusHandler(httpd_req_t* req) {
+            char json[160];
+            const int len = statusJson(json, sizeof(json));
+            httpd_resp_set_type(req, "application/json");
+            httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+            return httpd_resp_send(req, json, len);
+        }
+
+        bool sendChunk(void* arg, const char* data, const size_t len) {
+            return httpd_resp_send_chunk(static_cast<httpd_req_t*>(arg), data, len) == ESP_OK;
+        }
+
+        // the PNG length isn't known before the last row, it goes out chunked
+        esp_err_t galleryHandler(httpd_req_t* req) {
+            char query[32];
+            const bool hasQuery = httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK;
+            uint32_t id = 0;
+            gallery::Reader reader;
+            if (!gallery::ready() || !queryEntry(hasQuery ? query : nullptr, id) || !reader.open(id))
+                return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "no such print");
+            httpd_resp_set_type(req, frameFormatMime(EFrameFormat::png));
+            if (!sendGalleryPng(reader, sendChunk, req)) log_e("server: gallery entry %u not sent", id);
+            httpd_resp_send_chunk(req, nullptr, 0);
+            return ESP_OK;
+        }
+
+        // blocks the stream server task for the whole stream, the UI server stays responsive
+        esp_err_t streamHandler(httpd_req_t* req) {
+            char query[32];
+            const bool hasQuery = httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK;
+            httpd_resp_set_type(req, streamContentType);
+            httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+            streamFrames(queryFormat(hasQuery ? query : nullptr), sendChunk, req);
+            httpd_resp_send_chunk(req, nullptr, 0);
+            return ESP_OK;
+        }
+
+        bool registerUri(httpd_handle_t handle, const char* uri, esp_err_t (*handler)(httpd_req_t*)) {
+            httpd_uri_t desc = {};
+            desc.uri = uri;
+            desc.method = HTTP_GET;
+            desc.handler = handler;
+            desc.user_ctx = nullptr;
+            return httpd_register_uri_handler(handle, &desc) == ESP_OK;
+        }
+
+        bool startServers() {
+            if (!WiFi.softAP(SERVER_AP_SSID, SERVER_AP_PASSWORD)) {
+                log_e("server: access point %s failed", SERVER_AP_SSID);
+                return false;
+            }
+
+            httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+            config.server_port = SERVER_PORT;
+            if (httpd_start(&uiServer, &config) != ESP_OK ||
+                !registerUri(uiServer, "/", indexHandler) || !registerUri(uiServer, "/status", statusHandler) ||
+                !registerUri(uiServer, "/gallery", galleryHandler)) {
+                log_e("server: UI server failed on port %u", SERVER_PORT);
+                return false;
+            }
+            config.server_port = SERVER_STREAM_PORT;
+            config.ctrl_port += 1;
+            if (httpd_start(&streamServer, &config) != ESP_OK || !registerUri(streamServer, "/stream", streamHandler)) {
+                log_e("server: stream server failed on port %u", SERVER_STREAM_PORT);
+                return false;
+            }
+            log_i("server: access point %s, http://%s/", SERVER_AP_SSID, WiFi.softAPIP().toString().c_str());
+            return true;
+        }
+#else
+        bool sendAll(void* arg, const char* data, const size_t len) {
+            const int client = *static_cast<int*>(arg);
+            for (size_t done = 0; done < len;) {
+                const ssize_t n = ::send(client, data + done, len - done, MSG_NOSIGNAL);
+                if (n <= 0) return false;
+                done += n;
+            }
+            return true;
+        }
+
+        bool sendResponse(int client, const char* status, const char* type, const char* extraHeaders, const char* body, const size_t len) {
+            char header[256];
+            const int headerLen = std::snprintf(header, sizeof(header),
+                "HTTP/1.1 %s\r\nContent-Type: %s\r\n%sContent-Length: %u\r\nConnection: close\r\n\r\n",
+                status, type, extraHeaders, static_cast<unsigned>(len));
+            return sendAll(&client, header, headerLen) && sendAll(&client, body, len);
+        }
+
+        void handle(int client, const char* path, const bool streamPort) {
+            const char* query = std::strchr(path, '?');
+            const size_t pathLen = query != nullptr ? static_cast<size_t>(query - path) : std::strlen(path);
+            const auto is = [&](const char* uri) { return std::strlen(uri) == pathLen && std::strncmp(path, uri, pathLen) == 0; };
+
+            if (streamPort && is("/stream")) {
+                char header[160];
+                const int headerLen = std::snprintf(header, sizeof(header),
+                    "HTTP/1.1 200 OK\r\nContent-Type: %s\r\nAccess-Control-Allow-Origin: *\r\nConnection: close\r\n\r\n", streamContentType);
+                if (sendAll(&client, header, headerLen)) streamFrames(queryFormat(query), sendAll, &client);
+            } else if (!streamPort && is("/")) {
+                sendResponse(client, "200 OK", "text/html", "Content-Encoding: gzip\r\n",
+                    reinterpret_cast<const char*>(index_ov2640_html_gz), index_ov2640_html_gz_len);
+            } else if (!streamPort && is("/gallery")) {
+                uint32_t id = 0;
+                gallery::Reader reader;
+                if (gallery::ready() && queryEntry(query, id) && reader.open(id)) {
+                    char header[128];
+                    const int headerLen = std::snprintf(header, sizeof(header),
+                        "HTTP/1.1 200 OK\r\nContent-Type: %s\r\nConnection: close\r\n\r\n", frameFormatMime(EFrameFormat::png));
+                    if (sendAll(&client, header, headerLen) && !sendGalleryPng(reader, sendAll, &client))
+                        log_e("server: gallery entry %u not sent", id);
+                } else {
+                    sendResponse(client, "404 Not Found", "text/plain", "", "no such print\n", 14);
+                }
+            } else if (!streamPort && is("/status")) {
+                char json[160];
+                const int len = statusJson(json, sizeof(json));
+                sendResponse(client, "200 OK", "application/json", "Access-Control-Allow-Origin: *\r\n", json, len);
+            } else {
+                sendResponse(client, "404 Not Found", "text/plain", "", "not found\n", 10);
+            }
+        }
+
+        // one connection at a time per port, like the httpd task on the device
+        void serve(const int listener, const bool streamPort) {
+            for (;;) {
+                const int client = accept(listener, nullptr, nullptr);
+                if (client < 0) continue;
+
+                char request[512];
+                const ssize_t n = recv(client, request, sizeof(request) - 1, 0);
+                char path[256];
+                if (n > 0) {
+                    request[n] = '\0';
+                    if (std::sscanf(request, "GET %255s", path) == 1) handle(client, path, streamPort);
+                }
+                close(client);
+            }
+        }
+
+        int listenOn(const uint16_t port) {
+            const int fd = socket(AF_INET, SOCK_STREAM, 0);
+            if (fd < 0) return -1;
+            const int reuse = 1;
+            setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+            sockaddr_in address = {};
+            address.sin_family = AF_INET;
+            address.sin_port = htons(port);
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(fd, 4) != 0) {
+                close(fd);
+                return -1;
+            }
+            return fd;
+        }
+
+        bool startServers() {
+            const int ui = listenOn(SERVER_PORT);
+            const int stream = listenOn(SERVER_STREAM_PORT);
+            if (ui < 0 || stream < 0) {
+                log_e("server: can't listen on ports %u and %u", SERVER_PORT, SERVER_STREAM_PORT);
+                if (ui >= 0) close(ui);
+                if (stream >= 0) close(stream);
+                return false;
+            }
+            std::thread(serve, ui, false).detach();
+            std::thread(serve, stream, true).detach();
+            log_i("server: http://localhost:%u/", SERVER_PORT);
+            return true;
+        }
+#endif
+    }
+
+    const char* frameFormatToString(const EFrameFormat format) {
+        switch (format) {
+            case EFrameFormat::pbm: return "pbm";
+            case EFrameFormat::bmp: return "bmp";
+            case EFrameFormat::png: return "png";
+            default: return "invalid";
+        }
+    }
+
+    const char* frameFormatMime(const EFrameFormat format) {
+        switch (format) {
+            case EFrameFormat::pbm: return "image/x-portable-bitmap";
+            case EFrameFormat::bmp: return "image/bmp";
+            case EFrameFormat::png: return "image/png";
+            default: return "application/octet-stream";
+        }
+    }
+
+    size_t frameBytes(const EFrameFormat format, const size_t width, const size_t height) {
+        if (format == EFrameFormat::png) return png::maxBytes(width, height);
+        uint8_t header[BMP_HEADER_BYTES];
+        return writeHeader(format, width, height, header) + rowBytes(format, width) * height;
+    }
+
+    bool start(const size_t maxWidth, const size_t maxHeight) {
+        if (started) return true;
+
+        for (StreamFrame& frame : frames) {
+            frame.pixels = PrinterMatrix(maxWidth, maxHeight, memory::EOwner::server);
+            if (frame.pixels.data() == nullptr) {
+                log_e("server: can't allocate the %zux%zu stream frames", maxWidth, maxHeight);
+                return false;
+            }
+            freeFrames.push(&frame);
+        }
+        frameCapacity = maxWidth * maxHeight;
+        pngFrame = Matrix<uint8_t>(png::maxBytes(maxWidth, maxHeight), 1, memory::EOwner::server);
+        if (pngFrame.data() == nullptr) {
+            log_e("server: can't allocate the PNG frame");
+            return false;
+        }
+
+        if (!startServers()) return false;
+        started = true;
+        return true;
+    }
+
+    bool running() { return started.load(); }
+
+    void publish(const PrinterMatrix& frame) {
+        if (!watching.load(std::memory_order_acquire) || frame.len() > frameCapacity) return;
+
+        StreamFrame* slot = nullptr;
+        if (!freeFrames.pop(slot)) {
+            ++framesDropped;
+            return;
+        }
+        std::memcpy(slot->pixels.data(), frame.data(), frame.bufferSize());
+        slot->width = frame.width();
+        slot->height = frame.height();
+        readyFrames.push(slot); // never full, there are only SERVER_FRAME_COUNT frames
+        frameWake.notify();
+    }
+
+    Stats stats() {
+        return {streamFps.load(), streamBytesPerFrame.load(), framesSent.load(), framesDropped.load()};
+    }
+}
+
+#endif
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "PrinterMatrix.h"
+
+// HTTP preview server, built with -DPOLARPICS_SERVER (env esp32cam-server). On the device it uses the ESP-IDF httpd
+// behind a WiFi access point, on the host a plain socket server on localhost.
+// The OV2640 / OV3660 web UI of camera_index.h is sent gzip'd straight from flash, the stream is the dithered preview:
+// 1 bit per pixel, 9.6 KB for a 320x240 frame. The stream port is the UI port + 1, like the camera web server example.
+// The gallery entries are served as PNG (/gallery?id=<id>, the last print without an id), encoded while they are read.
+namespace server {
+
+#ifdef ARDUINO
+    #define SERVER_PORT 80
+#else
+    #define SERVER_PORT 8080 // no root needed on the host
+#endif
+    #define SERVER_STREAM_PORT (SERVER_PORT + 1)
+#ifndef SERVER_AP_SSID
+    #define SERVER_AP_SSID "POlarPics"
+#endif
+#ifndef SERVER_AP_PASSWORD
+    #define SERVER_AP_PASSWORD "polarpics" // at least 8 characters for WPA2
+#endif
+    #define SERVER_FRAME_COUNT 2 // preview frames between loop() and the stream handler
+    #define SERVER_CHUNK_BYTES 1024 // stack buffer the frame rows are converted in before being sent
+    #define SERVER_WAIT_MS 1000 // a stream without a new frame for that long reports 0 fps and keeps waiting (menu, print)
+    #define SERVER_REPORT_US 5000000 // period of the stream fps and bytes per frame log
+    #define SERVER_PNG_LEVEL 2 // deflate effort of the PNG stream and gallery, 2 hash chain entries per match
+
+    enum class EFrameFormat : uint8_t {
+        pbm, // P4, for the tools (/stream?format=pbm)
+        bmp, // 1 bit BMP, the only uncompressed 1 bit format an <img> shows (the UI)
+        png  // 1 bit PNG, encoded before being sent (/stream?format=png): ~8% below the BMP on a dithered photo, far smaller on flat scenes
+    };
+
+    const char* frameFormatToString(const EFrameFormat format);
+    const char* frameFormatMime(const EFrameFormat format);
+
+    // bytes of a whole frame, header included, at most that for a PNG
+    size_t frameBytes(const EFrameFormat format, const size_t width, const size_t height);
+
+    // Start the access point and both servers, the stream frames are allocated for previews up to maxWidth x maxHeight
+    bool start(const size_t maxWidth, const size_t maxHeight);
+    bool running();
+
+    // loop() side, after the dither: a copy of the packed pixels goes to the stream, nothing happens when nobody watches
+    // or when the client is still sending the previous frames. Never allocates.
+    void publish(const PrinterMatrix& frame);
+
+    struct Stats {
+        float fps; // frames sent per second over the last report period
+        size_t bytesPerFrame; // average, multipart headers included
+        size_t frames; // since start
+        size_t dropped; // published while both frames were still being sent
+    };
+
+    Stats stats();
+}
@@ -39,19 +39,22 @@ namespace utils {
         }
     }
 
-    void drawGrayScale(TFT_eSPI& tft, size_t x, size_t y, const PrinterMatrix& mat) {
+    void drawGrayScale(TFT_eSPI& tft, size_t x, size_t y, const PrinterMatrix& mat, const size_t scale) {
         for (size_t r = 0; r < mat.height(); ++r) {
             for (size_t c = 0; c < mat.width(); ++c) {
                 const uint8_t grey = mat(r, c) ? 255 : 0;
-                tft.drawPixel(x + c, y + r, tft.color565(grey, grey, grey));
+                if(scale == 1)
+                    tft.drawPixel(x + c, y + r, tft.color565(grey, grey, grey));
+                else
+                    tft.fillRect(x + c * scale, y + r * scale, scale, scale, tft.color565(grey, grey, grey));
             }
         }
     }
 
-    Matrix<uint8_t> GrayRescaled(Matrix<PIXELFORMAT_RGB>& mat, const float ratio) {
+    Matrix<uint8_t> GrayRescaled(Matrix<PIXELFORMAT_RGB>& mat, const float ratio, const memory::EOwner owner) {
         const size_t newWidth = mat.width() * ratio;
         const size_t newHeight = mat.height() * ratio;
-        Matrix<uint8_t> out(newWidth, newHeight);
+        Matrix<uint8_t> out(newWidth, newHeight, owner);
         for (size_t r = 0; r < newHeight; ++r) {
             for (size_t c = 0; c < newWidth; ++c) {
                 size_t backwartR = (static_cast<float>(r) / static_cast<float>(newHeight) * static_cast<float>(mat.height()));
@@ -62,6 +65,38 @@ namespace utils {
         return out;
     }
 
+    bool GrayRowRescaler::begin(const size_t srcWidth, const size_t srcHeight, const size_t width, const size_t height) {
+        srcWidth_ = srcWidth;
+        srcHeight_ = srcHeight;
+        nextRow_ = 0;
+        if (out_.width() != width || out_.height() != height)
+            out_ = Matrix<uint8_t>(width, height, out_.owner());
+        return out_.data() != nullptr;
+    }
+
+    bool GrayRowRescaler::pushRows(const uint8_t* rows, const size_t firstRow, const size_t count, const size_t width) {
+        if (width != srcWidth_) return false;
+
+        const size_t newWidth = out_.width();
+        const size_t newHeight = out_.height();
+        for (; nextRow_ < newHeight; ++nextRow_) {
+            const size_t backwartR = (static_cast<float>(nextRow_) / static_cast<float>(newHeight) * static_cast<float>(srcHeight_));
+            if (backwartR >= firstRow + count) break; // not decoded yet
+            if (backwartR < firstRow) return false; // rows have to come in order
+
+            const uint8_t* src = rows + (backwartR - firstRow) * width;
+            for (size_t c = 0; c < newWidth; ++c) {
+                size_t backwartC = (static_cast<float>(c) / static_cast<float>(newWidth) * static_cast<float>(srcWidth_));
+                out_(nextRow_, c) = src[backwartC];
+            }
+        }
+        return true;
+    }
+
+    bool GrayRowRescaler::rowCallback(void* arg, const uint8_t* rows, const size_t firstRow, const size_t count, const size_t width) {
+        return static_cast<GrayRowRescaler*>(arg)->pushRows(rows, firstRow, count, width);
+    }
+
 
 }
 
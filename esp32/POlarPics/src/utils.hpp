@@ -25,7 +25,27 @@ namespace utils {
     inline uint16_t colorConverter(const uint8_t grey) { return colorConverter(grey, grey, grey); }
 
     void drawGrayScale(TFT_eSPI& tft, size_t x, size_t y, const Matrix<uint8_t>& mat);
-    void drawGrayScale(TFT_eSPI& tft, size_t x, size_t y, const PrinterMatrix& mat);
+    void drawGrayScale(TFT_eSPI& tft, size_t x, size_t y, const PrinterMatrix& mat, const size_t scale = 1);
 
-    Matrix<uint8_t> GrayRescaled(Matrix<PIXELFORMAT_RGB>& mat, const float ratio);
+    Matrix<uint8_t> GrayRescaled(Matrix<PIXELFORMAT_RGB>& mat, const float ratio, const memory::EOwner owner = memory::EOwner::unknown);
+
+    // Same nearest neighbour sampling as GrayRescaled for a grayscale image delivered a few rows at a time (jpeg::GrayDecoder)
+    class GrayRowRescaler {
+    private:
+        Matrix<uint8_t>& out_;
+        size_t srcWidth_;
+        size_t srcHeight_;
+        size_t nextRow_; // next output row to fill
+
+    public:
+        explicit GrayRowRescaler(Matrix<uint8_t>& out) : out_{out}, srcWidth_{0}, srcHeight_{0}, nextRow_{0} {}
+
+        // out is only reallocated (for the same owner) when the size changes
+        bool begin(const size_t srcWidth, const size_t srcHeight, const size_t width, const size_t height);
+        bool pushRows(const uint8_t* rows, const size_t firstRow, const size_t count, const size_t width);
+        inline bool done() const { return nextRow_ == out_.height(); }
+
+        // jpeg::RowCallback, arg is the rescaler
+        static bool rowCallback(void* arg, const uint8_t* rows, const size_t firstRow, const size_t count, const size_t width);
+    };
 }
\ No newline at end of file
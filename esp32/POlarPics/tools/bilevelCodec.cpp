@@ -0,0 +1,198 @@
+// Host side of the PNG and CCITT G4 encoders (lib/png, lib/ccitt): converts gallery PBM files and benchmarks the encoders on them.
+// Target of the host build, on the Arduino-ESP32 stand-ins of host/shims:
+//   cmake -S host -B host/build && cmake --build host/build --target bilevelCodec
+//
+//   bilevelCodec [-f png|g4] [-l level] [-p none|sub|up|adaptive] <input.pbm> <output.png|output.tif>
+//   bilevelCodec -b [-r repeats] <input.pbm>...    one CSV row per file and configuration (see tools/codecBench.py)
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <unistd.h>
+
+#include "Netpbm.h"
+#include "Png.h"
+#include "FaxG4.h"
+
+#define CODEC_CHUNK_ROWS 16 // rows read from the PBM per encoder call, the encoders only keep a window and a reference row
+#define CODEC_DEFAULT_REPEATS 20
+
+namespace {
+
+    enum class ECodec : uint8_t {
+        png,
+        g4
+    };
+
+    struct Config {
+        ECodec codec;
+        uint8_t level;
+        png::EFilter filter;
+    };
+
+    // same sweep as the esp32cam-bench codec section
+    const Config benchConfigs[] = {
+        {ECodec::png, 0, png::EFilter::none}, {ECodec::png, 1, png::EFilter::none}, {ECodec::png, 2, png::EFilter::none},
+        {ECodec::png, 3, png::EFilter::none}, {ECodec::png, 3, png::EFilter::sub}, {ECodec::png, 3, png::EFilter::up},
+        {ECodec::png, 3, png::EFilter::adaptive}, {ECodec::png, 6, png::EFilter::none}, {ECodec::g4, 0, png::EFilter::none}
+    };
+
+    const char* codecToString(const ECodec codec) {
+        return codec == ECodec::png ? "png" : "g4";
+    }
+
+    bool parseFilter(const char* name, png::EFilter& filter) {
+        for (const png::EFilter candidate : {png::EFilter::none, png::EFilter::sub, png::EFilter::up, png::EFilter::adaptive}) {
+            if (std::strcmp(name, png::filterToString(candidate)) == 0) {
+                filter = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Either encoder behind the same calls
+    class Encoder {
+    private:
+        png::Encoder png_;
+        ccitt::G4Encoder g4_;
+        ECodec codec_;
+
+    public:
+        explicit Encoder(const ECodec codec) : codec_{codec} {}
+
+        bool begin(const Config& config, const size_t width, const size_t height, png::WriteFn write, void* arg) {
+            return codec_ == ECodec::png ? png_.begin(width, height, write, arg, config.level, config.filter) : g4_.begin(width, height, write, arg);
+        }
+        bool writeRows(const uint8_t* rows, const size_t count) {
+            return codec_ == ECodec::png ? png_.writeRows(rows, count) : g4_.writeRows(rows, count);
+        }
+        bool end() { return codec_ == ECodec::png ? png_.end() : g4_.end(); }
+        size_t bytesOut() const { return codec_ == ECodec::png ? png_.bytesOut() : g4_.bytesOut(); }
+    };
+
+    bool openPbm(const char* path, std::FILE*& file, netpbm::Header& header) {
+        file = std::fopen(path, "rb");
+        if (file == nullptr) {
+            std::fprintf(stderr, "can't open %s\n", path);
+            return false;
+        }
+        if (!netpbm::readHeader(file, header) || header.format != netpbm::EFormat::pbm) {
+            std::fprintf(stderr, "%s is not a P4 PBM\n", path);
+            std::fclose(file);
+            return false;
+        }
+        return true;
+    }
+
+    // rows streamed from the PBM to the output file, CODEC_CHUNK_ROWS at a time
+    int convert(const Config& config, const char* inputPath, const char* outputPath) {
+        std::FILE* input = nullptr;
+        netpbm::Header header;
+        if (!openPbm(inputPath, input, header)) return 1;
+        std::FILE* output = std::fopen(outputPath, "wb");
+        if (output == nullptr) {
+            std::fprintf(stderr, "can't create %s\n", outputPath);
+            std::fclose(input);
+            return 1;
+        }
+
+        const size_t stride = netpbm::rowBytes(netpbm::EFormat::pbm, header.width);
+        std::vector<uint8_t> rows(stride * CODEC_CHUNK_ROWS);
+        Encoder encoder(config.codec);
+        bool ok = (config.codec != ECodec::g4 || ccitt::beginTiff(output)) &&
+            encoder.begin(config, header.width, header.height, png::writeFile, output);
+        for (size_t row = 0; ok && row < header.height; row += CODEC_CHUNK_ROWS) {
+            const size_t count = std::min<size_t>(CODEC_CHUNK_ROWS, header.height - row);
+            ok = std::fread(rows.data(), stride, count, input) == count && encoder.writeRows(rows.data(), count);
+        }
+        ok = ok && encoder.end() && (config.codec != ECodec::g4 || ccitt::finishTiff(output, header.width, header.height, encoder.bytesOut()));
+        std::fclose(input);
+        ok = std::fclose(output) == 0 && ok;
+        if (!ok) {
+            std::fprintf(stderr, "%s: %s encode failed\n", inputPath, codecToString(config.codec));
+            return 1;
+        }
+        std::printf("%s: %ux%u, %u bytes of PBM rows -> %u bytes of %s\n", outputPath, static_cast<unsigned>(header.width),
+            static_cast<unsigned>(header.height), static_cast<unsigned>(stride * header.height), static_cast<unsigned>(encoder.bytesOut()),
+            codecToString(config.codec));
+        return 0;
+    }
+
+    bool discard(void*, const uint8_t*, const size_t) { return true; }
+
+    // the rows are loaded once, every configuration encodes them repeats times to a sink that drops the bytes
+    bool bench(const char* path, const size_t repeats) {
+        std::FILE* input = nullptr;
+        netpbm::Header header;
+        if (!openPbm(path, input, header)) return false;
+        const size_t stride = netpbm::rowBytes(netpbm::EFormat::pbm, header.width);
+        std::vector<uint8_t> rows(stride * header.height);
+        const bool read = std::fread(rows.data(), 1, rows.size(), input) == rows.size();
+        std::fclose(input);
+        if (!read) {
+            std::fprintf(stderr, "%s: truncated\n", path);
+            return false;
+        }
+
+        for (const Config& config : benchConfigs) {
+            Encoder encoder(config.codec);
+            size_t bytes = 0;
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < repeats; ++i) {
+                if (!encoder.begin(config, header.width, header.height, discard, nullptr) ||
+                    !encoder.writeRows(rows.data(), header.height) || !encoder.end()) return false;
+                bytes = encoder.bytesOut();
+            }
+            const double elapsedNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            std::printf("%s,%s,%u,%s,%u,%u,%u,%u,%.2f,%.2f\n", path, codecToString(config.codec), config.level, png::filterToString(config.filter),
+                static_cast<unsigned>(header.width), static_cast<unsigned>(header.height), static_cast<unsigned>(repeats),
+                static_cast<unsigned>(bytes), static_cast<double>(rows.size()) / bytes, elapsedNs / (header.width * header.height * repeats));
+        }
+        return true;
+    }
+
+    void usage() {
+        std::printf("bilevelCodec [-f png|g4] [-l <level 0-9>] [-p none|sub|up|adaptive] <input.pbm> <output>\n");
+        std::printf("bilevelCodec -b [-r <repeats>] <input.pbm>...\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    Config config {ECodec::png, PNG_DEFAULT_LEVEL, png::EFilter::none};
+    bool benchmark = false;
+    size_t repeats = CODEC_DEFAULT_REPEATS;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "hf:l:p:br:")) != -1) {
+        switch (opt) {
+            case 'f':
+                if (std::strcmp(optarg, "png") == 0) config.codec = ECodec::png;
+                else if (std::strcmp(optarg, "g4") == 0) config.codec = ECodec::g4;
+                else { usage(); return 2; }
+                break;
+            case 'l': config.level = static_cast<uint8_t>(std::atoi(optarg)); break;
+            case 'p':
+                if (!parseFilter(optarg, config.filter)) { usage(); return 2; }
+                break;
+            case 'b': benchmark = true; break;
+            case 'r': repeats = std::max(1, std::atoi(optarg)); break;
+            case 'h': usage(); return 0;
+            default: usage(); return 2;
+        }
+    }
+
+    if (benchmark) {
+        if (optind >= argc) { usage(); return 2; }
+        std::printf("file,codec,level,filter,width,height,repeats,bytes,ratio,ns_per_pixel\n");
+        int status = 0;
+        for (int i = optind; i < argc; ++i)
+            if (!bench(argv[i], repeats)) status = 1;
+        return status;
+    }
+
+    if (argc - optind != 2) { usage(); return 2; }
+    return convert(config, argv[optind], argv[optind + 1]);
+}
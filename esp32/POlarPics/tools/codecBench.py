@@ -0,0 +1,139 @@
+### PNG / CCITT G4 benchmark on the capture corpus ###
+# Dithers the capture corpus at the printer width like the print path (tools/ditherQuality.py), runs the host encoders
+# of lib/png and lib/ccitt on the PBMs (tools/bilevelCodec.cpp, -b) and prints the mean compression ratio and host ns/pixel
+# of every configuration, next to zlib level 9 PNG and libtiff G4 references from PIL.
+# The device throughput comes from the codec section of an esp32cam-bench serial log (-l).
+import os, sys, getopt # for arguments
+import glob
+import csv
+import io
+import subprocess
+import tempfile
+import numpy as np
+from PIL import Image # load images
+
+import ditherQuality
+import extractBench
+
+DEFAULT_CODEC = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'host', 'build', 'bilevelCodec') # cmake -S host -B host/build
+
+# PBM rows are the payload every ratio is relative to
+def rawBytes(white):
+    return (white.shape[1] + 7) // 8 * white.shape[0]
+
+# bytes of the dithered image written by PIL: zlib level 9 with dynamic Huffman codes, libtiff's G4
+def referenceBytes(white, codec):
+    image = Image.fromarray(white)
+    out = io.BytesIO()
+    if codec == 'png':
+        image.save(out, format='PNG', optimize=True)
+    else:
+        image.save(out, format='TIFF', compression='group4')
+    return len(out.getvalue())
+
+def usage():
+    print('codecBench.py [-i <image glob>] [-x <bilevelCodec executable>] [-m <dithering method>] [-t <threshold>] [-w <width>]')
+    print('              [-r <repeats>] [-l <esp32cam-bench serial log>] [-o <output csv>]')
+
+def main(argv):
+    corpus = ditherQuality.DEFAULT_CORPUS
+    codec = DEFAULT_CODEC
+    method = 'floydSteinberg'
+    threshold = 0.5
+    width = ditherQuality.PRINTER_WIDTH
+    repeats = 20
+    logFile = ''
+    outputFile = ''
+
+    try:
+        opts, args = getopt.getopt(argv, "hi:x:m:t:w:r:l:o:", ["help", "input=", "codec=", "method=", "threshold=", "width=", "repeats=", "log=", "output="])
+    except getopt.GetoptError:
+        usage()
+        sys.exit(2)
+    for opt, arg in opts:
+        if opt in ("-h", "--help"):
+            usage()
+            sys.exit()
+        elif opt in ("-i", "--input"):
+            corpus = arg
+        elif opt in ("-x", "--codec"):
+            codec = arg
+        elif opt in ("-m", "--method"):
+            method = arg
+        elif opt in ("-t", "--threshold"):
+            threshold = float(arg)
+        elif opt in ("-w", "--width"):
+            width = int(arg)
+        elif opt in ("-r", "--repeats"):
+            repeats = int(arg)
+        elif opt in ("-l", "--log"):
+            logFile = arg
+        elif opt in ("-o", "--output"):
+            outputFile = arg
+
+    images = sorted(glob.glob(corpus))
+    if not images:
+        print('no image matches %s' % corpus)
+        sys.exit(1)
+    patterns = ditherQuality.loadPatterns(ditherQuality.FILTERING_HEADER)
+    if method not in patterns:
+        print('unknown method %s (%s)' % (method, ', '.join(patterns)))
+        sys.exit(2)
+
+    references = {'png': [], 'g4': []}
+    with tempfile.TemporaryDirectory() as directory:
+        paths = []
+        for i, path in enumerate(images):
+            white = ditherQuality.errorDiffusion(ditherQuality.loadGrayscale(path, width), patterns[method], threshold)
+            pbm = os.path.join(directory, '%05d.pbm' % i)
+            Image.fromarray(white).save(pbm)
+            paths.append(pbm)
+            for name in references:
+                references[name].append(rawBytes(white) / referenceBytes(white, name))
+            print('dithered %s (%dx%d)' % (path, white.shape[1], white.shape[0]))
+
+        result = subprocess.run([codec, '-b', '-r', str(repeats)] + paths, stdout=subprocess.PIPE, universal_newlines=True, check=True)
+        rows = list(csv.DictReader(result.stdout.splitlines()))
+
+    # mean over the corpus of every configuration
+    table = {}
+    for row in rows:
+        key = (row['codec'], int(row['level']), row['filter'])
+        entry = table.setdefault(key, {'ratio': [], 'ns_per_pixel': [], 'bytes': []})
+        entry['ratio'].append(float(row['ratio']))
+        entry['ns_per_pixel'].append(float(row['ns_per_pixel']))
+        entry['bytes'].append(int(row['bytes']))
+
+    device = {}
+    if logFile != '':
+        with open(logFile, 'r', errors='replace') as f:
+            deviceRows = extractBench.extractBench(f, 'codec')
+        if deviceRows:
+            header = deviceRows[0]
+            for values in deviceRows[1:]:
+                row = dict(zip(header, values))
+                if row['content'] == 'photo':
+                    device[(row['codec'], int(row['level']), row['filter'])] = float(row['ns_per_pixel'])
+        else:
+            print('no codec section in %s' % logFile)
+
+    print('\n%d images, %s at %.2f, %d dots wide' % (len(images), method, threshold, width))
+    print('%-6s %5s %-9s %9s %8s %14s %16s' % ('codec', 'level', 'filter', 'bytes', 'ratio', 'host ns/pixel', 'device ns/pixel'))
+    summary = []
+    for key in sorted(table):
+        entry = table[key]
+        summary.append({'codec': key[0], 'level': key[1], 'filter': key[2], 'bytes': np.mean(entry['bytes']), 'ratio': np.mean(entry['ratio']),
+            'ns_per_pixel': np.mean(entry['ns_per_pixel']), 'device_ns_per_pixel': device.get(key)})
+    for row in summary:
+        deviceNs = '%16.1f' % row['device_ns_per_pixel'] if row['device_ns_per_pixel'] is not None else '%16s' % '-'
+        print('%-6s %5d %-9s %9.0f %8.2f %14.2f %s' % (row['codec'], row['level'], row['filter'], row['bytes'], row['ratio'], row['ns_per_pixel'], deviceNs))
+    print('reference: zlib 9 PNG ratio %.2f, libtiff G4 ratio %.2f' % (np.mean(references['png']), np.mean(references['g4'])))
+
+    if outputFile != '':
+        with open(outputFile, 'w', newline='') as f:
+            writer = csv.DictWriter(f, fieldnames=['codec', 'level', 'filter', 'bytes', 'ratio', 'ns_per_pixel', 'device_ns_per_pixel'])
+            writer.writeheader()
+            writer.writerows(summary)
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -0,0 +1,228 @@
+### Dithering quality scoring ###
+# Dithers the capture corpus with every pattern of lib/filtering/filtering.h (same algorithm as errorDiffusionPrinter),
+# scores each result against its grayscale source (Gaussian blurred PSNR, SSIM and a printer dot gain variant)
+# and, given the CSV of the dithering benchmark (tools/extractBench.py), prints the quality / ns per pixel Pareto table.
+import os, sys, getopt # for arguments
+import glob
+import re
+import csv
+import numpy as np
+from PIL import Image # load images
+
+FILTERING_HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'lib', 'filtering', 'filtering.h')
+DEFAULT_CORPUS = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', '..', 'img test', 'Capture', '*', 'fb.jpg')
+
+PRINTER_WIDTH = 384 # dots per line, prints are rescaled to it
+SSIM_C1 = (0.01 * 255) ** 2
+SSIM_C2 = (0.03 * 255) ** 2
+SUPERSAMPLING = 7 # subpixels per dot side to render the dot gain, odd so the dot center is a subpixel
+
+# {method: [(deltaCols, deltaRows, proportion)]} parsed from diffusionPatterns, the patterns only live in the firmware
+def loadPatterns(path):
+    with open(path) as f:
+        text = f.read()
+    body = text[text.index('diffusionPatterns'):]
+    patterns = {}
+    for match in re.finditer(r'\{EFilteringMethod::(\w+),\s*\{(.*?)\}\s*\}', body, re.S):
+        parts = re.findall(r'\{\s*(-?\d+),\s*(-?\d+),\s*([\d.]+)f\s*/\s*([\d.]+)f', match.group(2))
+        patterns[match.group(1)] = [(int(dc), int(dr), float(num) / float(den)) for dc, dr, num, den in parts]
+    return patterns
+
+# same weights as filtering::rgbToGrayscale, rescaled to the printer width like the print path
+def loadGrayscale(path, width):
+    rgb = np.asarray(Image.open(path).convert('RGB'), dtype=np.float32)
+    gray = np.clip(0.299 * rgb[:, :, 0] + 0.587 * rgb[:, :, 1] + 0.144 * rgb[:, :, 2], 0, 255).astype(np.uint8)
+    if width > 0 and gray.shape[1] != width:
+        height = round(gray.shape[0] * width / gray.shape[1])
+        gray = np.asarray(Image.fromarray(gray).resize((width, height), Image.BILINEAR))
+    return gray
+
+# errorDiffusionPrinter: the error is diffused in place into the uint8 image (truncated), True is a white pixel
+def errorDiffusion(gray, pattern, threshold):
+    rows, cols = gray.shape
+    mat = [list(map(int, row)) for row in gray]
+    out = [[False] * cols for _ in range(rows)]
+    limit = threshold * 255.0
+    for r in range(rows):
+        line = mat[r]
+        outLine = out[r]
+        for c in range(cols):
+            value = line[c]
+            white = value > limit
+            error = value - (255 if white else 0)
+            outLine[c] = white
+            for dc, dr, proportion in pattern:
+                nr, nc = r + dr, c + dc
+                if nr < rows and 0 <= nc < cols:
+                    mat[nr][nc] = int(min(255.0, max(0.0, mat[nr][nc] + error * proportion)))
+    return np.array(out, dtype=bool)
+
+def gaussianKernel(sigma):
+    radius = max(1, int(round(3 * sigma)))
+    x = np.arange(-radius, radius + 1, dtype=np.float64)
+    kernel = np.exp(-x * x / (2 * sigma * sigma))
+    return kernel / kernel.sum()
+
+# separable blur, edges replicated
+def blur(img, sigma):
+    kernel = gaussianKernel(sigma)
+    radius = len(kernel) // 2
+    result = img.astype(np.float64)
+    for axis in (0, 1):
+        padded = np.pad(result, [(radius, radius) if a == axis else (0, 0) for a in (0, 1)], mode='edge')
+        size = result.shape[axis]
+        result = sum(weight * np.take(padded, range(i, i + size), axis=axis) for i, weight in enumerate(kernel))
+    return result
+
+def psnr(reference, test):
+    mse = np.mean((reference - test) ** 2)
+    return float('inf') if mse == 0 else 10 * np.log10(255.0 ** 2 / mse)
+
+# mean SSIM with the usual 11x11 Gaussian window (sigma 1.5)
+def ssim(reference, test):
+    muX, muY = blur(reference, 1.5), blur(test, 1.5)
+    varX = blur(reference * reference, 1.5) - muX * muX
+    varY = blur(test * test, 1.5) - muY * muY
+    cov = blur(reference * test, 1.5) - muX * muY
+    return float(np.mean(((2 * muX * muY + SSIM_C1) * (2 * cov + SSIM_C2)) / ((muX * muX + muY * muY + SSIM_C1) * (varX + varY + SSIM_C2))))
+
+# Printed reflectance: every burnt dot is a disc of dotRadius (in dot pitch) centered on its cell, which spills over the white neighbours
+def dotGain(white, dotRadius):
+    rows, cols = white.shape
+    centers = np.zeros((rows * SUPERSAMPLING, cols * SUPERSAMPLING), dtype=bool)
+    centers[SUPERSAMPLING // 2::SUPERSAMPLING, SUPERSAMPLING // 2::SUPERSAMPLING] = ~white
+    radius = dotRadius * SUPERSAMPLING
+    reach = int(np.ceil(radius))
+    padded = np.pad(centers, reach)
+    inked = np.zeros_like(centers)
+    for dy in range(-reach, reach + 1):
+        for dx in range(-reach, reach + 1):
+            if dx * dx + dy * dy <= radius * radius:
+                inked |= padded[reach + dy:reach + dy + centers.shape[0], reach + dx:reach + dx + centers.shape[1]]
+    coverage = inked.reshape(rows, SUPERSAMPLING, cols, SUPERSAMPLING).mean(axis=(1, 3))
+    return 255.0 * (1.0 - coverage)
+
+def score(gray, white, sigma, dotRadius):
+    source = gray.astype(np.float64)
+    dithered = np.where(white, 255.0, 0.0)
+    blurredSource = blur(source, sigma)
+    blurredDither = blur(dithered, sigma)
+    return {
+        'psnr': psnr(blurredSource, blurredDither),
+        'ssim': ssim(blurredSource, blurredDither),
+        'dotgain': psnr(blurredSource, blur(dotGain(white, dotRadius), sigma)),
+    }
+
+# {(level, method): ns per pixel} from the benchmark CSV, photo input at the resolution closest to the scored images
+def loadSpeeds(level, path, pixels):
+    with open(path, newline='') as f:
+        rows = [row for row in csv.DictReader(f) if row['content'] == 'photo']
+    if not rows:
+        return {}
+    size = min(set((int(r['width']), int(r['height'])) for r in rows), key=lambda s: abs(s[0] * s[1] - pixels))
+    speeds = {}
+    for row in rows:
+        if (int(row['width']), int(row['height'])) == size:
+            speeds.setdefault((level, row['method']), []).append(float(row['ns_per_pixel']))
+    print('%s: speeds of %dx%d (%s)' % (level, size[0], size[1], path))
+    return {key: sum(values) / len(values) for key, values in speeds.items()}
+
+# points (ns, quality) nobody beats on both axes
+def paretoFront(points):
+    front = set()
+    for key, (ns, quality) in points.items():
+        if not any(otherNs <= ns and otherQuality >= quality and (otherNs, otherQuality) != (ns, quality) for otherNs, otherQuality in points.values()):
+            front.add(key)
+    return front
+
+def usage():
+    print('ditherQuality.py [-i <image glob>] [-b [<level>=]<bench csv>]... [-t <threshold>] [-w <width, 0 keeps the capture size>]')
+    print('                 [-s <blur sigma in dots>] [-d <dot radius in dot pitch>] [-m psnr|ssim|dotgain] [-o <output csv>]')
+
+def main(argv):
+    corpus = DEFAULT_CORPUS
+    benches = []
+    threshold = 0.5
+    width = PRINTER_WIDTH
+    sigma = 1.5
+    dotRadius = 0.8
+    metric = 'ssim'
+    outputFile = ''
+
+    try:
+        opts, args = getopt.getopt(argv, "hi:b:t:w:s:d:m:o:", ["help", "input=", "bench=", "threshold=", "width=", "sigma=", "dot=", "metric=", "output="])
+    except getopt.GetoptError:
+        usage()
+        sys.exit(2)
+    for opt, arg in opts:
+        if opt in ("-h", "--help"):
+            usage()
+            sys.exit()
+        elif opt in ("-i", "--input"):
+            corpus = arg
+        elif opt in ("-b", "--bench"):
+            level, _, path = arg.rpartition('=')
+            benches.append((level or os.path.splitext(os.path.basename(path))[0], path))
+        elif opt in ("-t", "--threshold"):
+            threshold = float(arg)
+        elif opt in ("-w", "--width"):
+            width = int(arg)
+        elif opt in ("-s", "--sigma"):
+            sigma = float(arg)
+        elif opt in ("-d", "--dot"):
+            dotRadius = float(arg)
+        elif opt in ("-m", "--metric"):
+            metric = arg
+        elif opt in ("-o", "--output"):
+            outputFile = arg
+    if metric not in ('psnr', 'ssim', 'dotgain'):
+        usage()
+        sys.exit(2)
+
+    images = sorted(glob.glob(corpus))
+    if not images:
+        print('no image matches %s' % corpus)
+        sys.exit(1)
+    patterns = loadPatterns(FILTERING_HEADER)
+
+    # quality of every method, averaged over the corpus
+    quality = {method: {'psnr': 0.0, 'ssim': 0.0, 'dotgain': 0.0} for method in patterns}
+    pixels = 0
+    for path in images:
+        gray = loadGrayscale(path, width)
+        pixels += gray.size
+        for method, pattern in patterns.items():
+            for name, value in score(gray, errorDiffusion(gray, pattern, threshold), sigma, dotRadius).items():
+                quality[method][name] += value / len(images)
+        print('scored %s (%dx%d)' % (path, gray.shape[1], gray.shape[0]))
+    pixels //= len(images)
+
+    speeds = {}
+    for level, path in benches:
+        speeds.update(loadSpeeds(level, path, pixels))
+    levels = [level for level, _ in benches] or ['']
+
+    table = []
+    for level in levels:
+        for method in patterns:
+            table.append({'level': level, 'method': method, 'taps': len(patterns[method]), 'ns_per_pixel': speeds.get((level, method)), **quality[method]})
+
+    points = {(row['level'], row['method']): (row['ns_per_pixel'], row[metric]) for row in table if row['ns_per_pixel'] is not None}
+    front = paretoFront(points)
+    for row in table:
+        row['pareto'] = (row['level'], row['method']) in front
+
+    table.sort(key=lambda row: (row['ns_per_pixel'] is None, row['ns_per_pixel'] or 0, -row[metric]))
+    print('\n%-10s %-18s %4s %10s %9s %7s %9s  pareto (%s)' % ('level', 'method', 'taps', 'ns/pixel', 'psnr dB', 'ssim', 'dotgain', metric))
+    for row in table:
+        ns = '%10.1f' % row['ns_per_pixel'] if row['ns_per_pixel'] is not None else '%10s' % '-'
+        print('%-10s %-18s %4d %s %9.2f %7.4f %9.2f  %s' % (row['level'], row['method'], row['taps'], ns, row['psnr'], row['ssim'], row['dotgain'], '*' if row['pareto'] else ''))
+
+    if outputFile != '':
+        with open(outputFile, 'w', newline='') as f:
+            writer = csv.DictWriter(f, fieldnames=['level', 'method', 'taps', 'ns_per_pixel', 'psnr', 'ssim', 'dotgain', 'pareto'])
+            writer.writeheader()
+            writer.writerows(table)
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
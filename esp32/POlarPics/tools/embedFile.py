@@ -0,0 +1,52 @@
+### Embed a file as a C array ###
+# Writes a header with the bytes of a file in flash (PROGMEM) and its length, in the style of src/test.h,
+# e.g. the JPEG the dithering benchmark decodes: embedFile.py -i "img test/Capture/01/fb.jpg" -o src/benchPhoto.h -n benchPhoto
+import os, sys, getopt # for arguments
+
+BYTES_PER_LINE = 32
+
+def writeHeader(data, name, path):
+    guard = '_%s_h_' % name
+    with open(path, 'w') as f:
+        f.write('#ifndef %s \n#define %s \n\n' % (guard, guard))
+        f.write('#define %s_len %d \n' % (name, len(data)))
+        f.write('static const uint8_t PROGMEM %s_data[] = {\n' % name)
+        for start in range(0, len(data), BYTES_PER_LINE):
+            f.write(','.join('0x%x' % b for b in data[start:start + BYTES_PER_LINE]) + ',\n')
+        f.write('};\n\n#endif\n')
+
+def usage():
+    print('embedFile.py -i <input file> -o <output header> [-n <symbol name>]')
+
+def main(argv):
+    inputFile = ''
+    output = ''
+    name = ''
+
+    try:
+        opts, args = getopt.getopt(argv, "hi:o:n:", ["help", "input=", "output=", "name="])
+    except getopt.GetoptError:
+        usage()
+        sys.exit(2)
+    for opt, arg in opts:
+        if opt in ("-h", "--help"):
+            usage()
+            sys.exit()
+        elif opt in ("-i", "--input"):
+            inputFile = arg
+        elif opt in ("-o", "--output"):
+            output = arg
+        elif opt in ("-n", "--name"):
+            name = arg
+
+    if inputFile == '' or output == '':
+        usage()
+        sys.exit(2)
+    if name == '':
+        name = os.path.splitext(os.path.basename(output))[0]
+
+    with open(inputFile, 'rb') as f:
+        writeHeader(f.read(), name, output)
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
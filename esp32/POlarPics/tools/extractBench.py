@@ -0,0 +1,78 @@
+### Benchmark extractor ###
+# Picks the dithering benchmark CSV printed by a -DPOLARPICS_BENCH build (env esp32cam-bench) out of a serial log,
+# writes it to a file and prints the fastest method of every resolution
+import sys, getopt # for arguments
+import csv
+
+# returns the rows of the last complete run of a section ('bench', or 'codec' for the PNG / G4 encodes),
+# log lines interleaved with the CSV are dropped
+def extractBench(lines, section='bench'):
+    rows = None
+    current = None
+    for line in lines:
+        line = line.rstrip('\r\n')
+        if line == '# %s begin' % section:
+            current = []
+        elif line == '# %s end' % section and current is not None:
+            rows = current
+            current = None
+        elif current is not None:
+            current.append(line)
+    if not rows:
+        return []
+    header = rows[0].split(',')
+    return [header] + [r for r in csv.reader(rows[1:]) if len(r) == len(header)]
+
+def summary(table):
+    header = table[0]
+    column = {name: i for i, name in enumerate(header)}
+    best = {}
+    for row in table[1:]:
+        size = (int(row[column['width']]), int(row[column['height']]))
+        nsPerPixel = float(row[column['ns_per_pixel']])
+        if size not in best or nsPerPixel < best[size][1]:
+            best[size] = (row[column['method']], nsPerPixel)
+    lines = []
+    for size in sorted(best):
+        method, nsPerPixel = best[size]
+        lines.append('%4dx%-4d fastest: %s (%.1f ns/pixel, %.1f ms/frame)' % (size[0], size[1], method, nsPerPixel, nsPerPixel * size[0] * size[1] / 1e6))
+    return '\n'.join(lines)
+
+def usage():
+    print('extractBench.py -i <serial log> -o <output csv>')
+
+def main(argv):
+    inputFile = ''
+    outputFile = 'bench.csv'
+
+    try:
+        opts, args = getopt.getopt(argv, "hi:o:", ["help", "input=", "output="])
+    except getopt.GetoptError:
+        usage()
+        sys.exit(2)
+    for opt, arg in opts:
+        if opt in ("-h", "--help"):
+            usage()
+            sys.exit()
+        elif opt in ("-i", "--input"):
+            inputFile = arg
+        elif opt in ("-o", "--output"):
+            outputFile = arg
+
+    if inputFile == '':
+        usage()
+        sys.exit(2)
+
+    with open(inputFile, 'r', errors='replace') as f:
+        table = extractBench(f)
+    if not table:
+        print('no complete benchmark run found in %s' % inputFile)
+        sys.exit(1)
+
+    with open(outputFile, 'w', newline='') as f:
+        csv.writer(f).writerows(table)
+    print('wrote %s: %d configurations' % (outputFile, len(table) - 1))
+    print(summary(table))
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
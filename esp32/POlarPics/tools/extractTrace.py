@@ -0,0 +1,68 @@
+### Trace extractor ###
+# Picks the Chrome trace JSON dumped by trace::exportChromeTrace (long press on back with -DPOLARPICS_TRACE)
+# out of a serial log, the result opens in chrome://tracing or ui.perfetto.dev
+import sys, getopt # for arguments
+import json
+
+BEGIN_MARKER = '# trace begin'
+END_MARKER = '# trace end'
+
+# returns the JSON text of every dump found in the log
+def extractTraces(lines):
+    traces = []
+    current = None
+    for line in lines:
+        line = line.rstrip('\r\n')
+        if line == BEGIN_MARKER:
+            current = []
+        elif line == END_MARKER and current is not None:
+            traces.append('\n'.join(current))
+            current = None
+        elif current is not None:
+            current.append(line)
+    return traces
+
+def usage():
+    print('extractTrace.py -i <serial log> -o <output json> [-n <dump index, default last>]')
+
+def main(argv):
+    inputFile = ''
+    outputFile = 'trace.json'
+    index = -1
+
+    try:
+        opts, args = getopt.getopt(argv, "hi:o:n:", ["help", "input=", "output=", "index="])
+    except getopt.GetoptError:
+        usage()
+        sys.exit(2)
+    for opt, arg in opts:
+        if opt in ("-h", "--help"):
+            usage()
+            sys.exit()
+        elif opt in ("-i", "--input"):
+            inputFile = arg
+        elif opt in ("-o", "--output"):
+            outputFile = arg
+        elif opt in ("-n", "--index"):
+            index = int(arg)
+
+    if inputFile == '':
+        usage()
+        sys.exit(2)
+
+    with open(inputFile, 'r', errors='replace') as f:
+        traces = extractTraces(f)
+    if not traces:
+        print('no trace found in %s' % inputFile)
+        sys.exit(1)
+
+    # validate before writing, a dump cut by a reset is not usable
+    trace = json.loads(traces[index])
+    with open(outputFile, 'w') as f:
+        json.dump(trace, f)
+
+    events = trace['traceEvents']
+    print('%d traces found, wrote %s: %d events' % (len(traces), outputFile, len(events)))
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -0,0 +1,99 @@
+### JPEG scaled decode benchmark ###
+# Host side comparison of the two ways jpeg::GrayDecoder can produce a preview or print sized grayscale image:
+# full decode then nearest neighbour resize, against a DCT domain scaled decode (1/2, 1/4, 1/8, picked like jpeg::pickScale)
+# then the same resize of what is left. libjpeg's scaled IDCT (PIL draft mode) stands in for the ROM decoder,
+# the speedup is indicative only, and both results are scored against an area averaged reference.
+import os, sys, getopt # for arguments
+import glob
+import time
+import numpy as np
+from PIL import Image # load images
+
+DEFAULT_CORPUS = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', '..', 'img test', 'Capture', '*', 'fb.jpg')
+DEFAULT_TARGETS = [(160, 120), (320, 240)] # preview levels
+SCALES = [1, 2, 4, 8]
+
+# most reduced scale still at least as large as the target on both sides, as jpeg::pickScale
+def pickScale(width, height, targetWidth, targetHeight):
+    scale = 1
+    for divisor in SCALES[1:]:
+        if width // divisor < targetWidth or height // divisor < targetHeight:
+            break
+        scale = divisor
+    return scale
+
+# same sampling as utils::GrayRowRescaler
+def nearest(gray, width, height):
+    rows = (np.arange(height, dtype=np.float32) / np.float32(height) * np.float32(gray.shape[0])).astype(np.intp)
+    cols = (np.arange(width, dtype=np.float32) / np.float32(width) * np.float32(gray.shape[1])).astype(np.intp)
+    return gray[rows[:, None], cols[None, :]]
+
+# luma only decode at 1/scale, then resized to the target
+def decode(path, scale, width, height):
+    img = Image.open(path)
+    img.draft('L', (img.size[0] // scale, img.size[1] // scale))
+    gray = np.asarray(img.convert('L'))
+    if gray.shape != (height, width):
+        gray = nearest(gray, width, height)
+    return gray
+
+def psnr(reference, test):
+    mse = np.mean((reference.astype(np.float64) - test.astype(np.float64)) ** 2)
+    return float('inf') if mse == 0 else 10 * np.log10(255.0 ** 2 / mse)
+
+# best of repeats, in ms
+def timeDecode(path, scale, width, height, repeats):
+    best = float('inf')
+    for _ in range(repeats):
+        start = time.perf_counter()
+        decode(path, scale, width, height)
+        best = min(best, time.perf_counter() - start)
+    return best * 1000
+
+def usage():
+    print('jpegScaleBench.py [-i <image glob>] [-t <width>x<height>]... [-r <repeats>]')
+
+def main(argv):
+    corpus = DEFAULT_CORPUS
+    targets = []
+    repeats = 20
+
+    try:
+        opts, args = getopt.getopt(argv, "hi:t:r:", ["help", "input=", "target=", "repeats="])
+    except getopt.GetoptError:
+        usage()
+        sys.exit(2)
+    for opt, arg in opts:
+        if opt in ("-h", "--help"):
+            usage()
+            sys.exit()
+        elif opt in ("-i", "--input"):
+            corpus = arg
+        elif opt in ("-t", "--target"):
+            width, _, height = arg.partition('x')
+            targets.append((int(width), int(height)))
+        elif opt in ("-r", "--repeats"):
+            repeats = int(arg)
+    targets = targets or DEFAULT_TARGETS
+
+    images = sorted(glob.glob(corpus))
+    if not images:
+        print('no image matches %s' % corpus)
+        sys.exit(1)
+
+    print('%-9s %-9s %5s %9s %9s %7s %11s %11s' % ('source', 'target', 'scale', 'full ms', 'scaled ms', 'speedup', 'full dB', 'scaled dB'))
+    for path in images:
+        sourceWidth, sourceHeight = Image.open(path).size
+        for width, height in targets:
+            if width > sourceWidth or height > sourceHeight:
+                continue
+            scale = pickScale(sourceWidth, sourceHeight, width, height)
+            reference = np.asarray(Image.open(path).convert('L').resize((width, height), Image.BOX))
+            fullMs = timeDecode(path, 1, width, height, repeats)
+            scaledMs = timeDecode(path, scale, width, height, repeats)
+            print('%4dx%-4d %4dx%-4d %5s %9.2f %9.2f %6.2fx %11.2f %11.2f  %s' % (sourceWidth, sourceHeight, width, height, '1/%d' % scale,
+                fullMs, scaledMs, fullMs / scaledMs, psnr(reference, decode(path, 1, width, height)), psnr(reference, decode(path, scale, width, height)),
+                os.path.relpath(path)))
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
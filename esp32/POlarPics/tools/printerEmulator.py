@@ -0,0 +1,303 @@
+### Thermal printer emulator ###
+# Parses the ESC/POS subset sent by Adafruit_Thermal (and the GS v 0 raster command),
+# models the serial link and the dot line print time, then renders what would have been printed to a PBM file.
+import os, sys, getopt # for arguments
+import pty, select, tty
+import time
+
+ESC = 0x1B
+GS = 0x1D
+DC2 = 0x12
+
+PRINTER_WIDTH = 384 # dots per line
+
+# number of parameter bytes of the fixed size commands, by prefix
+FIXED_COMMANDS = {
+    (ESC, ord('@')): 0, # reset
+    (ESC, ord('7')): 3, # heat config: max heating dots, heat time, heat interval
+    (ESC, ord('8')): 2, # sleep after n seconds (firmware >= 2.64)
+    (ESC, ord('=')): 1, # online / offline
+    (ESC, ord('a')): 1, # justify
+    (ESC, ord('!')): 1, # print mode
+    (ESC, ord('-')): 1, # underline
+    (ESC, ord('2')): 0, # default line spacing
+    (ESC, ord('3')): 1, # line spacing
+    (ESC, ord(' ')): 1, # char spacing
+    (ESC, ord('R')): 1, # charset
+    (ESC, ord('t')): 1, # code page
+    (ESC, ord('E')): 1, # bold
+    (ESC, ord('{')): 1, # upside down
+    (ESC, ord('d')): 1, # feed lines
+    (ESC, ord('J')): 1, # feed dot rows
+    (ESC, ord('v')): 1, # paper status
+    (GS, ord('!')): 1, # character size
+    (GS, ord('B')): 1, # inverse
+    (GS, ord('h')): 1, # barcode height
+    (GS, ord('H')): 1, # barcode text position
+    (GS, ord('w')): 1, # barcode module width
+    (DC2, ord('#')): 1, # print density
+    (DC2, ord('T')): 0, # test page
+}
+
+class ThermalPrinterEmulator:
+
+    def __init__(self, baud = 9600, bitsPerByte = 10, feedUs = 2100):
+        self.baud = baud
+        self.bitsPerByte = bitsPerByte # 8N1
+        self.feedUs = feedUs # paper motion for one dot row
+        # heat config as set by Adafruit_Thermal::begin
+        self.maxHeatingDots = 11
+        self.heatTime = 120
+        self.heatInterval = 40
+        self.lineSpacing = 6
+        self.charHeight = 24
+
+        self.rows = [] # printed dot rows (bytearray of PRINTER_WIDTH / 8)
+        self.pending = bytearray()
+        self.textColumn = 0
+
+        # statistics
+        self.bytesReceived = 0
+        self.bitmapBytes = 0
+        self.commandCounts = {}
+        self.wireUs = 0.0 # time to carry the bytes at the given baud rate
+        self.printUs = 0.0 # modeled time at which the printer mechanism is done
+        self.dotLines = 0
+        self.firstByteTime = None
+        self.lastByteTime = None
+        self.responses = bytearray() # bytes the printer sends back (paper status)
+
+    # time to burn one dot row: the dots are heated in passes of (maxHeatingDots + 1) * 8 dots
+    def dotLineUs(self, row):
+        dots = sum(bin(b).count('1') for b in row)
+        dotsPerPass = (self.maxHeatingDots + 1) * 8
+        passes = (dots + dotsPerPass - 1) // dotsPerPass
+        return max(self.feedUs, passes * self.heatTime * 10 + self.heatInterval * 10)
+
+    def addRow(self, row):
+        row = bytearray(row[:PRINTER_WIDTH // 8])
+        row.extend(bytes(PRINTER_WIDTH // 8 - len(row)))
+        self.rows.append(row)
+        self.dotLines += 1
+        self.printUs = max(self.printUs, self.wireUs) + self.dotLineUs(row)
+
+    def feedRows(self, count):
+        for i in range(count):
+            self.rows.append(bytearray(PRINTER_WIDTH // 8))
+        self.printUs = max(self.printUs, self.wireUs) + count * self.feedUs
+
+    def count(self, name):
+        self.commandCounts[name] = self.commandCounts.get(name, 0) + 1
+
+    def feed(self, data, timestamp = None):
+        if timestamp is None:
+            timestamp = time.monotonic()
+        if self.firstByteTime is None:
+            self.firstByteTime = timestamp
+        self.lastByteTime = timestamp
+
+        self.bytesReceived += len(data)
+        self.pending.extend(data)
+        while self.pending:
+            # a command only takes effect once its bytes are through the wire, the raster rows one at a time
+            startUs = self.wireUs
+            used = self.parse(self.pending)
+            if used == 0:
+                break # incomplete command, wait for more bytes
+            self.wireUs = startUs + used * self.byteUs()
+            del self.pending[:used]
+
+    def byteUs(self):
+        return self.bitsPerByte * 1e6 / self.baud
+
+    # returns the number of bytes consumed, 0 when the command is not complete yet
+    def parse(self, buf):
+        b = buf[0]
+        if b == 0xFF: # wake
+            self.count('wake')
+            return 1
+        if b == ord('\n'):
+            self.count('newline')
+            self.feedRows(self.charHeight + self.lineSpacing)
+            self.textColumn = 0
+            return 1
+        if b not in (ESC, GS, DC2):
+            self.count('text')
+            self.textColumn += 1
+            return 1
+        if len(buf) < 2:
+            return 0
+
+        key = (b, buf[1])
+        if key == (DC2, ord('*')): # DC2 * rows rowBytes data
+            if len(buf) < 4:
+                return 0
+            rows, rowBytes = buf[2], buf[3]
+            size = 4 + rows * rowBytes
+            if len(buf) < size:
+                return 0
+            self.count('DC2 *')
+            self.bitmapBytes += rows * rowBytes
+            self.wireUs += 4 * self.byteUs()
+            for r in range(rows):
+                self.wireUs += rowBytes * self.byteUs()
+                self.addRow(buf[4 + r * rowBytes:4 + (r + 1) * rowBytes])
+            return size
+
+        if key == (GS, ord('v')): # GS v 0 m xL xH yL yH data
+            if len(buf) < 8:
+                return 0
+            rowBytes = buf[4] | buf[5] << 8
+            rows = buf[6] | buf[7] << 8
+            size = 8 + rows * rowBytes
+            if len(buf) < size:
+                return 0
+            self.count('GS v 0')
+            self.bitmapBytes += rows * rowBytes
+            self.wireUs += 8 * self.byteUs()
+            for r in range(rows):
+                self.wireUs += rowBytes * self.byteUs()
+                self.addRow(buf[8 + r * rowBytes:8 + (r + 1) * rowBytes])
+            return size
+
+        if key == (ESC, ord('D')): # tab stops, NUL terminated
+            if 0 not in buf[2:]:
+                return 0
+            self.count('ESC D')
+            return buf.index(0, 2) + 1
+
+        if key == (GS, ord('k')): # barcode
+            if len(buf) < 3:
+                return 0
+            if buf[2] >= 65: # GS k m n data
+                if len(buf) < 4 or len(buf) < 4 + buf[3]:
+                    return 0
+                size = 4 + buf[3]
+            else: # GS k m data NUL
+                if 0 not in buf[3:]:
+                    return 0
+                size = buf.index(0, 3) + 1
+            self.count('GS k')
+            return size
+
+        if key not in FIXED_COMMANDS:
+            self.count('unknown %02X %02X' % key)
+            return 2
+
+        size = 2 + FIXED_COMMANDS[key]
+        if len(buf) < size:
+            return 0
+        name = '%s %s' % ({ESC: 'ESC', GS: 'GS', DC2: 'DC2'}[b], chr(buf[1]))
+        self.count(name)
+
+        if key == (ESC, ord('7')):
+            self.maxHeatingDots, self.heatTime, self.heatInterval = buf[2], buf[3], buf[4]
+        elif key == (ESC, ord('@')):
+            self.lineSpacing = 6
+        elif key == (ESC, ord('3')):
+            self.lineSpacing = buf[2]
+        elif key == (ESC, ord('2')):
+            self.lineSpacing = 6
+        elif key == (ESC, ord('J')):
+            self.feedRows(buf[2])
+        elif key == (ESC, ord('d')):
+            self.feedRows(buf[2] * (self.charHeight + self.lineSpacing))
+        elif key == (ESC, ord('v')):
+            self.responses.append(0) # paper present
+        return size
+
+    def writePbm(self, path):
+        with open(path, 'wb') as f:
+            f.write(b'P4\n%d %d\n' % (PRINTER_WIDTH, len(self.rows)))
+            for row in self.rows:
+                f.write(bytes(row)) # a set bit is a burnt dot, the PBM convention for black
+
+    def report(self):
+        lines = []
+        lines.append('bytes received: %d (bitmap payload: %d)' % (self.bytesReceived, self.bitmapBytes))
+        lines.append('dot lines: %d, paper rows: %d' % (self.dotLines, len(self.rows)))
+        lines.append('wire time at %d baud: %.3f s' % (self.baud, self.wireUs / 1e6))
+        lines.append('modeled print time: %.3f s' % (self.printUs / 1e6))
+        if self.printUs > 0:
+            lines.append('modeled throughput: %.1f dot lines/s' % (self.dotLines * 1e6 / self.printUs))
+        if self.firstByteTime is not None and self.lastByteTime > self.firstByteTime:
+            elapsed = self.lastByteTime - self.firstByteTime
+            lines.append('measured arrival: %.3f s, %.0f bytes/s, %.1f dot lines/s' % (elapsed, self.bytesReceived / elapsed, self.dotLines / elapsed))
+        for name in sorted(self.commandCounts):
+            lines.append('  %s: %d' % (name, self.commandCounts[name]))
+        return '\n'.join(lines)
+
+# Serve one job per burst of bytes on a pseudo terminal, a job ends after idle seconds without data
+def runPty(outputPrefix, baud, idle, verbose):
+    master, slave = pty.openpty()
+    tty.setraw(slave)
+    print('printer emulator listening on %s' % os.ttyname(slave))
+    sys.stdout.flush()
+
+    job = 0
+    emulator = None
+    while True:
+        ready, _, _ = select.select([master], [], [], idle)
+        if ready:
+            data = os.read(master, 4096)
+            if verbose:
+                print('received %d bytes' % len(data))
+            if emulator is None:
+                emulator = ThermalPrinterEmulator(baud)
+            emulator.feed(data)
+            if emulator.responses:
+                os.write(master, bytes(emulator.responses))
+                emulator.responses.clear()
+        elif emulator is not None:
+            output = '%s%03d.pbm' % (outputPrefix, job)
+            emulator.writePbm(output)
+            print('--- job %d -> %s' % (job, output))
+            print(emulator.report())
+            sys.stdout.flush()
+            job += 1
+            emulator = None
+
+def usage():
+    print('printerEmulator.py [-i <raw byte file>] -o <output pbm (prefix in pty mode)> [-b <baud>] [--idle <seconds>]')
+
+def main(argv):
+    inputFile = ''
+    output = 'print'
+    baud = 9600
+    idle = 2.0
+    verbose = False
+
+    try:
+        opts, args = getopt.getopt(argv, "hvi:o:b:", ["help", "verbose", "input=", "output=", "baud=", "idle="])
+    except getopt.GetoptError:
+        usage()
+        sys.exit(2)
+    for opt, arg in opts:
+        if opt in ("-h", "--help"):
+            usage()
+            sys.exit()
+        elif opt in ("-v", "--verbose"):
+            verbose = True
+        elif opt in ("-i", "--input"):
+            inputFile = arg
+        elif opt in ("-o", "--output"):
+            output = arg
+        elif opt in ("-b", "--baud"):
+            baud = int(arg)
+        elif opt in ("--idle",):
+            idle = float(arg)
+
+    if inputFile == '':
+        runPty(output, baud, idle, verbose)
+        return
+
+    emulator = ThermalPrinterEmulator(baud)
+    with open(inputFile, 'rb') as f:
+        emulator.feed(f.read(), 0.0)
+    if not output.endswith('.pbm'):
+        output += '.pbm'
+    emulator.writePbm(output)
+    print(emulator.report())
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -0,0 +1,168 @@
+### Printer byte stream replay ###
+# Reads a capture of the bytes sent to the printer (env esp32cam-capture, /sdcard/captures/<n>.cap, see lib/thermal/CaptureTee.h)
+# and replays it: into the printer emulator in process (-e, the recorded times drive its model, nothing waits),
+# to a serial port or the pseudo terminal of printerEmulator.py (-p) at the recorded pace or as fast as the port takes (-m),
+# as a raw byte file (-r, printerEmulator.py -i), or compares it byte for byte with another capture (-c).
+import os, sys, getopt # for arguments
+import struct
+import time
+
+import printerEmulator
+
+MAGIC = b'POLARCAP'
+HEADER = struct.Struct('<8sIIB3x')
+RECORD = struct.Struct('<IH')
+RASTER_COMMANDS = ['GS v 0', 'DC2 *'] # thermal::ERasterCommand
+
+class Capture:
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            data = f.read()
+        if len(data) < HEADER.size:
+            raise ValueError('%s: too short for a capture' % path)
+        magic, self.version, self.baud, command = HEADER.unpack_from(data)
+        if magic != MAGIC:
+            raise ValueError('%s: not a printer capture' % path)
+        self.command = RASTER_COMMANDS[command] if command < len(RASTER_COMMANDS) else 'unknown'
+
+        self.records = [] # (us since the capture opened, bytes)
+        offset = HEADER.size
+        while offset + RECORD.size <= len(data):
+            timeUs, length = RECORD.unpack_from(data, offset)
+            offset += RECORD.size
+            self.records.append((timeUs, data[offset:offset + length]))
+            offset += length
+        self.truncated = offset != len(data) # the device stopped in the middle of a record
+
+    def bytes(self):
+        return b''.join(chunk for _, chunk in self.records)
+
+    def durationUs(self):
+        return self.records[-1][0] if self.records else 0
+
+    def report(self):
+        size = len(self.bytes())
+        duration = self.durationUs() / 1e6
+        lines = ['%d records, %d bytes over %.3f s (%s, %d baud)%s' % (len(self.records), size, duration, self.command, self.baud,
+            ', truncated' if self.truncated else '')]
+        if duration > 0:
+            lines.append('sent at %.0f bytes/s, the link carries %.0f' % (size / duration, self.baud / 10))
+        return '\n'.join(lines)
+
+# first byte where the two streams differ, with the record time of that byte in each capture
+def compare(first, second):
+    a, b = first.bytes(), second.bytes()
+    offset = next((i for i in range(min(len(a), len(b))) if a[i] != b[i]), None)
+    if offset is None and len(a) == len(b):
+        print('identical: %d bytes (%.3f s against %.3f s)' % (len(a), first.durationUs() / 1e6, second.durationUs() / 1e6))
+        return True
+    if offset is None:
+        offset = min(len(a), len(b))
+
+    def timeAt(capture, position):
+        for timeUs, chunk in capture.records:
+            if position < len(chunk):
+                return timeUs / 1e6
+            position -= len(chunk)
+        return capture.durationUs() / 1e6
+
+    print('differ at byte %d of %d / %d (%.3f s / %.3f s)' % (offset, len(a), len(b), timeAt(first, offset), timeAt(second, offset)))
+    start = max(0, offset - 8)
+    print('  %s' % a[start:offset + 8].hex(' '))
+    print('  %s' % b[start:offset + 8].hex(' '))
+    return False
+
+# every record at its recorded time (or all at 0), the emulator models the link and the mechanism from there
+def emulate(capture, maxPace, output):
+    emulator = printerEmulator.ThermalPrinterEmulator(capture.baud)
+    for timeUs, chunk in capture.records:
+        emulator.feed(chunk, 0.0 if maxPace else timeUs / 1e6)
+    if not output.endswith('.pbm'):
+        output += '.pbm'
+    emulator.writePbm(output)
+    print(emulator.report())
+
+def openPort(path, baud):
+    try:
+        import serial # pyserial, only needed for a real port
+        return serial.Serial(path, baud)
+    except ImportError:
+        return open(path, 'wb', buffering=0) # a pseudo terminal ignores the baud rate
+
+def send(capture, path, baud, maxPace, speed):
+    port = openPort(path, baud)
+    start = time.monotonic()
+    late = 0.0
+    for timeUs, chunk in capture.records:
+        if not maxPace:
+            due = start + timeUs / 1e6 / speed
+            now = time.monotonic()
+            if due > now:
+                time.sleep(due - now)
+            else:
+                late = max(late, now - due)
+        port.write(chunk)
+    port.flush()
+    elapsed = time.monotonic() - start
+    print('replayed %d bytes to %s in %.3f s (recorded %.3f s), at most %.1f ms late' % (len(capture.bytes()), path, elapsed,
+        capture.durationUs() / 1e6, late * 1e3))
+    port.close()
+
+def usage():
+    print('replayPrint.py -i <capture> [-e <emulator output pbm>] [-p <serial port or pty>] [-b <baud>] [-m] [-s <speed factor>]')
+    print('               [-r <raw byte file>] [-c <other capture>]')
+
+def main(argv):
+    inputFile = ''
+    emulatorOutput = ''
+    port = ''
+    baud = 0
+    maxPace = False
+    speed = 1.0
+    rawFile = ''
+    otherFile = ''
+
+    try:
+        opts, args = getopt.getopt(argv, "hi:e:p:b:ms:r:c:", ["help", "input=", "emulate=", "port=", "baud=", "max", "speed=", "raw=", "compare="])
+    except getopt.GetoptError:
+        usage()
+        sys.exit(2)
+    for opt, arg in opts:
+        if opt in ("-h", "--help"):
+            usage()
+            sys.exit()
+        elif opt in ("-i", "--input"):
+            inputFile = arg
+        elif opt in ("-e", "--emulate"):
+            emulatorOutput = arg
+        elif opt in ("-p", "--port"):
+            port = arg
+        elif opt in ("-b", "--baud"):
+            baud = int(arg)
+        elif opt in ("-m", "--max"):
+            maxPace = True
+        elif opt in ("-s", "--speed"):
+            speed = float(arg)
+        elif opt in ("-r", "--raw"):
+            rawFile = arg
+        elif opt in ("-c", "--compare"):
+            otherFile = arg
+
+    if inputFile == '':
+        usage()
+        sys.exit(2)
+
+    capture = Capture(inputFile)
+    print(capture.report())
+    if rawFile != '':
+        with open(rawFile, 'wb') as f:
+            f.write(capture.bytes())
+    if emulatorOutput != '':
+        emulate(capture, maxPace, emulatorOutput)
+    if port != '':
+        send(capture, port, baud or capture.baud, maxPace, speed)
+    if otherFile != '' and not compare(capture, Capture(otherFile)):
+        sys.exit(1)
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -0,0 +1,89 @@
+### Preview stream statistics ###
+# Reads the dithered preview stream of a -DPOLARPICS_SERVER build (env esp32cam-server, or the localhost server of the host build),
+# prints the frames per second and bytes per frame seen by the client and optionally keeps the last frame (PBM or BMP as received)
+import sys, getopt # for arguments
+import time
+import urllib.request
+
+DEFAULT_URL = 'http://192.168.4.1:81/stream?format=pbm' # access point address of the device
+
+# yields (content type, body) of every part of a multipart/x-mixed-replace response
+def parts(stream):
+    while True:
+        headers = {}
+        line = stream.readline()
+        while line in (b'\r\n', b'\n'):
+            line = stream.readline()
+        if not line:
+            return
+        if not line.startswith(b'--'):
+            raise ValueError('no multipart boundary: %r' % line)
+        line = stream.readline()
+        while line not in (b'\r\n', b'\n', b''):
+            name, _, value = line.decode().partition(':')
+            headers[name.strip().lower()] = value.strip()
+            line = stream.readline()
+        body = stream.read(int(headers['content-length']))
+        yield headers.get('content-type', ''), body
+
+def usage():
+    print('streamStats.py [-u <stream url>] [-d <seconds, 0 runs until interrupted>] [-r <report period in seconds>] [-o <last frame file>]')
+
+def main(argv):
+    url = DEFAULT_URL
+    duration = 10.0
+    period = 2.0
+    outputFile = ''
+
+    try:
+        opts, args = getopt.getopt(argv, "hu:d:r:o:", ["help", "url=", "duration=", "report=", "output="])
+    except getopt.GetoptError:
+        usage()
+        sys.exit(2)
+    for opt, arg in opts:
+        if opt in ("-h", "--help"):
+            usage()
+            sys.exit()
+        elif opt in ("-u", "--url"):
+            url = arg
+        elif opt in ("-d", "--duration"):
+            duration = float(arg)
+        elif opt in ("-r", "--report"):
+            period = float(arg)
+        elif opt in ("-o", "--output"):
+            outputFile = arg
+
+    start = time.monotonic()
+    windowStart = start
+    windowFrames, windowBytes = 0, 0
+    totalFrames, totalBytes = 0, 0
+    last = None
+    try:
+        with urllib.request.urlopen(url) as stream:
+            for contentType, body in parts(stream):
+                last = body
+                windowFrames += 1
+                windowBytes += len(body)
+                now = time.monotonic()
+                if now - windowStart >= period:
+                    print('%5.1f fps, %6d bytes per frame, %6.1f KB/s (%s)' % (windowFrames / (now - windowStart), windowBytes // windowFrames,
+                        windowBytes / 1024 / (now - windowStart), contentType))
+                    totalFrames += windowFrames
+                    totalBytes += windowBytes
+                    windowStart, windowFrames, windowBytes = now, 0, 0
+                if duration > 0 and now - start >= duration:
+                    break
+    except KeyboardInterrupt:
+        pass
+
+    totalFrames += windowFrames
+    totalBytes += windowBytes
+    elapsed = time.monotonic() - start
+    if totalFrames > 0:
+        print('%d frames in %.1f s: %.1f fps, %d bytes per frame' % (totalFrames, elapsed, totalFrames / elapsed, totalBytes // totalFrames))
+    if outputFile != '' and last is not None:
+        with open(outputFile, 'wb') as f:
+            f.write(last)
+
+if __name__ == "__main__":
+    main(sys.argv[1:])